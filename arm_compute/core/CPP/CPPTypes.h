@@ -227,6 +227,7 @@ struct ThreadInfo
     int            thread_id{ 0 };
     int            num_threads{ 1 };
     const CPUInfo *cpu_info{ nullptr };
+    int            cpu_id{ -1 }; /**< Id of the core the thread is bound to, -1 if the thread is not bound to a core */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPP_TYPES_H__ */
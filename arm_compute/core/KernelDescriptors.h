@@ -29,15 +29,17 @@ namespace arm_compute
 /** Descriptor for FFT scale kernels */
 struct FFTScaleKernelInfo
 {
-    float scale{ 0.f };      /**< Axis to perform the kernel on. */
-    bool  conjugate{ true }; /**< Flag to conjugate the output/ */
+    float scale{ 0.f };            /**< Axis to perform the kernel on. */
+    bool  conjugate{ true };       /**< Flag to conjugate the output/ */
+    bool  is_packed_real{ false }; /**< Flag to store the complex output as a real tensor of twice its width */
 };
 
 /** Descriptor for FFT digit reverse kernels */
 struct FFTDigitReverseKernelInfo
 {
-    unsigned int axis{ 0 };          /**< Axis to perform the kernel on. */
-    bool         conjugate{ false }; /**< Flag to conjugate the output/ */
+    unsigned int axis{ 0 };               /**< Axis to perform the kernel on. */
+    bool         conjugate{ false };      /**< Flag to conjugate the output/ */
+    bool         is_packed_real{ false }; /**< Flag to read a real input as a complex tensor of half its width (axis 0 only) */
 };
 
 /** Descriptor used by the FFT core kernels */
@@ -48,5 +50,11 @@ struct FFTRadixStageKernelInfo
     unsigned int Nx{ 0 };                 /**< Nx coefficient. */
     bool         is_first_stage{ false }; /**< Flags if the FFT kernels is the first stage of a decomposed FFT. */
 };
+
+/** Descriptor for FFT real split kernels */
+struct FFTRealSplitKernelInfo
+{
+    bool inverse{ false }; /**< Flag to merge a half spectrum into the spectrum of the packed real sequence instead of splitting it */
+};
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CORE_KERNEL_DESCRIPTORS_H__ */
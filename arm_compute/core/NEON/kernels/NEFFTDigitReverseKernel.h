@@ -53,6 +53,8 @@ public:
     /** Default destructor */
     ~NEFFTDigitReverseKernel() = default;
     /** Set the input and output tensors.
+     *
+     * @note If @p config is_packed_real is set, a real @p input of width 2N is read as a complex sequence of width N
      *
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
@@ -29,6 +29,7 @@
 
 #include <arm_neon.h>
 #include <set>
+#include <vector>
 
 namespace arm_compute
 {
@@ -73,22 +74,33 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRadixStageKernelInfo &config);
-    /** Returns the radix that are support by the FFT kernel
+    /** Returns the radix that have a specialised stage in the FFT kernel
      *
      * @return A set of supported radix
      */
     static std::set<unsigned int> supported_radix();
+    /** Checks if a radix can be used by the FFT kernel
+     *
+     * @note Odd radix without a specialised stage are computed by a generic radix stage
+     *
+     * @param[in] radix Radix to check.
+     *
+     * @return True if the radix is supported
+     */
+    static bool is_radix_supported(unsigned int radix);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    ITensor     *_input;
-    ITensor     *_output;
-    bool         _run_in_place;
-    unsigned int _Nx;
-    unsigned int _axis;
-    unsigned int _radix;
+    ITensor           *_input;
+    ITensor           *_output;
+    bool               _run_in_place;
+    unsigned int       _Nx;
+    unsigned int       _axis;
+    unsigned int       _radix;
+    std::vector<float> _cos_table;
+    std::vector<float> _sin_table;
 
     void set_radix_stage_axis0(const FFTRadixStageKernelInfo &config);
     void set_radix_stage_axis1(const FFTRadixStageKernelInfo &config);
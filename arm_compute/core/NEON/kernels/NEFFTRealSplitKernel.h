@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFFTREALSPLITKERNEL_H__
+#define __ARM_COMPUTE_NEFFTREALSPLITKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel converting between the FFT of a real sequence packed as a complex sequence of half its length and its half spectrum.
+ *
+ * A real sequence x of even length N is packed as z[n] = x[2n] + i * x[2n+1], n in [0, N/2). The forward split computes the
+ * N/2 + 1 non redundant bins of the spectrum of x from the spectrum of z, while the inverse merge computes the spectrum of z from them.
+ */
+class NEFFTRealSplitKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTRealSplitKernel";
+    }
+    /** Constructor */
+    NEFFTRealSplitKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealSplitKernel(const NEFFTRealSplitKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealSplitKernel &operator=(const NEFFTRealSplitKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTRealSplitKernel(NEFFTRealSplitKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTRealSplitKernel &operator=(NEFFTRealSplitKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTRealSplitKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     *                    Spectrum of the packed sequence [N/2, ...] if splitting, else half spectrum [N/2 + 1, ...].
+     * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                    Half spectrum [N/2 + 1, ...] if splitting, else spectrum of the packed sequence [N/2, ...].
+     * @param[in]  config Kernel configuration
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTRealSplitKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTRealSplitKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] config Kernel configuration
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealSplitKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    bool               _inverse;
+    std::vector<float> _twiddles;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEFFTREALSPLITKERNEL_H__ */
@@ -54,6 +54,8 @@ public:
     /** Default destructor */
     ~NEFFTScaleKernel() = default;
     /** Set the input and output tensors.
+     *
+     * @note If @p config is_packed_real is set, a complex @p input of width N is stored in a real @p output of width 2N
      *
      * @param[in,out] input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
      * @param[out]    output Destination tensor. Data type supported: same as @p input. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
@@ -79,6 +81,7 @@ private:
     float    _scale;
     bool     _run_in_place;
     bool     _is_conj;
+    bool     _is_packed_real;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEFFTSCALEKERNEL_H__ */
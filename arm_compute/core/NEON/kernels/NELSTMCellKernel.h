@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+#define __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to perform the element-wise part of a LSTM cell
+ *
+ * The kernel reads the pre-activation gates computed by a single fully connected layer and stored in the scratch buffer as
+ * [input_gate (without CIFG), cell_gate, forget_gate, output_gate] along the X axis, and computes:
+ *
+ * -# forget_gate      = Logistic(forget_gate + cell_state_in * cell_to_forget_weights)
+ * -# input_gate       = 1 - forget_gate (with CIFG) or Logistic(input_gate + cell_state_in * cell_to_input_weights) (without CIFG)
+ * -# cell_state_out   = Clip(input_gate * Activation(cell_gate) + forget_gate * cell_state_in, cell_threshold)
+ * -# output_gate      = Logistic(output_gate + cell_state_out * cell_to_output_weights)
+ * -# output_state_out = output_gate * Activation(cell_state_out)
+ *
+ * The peephole terms are only added if peephole weights are given. The activated gates and the cell state are written back to the scratch buffer.
+ */
+class NELSTMCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMCellKernel";
+    }
+    /** Default constructor */
+    NELSTMCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    NELSTMCellKernel(const NELSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers). */
+    NELSTMCellKernel &operator=(const NELSTMCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel(NELSTMCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel &operator=(NELSTMCellKernel &&) = default;
+    /** Initialize the kernel's inputs and outputs.
+     *
+     * @param[in,out] scratch_buffer         Scratch buffer holding the pre-activation gates, 2D tensor with dimensions [num_cells * 4, batch_size] without CIFG or [num_cells * 3, batch_size] with CIFG.
+     *                                       Data types supported: F16/F32. Overwritten with the activated gates and the cell state.
+     * @param[in]     cell_state_in          2D tensor with dimensions [num_cells, batch_size]. Data type supported: Same as @p scratch_buffer.
+     * @param[in]     cell_to_input_weights  1D weights tensor with dimensions [num_cells]. Can be nullptr with CIFG or without peephole. Data type supported: Same as @p scratch_buffer.
+     * @param[in]     cell_to_forget_weights 1D weights tensor with dimensions [num_cells]. Can be nullptr without peephole. Data type supported: Same as @p scratch_buffer.
+     * @param[in]     cell_to_output_weights 1D weights tensor with dimensions [num_cells]. Can be nullptr without peephole. Data type supported: Same as @p scratch_buffer.
+     * @param[out]    cell_state_out         2D tensor with dimensions [num_cells, batch_size]. Data type supported: Same as @p scratch_buffer.
+     * @param[out]    output_state_out       2D tensor with dimensions [num_cells, batch_size]. Data type supported: Same as @p scratch_buffer.
+     * @param[in]     activation_info        Contains activation information described in @ref ActivationLayerInfo.
+     * @param[in]     cell_threshold         The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip]. If set to 0.0 then clipping is disabled.
+     */
+    void configure(ITensor *scratch_buffer, const ITensor *cell_state_in, const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                   ITensor *cell_state_out, ITensor *output_state_out, const ActivationLayerInfo &activation_info, float cell_threshold);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMCellKernel
+     *
+     * @param[in] scratch_buffer         Scratch buffer info holding the pre-activation gates. Data types supported: F16/F32.
+     * @param[in] cell_state_in          Cell state input info. Data type supported: Same as @p scratch_buffer.
+     * @param[in] cell_to_input_weights  Cell to input weights info. Can be nullptr. Data type supported: Same as @p scratch_buffer.
+     * @param[in] cell_to_forget_weights Cell to forget weights info. Can be nullptr. Data type supported: Same as @p scratch_buffer.
+     * @param[in] cell_to_output_weights Cell to output weights info. Can be nullptr. Data type supported: Same as @p scratch_buffer.
+     * @param[in] cell_state_out         Cell state output info. Data type supported: Same as @p scratch_buffer.
+     * @param[in] output_state_out       Output state output info. Data type supported: Same as @p scratch_buffer.
+     * @param[in] activation_info        Contains activation information described in @ref ActivationLayerInfo.
+     * @param[in] cell_threshold         The clipping threshold for the cell state. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *scratch_buffer, const ITensorInfo *cell_state_in, const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights,
+                           const ITensorInfo *cell_to_output_weights, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, const ActivationLayerInfo &activation_info,
+                           float cell_threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Function to run the LSTM cell
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_lstm_cell(const Window &window);
+
+    /** Common signature for all the specialised LSTM cell functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using LSTMCellFunction = void (NELSTMCellKernel::*)(const Window &window);
+
+    LSTMCellFunction    _func;
+    ITensor            *_scratch_buffer;
+    const ITensor      *_cell_state_in;
+    const ITensor      *_cell_to_input_weights;
+    const ITensor      *_cell_to_forget_weights;
+    const ITensor      *_cell_to_output_weights;
+    ITensor            *_cell_state_out;
+    ITensor            *_output_state_out;
+    ActivationLayerInfo _activation_info;
+    float               _cell_threshold;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NELSTMCELLKERNEL_H__ */
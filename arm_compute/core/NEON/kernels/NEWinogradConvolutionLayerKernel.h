@@ -29,12 +29,18 @@
 #include "arm_compute/core/NEON/kernels/convolution/common/tensor.hpp"
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_layer.hpp"
 
+#include <vector>
+
+namespace arm_gemm
+{
+class IGemmCommon;
+} // namespace arm_gemm
+
 namespace arm_compute
 {
 class ITensor;
 
 /** Interface for the NEON kernel to perform Winograd input transform. */
-template <typename T>
 class INEWinogradLayerTransformInputKernel : public INEKernel
 {
 public:
@@ -87,6 +93,19 @@ public:
     virtual void configure(const ITensor *input_nhwc, const int num_batches, const int num_rows, const int num_cols, const int num_channels,
                            const PaddingType padding, ITensor *output, const int matrix_stride, ITensor *workspace) = 0;
 
+    /** Transform a band of rows of tiles of one batch into a buffer holding the matrices of the band only.
+     *
+     * @note The input and the workspace must be allocated.
+     *
+     * @param[in]  batch          Batch containing the band.
+     * @param[in]  first_tile_row First row of tiles of the band.
+     * @param[in]  last_tile_row  Row of tiles following the band.
+     * @param[out] matrices       Base of the matrices of the band.
+     * @param[in]  matrix_stride  Stride (in elements) between the matrices of the band.
+     * @param[in]  info           Info about the executing thread.
+     */
+    virtual void run_tile_rows(int batch, int first_tile_row, int last_tile_row, void *matrices, int matrix_stride, const ThreadInfo &info) = 0;
+
     /** Destructor */
     virtual ~INEWinogradLayerTransformInputKernel()
     {
@@ -95,7 +114,7 @@ public:
 
 /** NEON kernel to perform Winograd input transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel<T>
+class NEWinogradLayerTransformInputKernel : public INEWinogradLayerTransformInputKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -159,7 +178,7 @@ public:
 
     /** Configure the output transform kernel.
      *
-     * @param[in]  input_nhwc    Input tensor.  Data types supported: F32. Layout supported NHWC.
+     * @param[in]  input_nhwc    Input tensor.  Data types supported: F16/F32. Layout supported NHWC.
      * @param[in]  num_batches   Number of batches in input tensor.
      * @param[in]  num_rows      Number of rows in input tensor.
      * @param[in]  num_cols      Number of columns in input tensor.
@@ -180,6 +199,8 @@ public:
         const int         matrix_stride,
         ITensor          *workspace) override;
 
+    void run_tile_rows(int batch, int first_tile_row, int last_tile_row, void *matrices, int matrix_stride, const ThreadInfo &info) override;
+
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
@@ -190,7 +211,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformInputKernel
      *
-     * @param[in] input         First tensor input info. Data types supported: F32.
+     * @param[in] input         First tensor input info. Data types supported: F16/F32.
      * @param[in] output        Output tensor info. Data types supported: same as @p input.
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
@@ -218,7 +239,6 @@ private:
 };
 
 /** Interface for the NEON kernel to perform Winograd output transform. */
-template <typename T>
 class INEWinogradLayerTransformOutputKernel : public INEKernel
 {
 public:
@@ -290,6 +310,19 @@ public:
         const int      num_channels,
         ITensor       *workspace) = 0;
 
+    /** Transform a band of rows of tiles of one batch from a buffer holding the matrices of the band only.
+     *
+     * @note The output, the biases and the workspace must be allocated.
+     *
+     * @param[in] batch          Batch containing the band.
+     * @param[in] first_tile_row First row of tiles of the band.
+     * @param[in] last_tile_row  Row of tiles following the band.
+     * @param[in] matrices       Base of the matrices of the band.
+     * @param[in] matrix_stride  Stride (in elements) between the matrices of the band.
+     * @param[in] info           Info about the executing thread.
+     */
+    virtual void run_tile_rows(int batch, int first_tile_row, int last_tile_row, const void *matrices, int matrix_stride, const ThreadInfo &info) = 0;
+
     virtual ~INEWinogradLayerTransformOutputKernel()
     {
     }
@@ -297,7 +330,7 @@ public:
 
 /** NEON kernel to perform Winograd output transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel<T>
+class NEWinogradLayerTransformOutputKernel : public INEWinogradLayerTransformOutputKernel
 {
 public:
     const char *name() const override
@@ -386,11 +419,13 @@ public:
         const int      num_channels,
         ITensor       *workspace) override;
 
+    void run_tile_rows(int batch, int first_tile_row, int last_tile_row, const void *matrices, int matrix_stride, const ThreadInfo &info) override;
+
     void run(const Window &window, const ThreadInfo &info) override;
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputKernel
      *
-     * @param[in] input         Source tensor info with shape [C, N, 16, batches] or [C, N, 36, batches]. Data types supported: F32.
+     * @param[in] input         Source tensor info with shape [C, N, 16, batches], [C, N, 36, batches] or [C, N, 64, batches]. Data types supported: F16/F32.
      * @param[in] bias          Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. It can be a nullptr. Data type supported: as @p input
      * @param[in] output        Destination tensor info with shape [output_convolved_dims.width, output_convolved_dims.height, C, batches]. Data type supported: same as @p input
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
@@ -417,8 +452,94 @@ private:
     int                              _num_channels;
 };
 
+/** NEON kernel to stream bands of rows of tiles through the Winograd input transform, the batched GEMM and the output transform.
+ *
+ * Each thread transforms a band of rows of tiles into its own buffers, multiplies them by the transformed weights and transforms
+ * the result back to the spatial domain before moving to its next band. The bands are sized to remain in the thread's L2 cache,
+ * so that the transformed input and output are never written to memory in full.
+ */
+class NEWinogradLayerStreamingKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEWinogradLayerStreamingKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerStreamingKernel(const NEWinogradLayerStreamingKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerStreamingKernel &operator=(const NEWinogradLayerStreamingKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerStreamingKernel(NEWinogradLayerStreamingKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerStreamingKernel &operator=(NEWinogradLayerStreamingKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerStreamingKernel() = default;
+
+    const char *name() const override
+    {
+        return "NEWinogradLayerStreamingKernel";
+    }
+
+    /** Compute the number of rows of tiles of a band fitting in a cache
+     *
+     * @param[in] num_tile_cols            Number of columns of tiles.
+     * @param[in] num_gemms                Number of matrices in the Winograd domain.
+     * @param[in] input_matrix_row_stride  Stride (in elements) between the rows of the transformed input matrices.
+     * @param[in] output_matrix_row_stride Stride (in elements) between the rows of the transformed output matrices.
+     * @param[in] element_size             Size in bytes of the data type.
+     * @param[in] cache_size               Size in bytes of the cache available to the band buffers of a thread.
+     *
+     * @return Number of rows of tiles per band, at least one.
+     */
+    static int get_band_rows(int num_tile_cols, int num_gemms, int input_matrix_row_stride, int output_matrix_row_stride, size_t element_size, size_t cache_size);
+
+    /** Initialise the kernel
+     *
+     * @param[in]  transform_input          Input transform kernel, configured for the whole input.
+     * @param[in]  transform_output         Output transform kernel, configured for the whole output.
+     * @param[in]  gemms                    One GEMM per thread, each multiplying the matrices of a band by the transformed weights.
+     *                                      The GEMMs of different threads must share the same configuration.
+     * @param[in]  weights                  Transformed weights, read by the GEMMs whose B matrix is not pretransposed.
+     * @param[out] workspace                Tensor to be used as the band buffers of the threads.
+     * @param[in]  num_batches              Number of batches.
+     * @param[in]  num_tile_rows            Number of rows of tiles in each batch.
+     * @param[in]  num_tile_cols            Number of columns of tiles.
+     * @param[in]  band_rows                Number of rows of tiles per band.
+     * @param[in]  num_gemms                Number of matrices in the Winograd domain.
+     * @param[in]  input_matrix_row_stride  Stride (in elements) between the rows of the transformed input matrices.
+     * @param[in]  output_matrix_row_stride Stride (in elements) between the rows of the transformed output matrices.
+     */
+    void configure(INEWinogradLayerTransformInputKernel *transform_input, INEWinogradLayerTransformOutputKernel *transform_output, std::vector<arm_gemm::IGemmCommon *> gemms,
+                   const ITensor *weights, ITensor *workspace, int num_batches, int num_tile_rows, int num_tile_cols, int band_rows, int num_gemms,
+                   int input_matrix_row_stride, int output_matrix_row_stride);
+
+    /** Get the size of the workspace
+     *
+     * @return Size in bytes of the band buffers of all the threads.
+     */
+    size_t get_workspace_size() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    INEWinogradLayerTransformInputKernel  *_transform_input;
+    INEWinogradLayerTransformOutputKernel *_transform_output;
+    std::vector<arm_gemm::IGemmCommon *>   _gemms;
+    const ITensor                         *_weights;
+    ITensor                               *_workspace;
+    int                                    _num_tile_rows;
+    int                                    _band_rows;
+    int                                    _num_bands;                /**< Number of bands in each batch. */
+    int                                    _input_matrix_row_stride;
+    int                                    _output_matrix_row_stride;
+    int                                    _input_matrix_stride;      /**< Stride between the transformed input matrices of a band. */
+    int                                    _output_matrix_stride;     /**< Stride between the transformed output matrices of a band. */
+    size_t                                 _input_storage_size;       /**< Size in bytes of the transformed input of a band. */
+    size_t                                 _output_storage_size;      /**< Size in bytes of the transformed output of a band. */
+    size_t                                 _thread_storage_size;      /**< Size in bytes of the buffers of a thread. */
+};
+
 /** Interface for the NEON kernel to perform Winograd weights transform. */
-template <typename T>
 class INEWinogradLayerTransformWeightsKernel : public INEKernel
 {
 public:
@@ -437,13 +558,13 @@ public:
     virtual ~INEWinogradLayerTransformWeightsKernel()
     {
     }
-    /** Determine how much memory (in units of T) to allocate for the
+    /** Determine how much memory (in units of the data type) to allocate for the
      * transformed weights.
      *
      * @param[in] num_output_channels Number of output feature maps.
      * @param[in] num_input_channels  Number of input feature maps.
      *
-     * @return Storage size (in units of T) required.
+     * @return Storage size (in units of the data type) required.
      */
     virtual unsigned int get_weight_storage_size(int num_output_channels, int num_input_channels) const = 0;
     /** Gets the stride between matrices in the kernel worspace
@@ -467,7 +588,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
-     * @param[in] input   First tensor input info. Data types supported: F32.
+     * @param[in] input   First tensor input info. Data types supported: F16/F32.
      * @param[in] weights Weights tensor info. Data types supported: same as @p input.
      *
      * @return a status
@@ -477,7 +598,7 @@ public:
 
 /** NEON kernel to perform Winograd weights transform. */
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
-class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel<T>
+class NEWinogradLayerTransformWeightsKernel final : public INEWinogradLayerTransformWeightsKernel
 {
 public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -501,8 +622,8 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformWeightsKernel
      *
      * @param[in] input         Source tensor info. The input is a 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM] (NCHW data layout).
-     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: F32.
-     * @param[in] output        Destination tensor info. The output is a 3D tensor with dimensions [OFM, IFM, 16] or [OFM, IFM, 36]. Data type supported: same as @p input
+     *                          kernel_x must be 3 and equal to kernel_y. Data types supported: F16/F32.
+     * @param[in] output        Destination tensor info. The output is a 3D tensor with dimensions [OFM, IFM, 16], [OFM, IFM, 36] or [OFM, IFM, 64]. Data type supported: same as @p input
      * @param[in] winograd_info Contains Winograd's information described in @ref WinogradInfo
      *
      * @return a status
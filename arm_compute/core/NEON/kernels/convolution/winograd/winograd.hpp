@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "arm.hpp"
 #include "convolution.hpp"
 #include "tensor.hpp"
 #include "utils.hpp"
@@ -108,6 +109,23 @@ class IInputTransform : public ITransform
      * @param matrix_row_stride Stride (in elements) between the rows within a single matrix.
      */
     virtual void set_output_matrices(void *matrices, int inter_matrix_stride, int matrix_row_stride) = 0;
+
+    /**
+     * Transform all the channels of a band of rows of tiles of one batch.
+     *
+     * The tiles of the band are written from the start of the given
+     * matrices, using the matrix row stride passed to set_output_matrices,
+     * so that a buffer sized for the band is sufficient.
+     *
+     * @param batch Batch containing the band.
+     * @param tile_row_start First row of tiles of the band.
+     * @param tile_row_stop Row of tiles following the band.
+     * @param matrices Pointer to the start of the first matrix of the band.
+     * @param inter_matrix_stride Stride (in elements) between the matrices of the band.
+     * @param threadid ID of the thread performing the transform.
+     */
+    virtual void run_tile_rows(unsigned int batch, unsigned int tile_row_start, unsigned int tile_row_stop,
+                               void *matrices, int inter_matrix_stride, unsigned int threadid=0) = 0;
 };
 
 class IOutputTransform : public ITransform
@@ -153,6 +171,22 @@ class IOutputTransform : public ITransform
      * @param col_stride Stride between columns of the tensor, measured in elements (not bytes).
      */
     virtual void set_output_tensor(void *output, int batch_stride, int row_stride, int col_stride) = 0;
+
+    /**
+     * Transform all the channels of a band of rows of tiles of one batch.
+     *
+     * The tiles of the band are read from the start of the given matrices,
+     * using the matrix row stride passed to set_input_matrices.
+     *
+     * @param batch Batch containing the band.
+     * @param tile_row_start First row of tiles of the band.
+     * @param tile_row_stop Row of tiles following the band.
+     * @param matrices Pointer to the start of the first matrix of the band.
+     * @param inter_matrix_stride Stride (in elements) between the matrices of the band.
+     * @param threadid ID of the thread performing the transform.
+     */
+    virtual void run_tile_rows(unsigned int batch, unsigned int tile_row_start, unsigned int tile_row_stop,
+                               const void *matrices, int inter_matrix_stride, unsigned int threadid=0) = 0;
 };
 
 class IWeightTransform : public ITransform
@@ -220,15 +254,31 @@ class InputTransform : public IInputTransform
     /** Perform work upon a window of the input. */
     void run(unsigned int start, unsigned int stop, unsigned int threadid=0) override;
 
+    /** Transform a band of rows of tiles into a buffer sized for the band. */
+    void run_tile_rows(unsigned int batch, unsigned int tile_row_start, unsigned int tile_row_stop,
+                       void *matrices, int inter_matrix_stride, unsigned int threadid=0) override;
+
   protected:
     const int _n_batches, _n_rows, _n_cols, _n_channels;
 
   private:
+    /** Transform a range of channels of one row of tiles. */
+    void transform_tile_row(
+      unsigned int threadid,
+      int batch,
+      int tile_i,
+      int start_channel,
+      int n_channels,
+      TOut *outptr_row,
+      int matrix_stride
+    );
+
     void transform_unpadded_tile(
       unsigned int threadid,
       int n_channels,
       TOut *outptr,
-      const TIn *inptr
+      const TIn *inptr,
+      int matrix_stride
     );
 
     void transform_padded_tile(
@@ -236,6 +286,7 @@ class InputTransform : public IInputTransform
       int n_channels,
       TOut *outptr,
       const TIn *inptr,
+      int matrix_stride,
       int padding_top,
       int padding_left,
       int padding_bottom,
@@ -337,6 +388,10 @@ class OutputTransform : public IOutputTransform
     /** Perform work upon a window of the input. */
     void run(unsigned int start, unsigned int stop, unsigned int threadid=0) override;
 
+    /** Transform a band of rows of tiles read from a buffer sized for the band. */
+    void run_tile_rows(unsigned int batch, unsigned int tile_row_start, unsigned int tile_row_stop,
+                       const void *matrices, int inter_matrix_stride, unsigned int threadid=0) override;
+
   protected:
     static constexpr int inner_tile_rows = InnerTileRows;
     static constexpr int inner_tile_cols = InnerTileCols;
@@ -346,11 +401,23 @@ class OutputTransform : public IOutputTransform
     const int _n_batches, _n_rows, _n_cols, _n_channels;
 
   private:
+    /** Transform a range of channels of one row of tiles. */
+    void transform_tile_row(
+      unsigned int threadid,
+      int batch,
+      int tile_i,
+      int start_channel,
+      int n_channels,
+      const TIn *matrix_tile_row,
+      int matrix_stride
+    );
+
     void transform_uncropped_tile(
       unsigned int threadid,
       int n_channels,
       TOut *outptr,
       const TIn *inptr,
+      int matrix_stride,
       const TOut *biases
     );
 
@@ -359,6 +426,7 @@ class OutputTransform : public IOutputTransform
       int n_channels,
       TOut *outptr,
       const TIn *inptr,
+      int matrix_stride,
       const TOut *biases,
       int pad_bottom,
       int pad_right
@@ -41,6 +41,16 @@ namespace fft
  * @return A vector with the stages of the decomposition. Will be empty if decomposition failed.
  */
 std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsigned int> &supported_factors);
+/** Decompose a given 1D input size using the provided supported factors, keeping the remaining prime factors as stages.
+ *
+ * @note Prime factors not in @p supported_factors are appended at the end of the decomposition, so they can be computed by a generic radix stage.
+ *
+ * @param[in] N                 Input size to be decomposed.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return A vector with the stages of the decomposition. Will be empty if decomposition failed.
+ */
+std::vector<unsigned int> decompose_stages_with_prime_factors(unsigned int N, const std::set<unsigned int> &supported_factors);
 /** Calculate digit reverse index vector given fft size and the decomposed stages
  *
  * @param N          Input size to calculate digit reverse for
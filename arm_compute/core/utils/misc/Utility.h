@@ -28,6 +28,7 @@
 #include <array>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <vector>
 
 namespace arm_compute
@@ -26,8 +26,12 @@
 
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/IScheduler.h"
 
+#include <future>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -72,6 +76,41 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Executes a graph asynchronously
+     *
+     * The graph is executed on a separate thread and its CPU kernels are run by a scheduler partition dedicated to the graph.
+     * If scheduler partitions are not supported in this build the execution is deferred to the first thread waiting on the returned future.
+     *
+     * @note Graphs executed concurrently must have been finalized with different graph contexts so that their transition memory is acquired independently.
+     * @note No graph must be finalized or invalidated while an asynchronous execution is in flight.
+     *
+     * @param[in] graph       Graph to execute
+     * @param[in] num_threads Number of threads of the scheduler partition running the graph.
+     *                        Capped to the number of threads of the scheduler when the graph was finalized, which sized the per-thread buffers of the functions.
+     *
+     * @return A future to wait for the end of the execution. Any error raised during the execution is rethrown by its get() method.
+     */
+    std::future<void> execute_graph_async(Graph &graph, unsigned int num_threads);
+    /** Executes several graphs concurrently
+     *
+     * The core budget is split evenly between the graphs, each graph being executed by its own scheduler partition (See @ref execute_graph_async).
+     * If scheduler partitions are not supported in this build the graphs are executed one after the other on the calling thread.
+     *
+     * @note An error is raised if a graph is not registered or if two graphs share the same graph context.
+     *
+     * @param[in] graphs      Graphs to execute. Each graph must have been finalized with its own graph context.
+     * @param[in] core_budget (Optional) Total number of threads to share between the graphs. If 0 the number of threads of the active scheduler is used.
+     */
+    void execute_graphs(const std::vector<Graph *> &graphs, unsigned int core_budget = 0);
+    /** Reports the memory used by a finalized graph
+     *
+     * @note The memory managers and weights managers are reported as a whole, so their memory is reported by all the graphs sharing a graph context.
+     *
+     * @param[in] graph Graph to report the memory of
+     *
+     * @return The memory used by the graph, broken down by node and category
+     */
+    MemoryReport memory_report(Graph &graph);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -79,7 +118,17 @@ public:
     void invalidate_graph(Graph &graph);
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    /** Returns the scheduler partition of a graph, creating it if needed
+     *
+     * @param[in] graph       Graph to get the scheduler partition for
+     * @param[in] num_threads Number of threads of the partition, capped to the number of threads the functions have been configured for
+     *
+     * @return The scheduler partition of the graph, or nullptr if partitions are not supported in this build.
+     */
+    IScheduler *scheduler_partition(const Graph &graph, unsigned int num_threads);
+
+    std::map<GraphID, ExecutionWorkload>            _workloads  = {}; /**< Graph workloads */
+    std::map<GraphID, std::unique_ptr<IScheduler>> _schedulers = {}; /**< Scheduler partitions of the graphs executed asynchronously */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -112,6 +112,15 @@ public:
      * @return Memory manager
      */
     virtual std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) = 0;
+    /** Returns the size of the pretransposed weights held by a function configured by the backend
+     *
+     * @note Pretransposed weights held by a weights manager are not accounted for.
+     *
+     * @param[in] func Function configured by the backend
+     *
+     * @return Size in bytes of the pretransposed weights held by the function
+     */
+    virtual size_t pretransposed_weights_size(arm_compute::IFunction &func) = 0;
 };
 } // namespace backends
 } // namespace graph
@@ -254,6 +254,29 @@ inline ::std::ostream &operator<<(::std::ostream &os, const DepthwiseConvolution
 
     return os;
 }
+
+/** Formatted output of the MemoryReport type. */
+inline ::std::ostream &operator<<(::std::ostream &os, const MemoryReport &report)
+{
+    for(const auto &node : report.nodes)
+    {
+        if(node.weights != 0 || node.pretransposed_weights != 0 || node.activations != 0)
+        {
+            os << node.type << " " << node.name << ": weights " << node.weights << " pretransposed weights " << node.pretransposed_weights
+               << " activations " << node.activations << " padding " << node.padding << std::endl;
+        }
+    }
+    os << "Weights: " << report.weights << std::endl;
+    os << "Transformed weights: " << report.transformed_weights << std::endl;
+    os << "Pretransposed weights: " << report.pretransposed_weights << std::endl;
+    os << "Activations: " << report.activations << std::endl;
+    os << "Transitions: " << report.transitions << std::endl;
+    os << "Scratch: " << report.scratch << std::endl;
+    os << "Padding: " << report.padding << std::endl;
+    os << "Total: " << report.total() << std::endl;
+
+    return os;
+}
 } // namespace graph
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_GRAPH_TYPE_PRINTER_H__ */
@@ -27,9 +27,11 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -76,12 +78,19 @@ class TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    CLTunerMode tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool         use_function_memory_manager{ true };     /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool         use_transition_memory_manager{ true };   /**< Use a memory manager to manager transition buffer memory */
+    bool         use_function_weights_manager{ false };   /**< Use a weights manager to share the transformed weights between functions, and between the graphs with the same weights cache directory (NEON backend only) */
+    bool         use_tuner{ false };                      /**< Use a tuner in tunable backends */
+    CLTunerMode  tuner_mode{ CLTunerMode::EXHAUSTIVE };   /**< Tuner mode to be used by the CL tuner */
+    int          num_threads{ -1 };                       /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string  tuner_file{ "acl_tuner.csv" };           /**< File to load/store tuning values from */
+    std::string  neon_tuner_file{ "acl_neon_tuner.csv" }; /**< File to load/store the convolution methods selected by the NEON tuner from */
+    std::string  weights_cache_dir{ "" };                 /**< Directory to load/store the prepared weights from (NEON backend only, requires use_function_weights_manager), if empty the weights are prepared on every start */
+    int          num_parallel_branches{ 1 };              /**< Maximum number of independent branches to execute concurrently (NEON backend only), if 1 the tasks are executed in topological order. Disables the transition memory manager when greater than 1. */
+    bool         use_pipelined_execution{ false };        /**< Overlap the input and output accessors of consecutive executions with the execution of the graph */
+    HugePageMode huge_page_mode{ HugePageMode::NONE };    /**< Huge page usage of the memory pools (NEON backend only), if not NONE the pools are memory mapped */
+    int          numa_node{ -1 };                         /**< NUMA node to bind the memory pools to (NEON backend only), if -1 the memory policy of the process is kept */
 };
 
 /**< Device target types */
@@ -189,6 +198,43 @@ struct NodeParams
     std::string name;   /**< Node name */
     Target      target; /**< Node target */
 };
+
+/** Memory used by the tensors of a node */
+struct NodeMemoryReport
+{
+    NodeID      id{ EmptyNodeID };          /**< Node ID */
+    std::string name{};                     /**< Node name */
+    NodeType    type{ NodeType::Dummy };    /**< Node type */
+    size_t      weights{ 0 };               /**< Size in bytes of the allocated constant tensors produced by the node */
+    size_t      pretransposed_weights{ 0 }; /**< Size in bytes of the pretransposed weights held by the function of the node */
+    size_t      activations{ 0 };           /**< Size in bytes of the other allocated output tensors of the node, before the transition memory manager shares their memory */
+    size_t      padding{ 0 };               /**< Padding in bytes included in the sizes of the output tensors */
+};
+
+/** Memory used by a finalized graph
+ *
+ * The graph level sizes add up to the memory held by the graph, the node level ones attribute the tensors to the nodes producing them.
+ */
+struct MemoryReport
+{
+    std::vector<NodeMemoryReport> nodes{};                    /**< Memory used by each node */
+    size_t                        weights{ 0 };               /**< Size in bytes of the allocated constant tensors */
+    size_t                        transformed_weights{ 0 };   /**< Size in bytes of the transformed weights held by the weights managers */
+    size_t                        pretransposed_weights{ 0 }; /**< Size in bytes of the pretransposed weights held by the functions themselves */
+    size_t                        activations{ 0 };           /**< Size in bytes of the activation tensors allocated individually */
+    size_t                        transitions{ 0 };           /**< Size in bytes of the pools of the cross-function memory managers, holding the transition buffers */
+    size_t                        scratch{ 0 };               /**< Size in bytes of the pools of the intra-function memory managers, holding the auxiliary memory of the functions */
+    size_t                        padding{ 0 };               /**< Padding in bytes included in the sizes of the allocated output tensors of the nodes */
+
+    /** Returns the total memory footprint of the graph
+     *
+     * @return Total size in bytes
+     */
+    size_t total() const
+    {
+        return weights + transformed_weights + pretransposed_weights + activations + transitions + scratch;
+    }
+};
 } // namespace graph
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_GRAPH_TYPES_H__ */
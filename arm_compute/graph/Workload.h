@@ -27,6 +27,7 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IScheduler.h"
 
 #include <functional>
 #include <memory>
@@ -94,14 +95,30 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Execution task graph
+ *
+ * Contains the dependencies between the tasks of a workload, used to execute independent branches concurrently
+ */
+struct ExecutionTaskGraph
+{
+    std::vector<std::vector<size_t>>         successors       = {}; /**< Indices of the tasks depending on each task */
+    std::vector<unsigned int>                num_predecessors = {}; /**< Number of tasks each task depends on */
+    std::vector<std::unique_ptr<IScheduler>> schedulers       = {}; /**< Scheduler partition of each branch worker */
+    std::unique_ptr<IScheduler>              dispatcher       = {}; /**< Scheduler whose persistent threads run the branch workers */
+};
+
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>       inputs                  = {};          /**< Input handles */
+    std::vector<Tensor *>       outputs                 = {};          /**< Output handles */
+    std::vector<ExecutionTask>  tasks                   = {};          /**< Execution workload */
+    ExecutionTaskGraph          task_graph              = {};          /**< Task dependencies (Empty if the tasks are executed in order) */
+    std::unique_ptr<IScheduler> accessors_dispatcher    = {};          /**< Scheduler whose persistent threads call the accessors of pipelined executions */
+    bool                        uses_transition_manager = { false };   /**< True if the transition tensors are managed by the transition memory manager */
+    unsigned int                num_threads             = { 0 };       /**< Number of threads of the scheduler the functions have been configured for */
+    Graph                      *graph                   = { nullptr }; /**< Graph bound to the workload */
+    GraphContext               *ctx                     = { nullptr }; /**< Graph execution context */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -52,6 +52,7 @@ public:
     std::unique_ptr<arm_compute::IFunction> configure_node(INode &node, GraphContext &ctx) override;
     Status validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
+    size_t pretransposed_weights_size(arm_compute::IFunction &func) override;
 
 private:
     bool              _initialized; /**< Flag that specifies if the backend has been default initialized */
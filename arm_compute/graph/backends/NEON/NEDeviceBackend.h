@@ -27,6 +27,14 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/MmapAllocator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionTuner.h"
+#include "arm_compute/runtime/WeightsManager.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
 
 namespace arm_compute
 {
@@ -39,6 +47,8 @@ class NEDeviceBackend final : public IDeviceBackend
 {
 public:
     NEDeviceBackend();
+    /** Destructor */
+    ~NEDeviceBackend();
 
     // Inherited overridden methods
     void initialize_backend() override;
@@ -51,9 +61,14 @@ public:
     std::unique_ptr<arm_compute::IFunction> configure_node(INode &node, GraphContext &ctx) override;
     Status validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
+    size_t pretransposed_weights_size(arm_compute::IFunction &func) override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator                                                              _allocator;        /**< NEON backend allocator */
+    std::map<std::pair<HugePageMode, int>, std::unique_ptr<MmapAllocator>> _mmap_allocators;  /**< Memory mapped allocators of the memory pools, one per (huge page mode, NUMA node) requested by a context */
+    std::map<std::string, std::weak_ptr<WeightsManager>>                   _weights_managers; /**< Weights managers shared by the contexts, one per weights cache directory */
+    NEConvolutionTuner                                                     _tuner;            /**< NEON convolution method tuner */
+    std::string                                                            _tuner_file;       /**< Filename to load/store the tuner's values from */
 };
 } // namespace backends
 } // namespace graph
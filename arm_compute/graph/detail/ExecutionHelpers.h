@@ -78,6 +78,14 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Builds the dependencies between the tasks of a workload so that independent branches can be executed concurrently
+ *
+ * @note The task graph is left empty if concurrent execution is not supported in this build.
+ *
+ * @param[in, out] workload     Workload to configure the task graph of
+ * @param[in]      num_branches Maximum number of branches to execute concurrently
+ */
+void configure_task_graph(ExecutionWorkload &workload, unsigned int num_branches);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -113,10 +121,24 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
 /** Executes all tasks of a workload
+ *
+ * @note If the workload has a task graph, independent tasks are executed concurrently, each branch worker using its own scheduler partition.
  *
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Executes a workload until its accessors request to stop, pipelining consecutive executions
+ *
+ * Inputs and outputs are double-buffered: while the tasks of execution N run, the input accessors
+ * of execution N+1 and the output accessors of execution N-1 are called on the persistent threads of the workload.
+ *
+ * @note Without the C++ scheduler the accessors are called in turn with the execution of the tasks.
+ * @note As the output accessors of an execution are called during the next one, one extra execution is
+ *       computed and discarded when an output accessor requests to stop.
+ *
+ * @param[in] workload Workload to execute
+ */
+void execute_workload_pipelined(ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
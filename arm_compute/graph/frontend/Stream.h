@@ -67,6 +67,11 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Reports the memory used by the finalized stream
+     *
+     * @return The memory used by the stream, broken down by node and category
+     */
+    MemoryReport memory_report();
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
@@ -55,6 +55,7 @@ public:
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType mapping_type() const override;
+    size_t      pool_size() const override;
 
 private:
     // Inherited methods overridden:
@@ -26,7 +26,10 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <chrono>
 #include <list>
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -34,6 +37,39 @@ namespace arm_compute
 class CPPScheduler : public IScheduler
 {
 public:
+    /** Strategies available to wake up the worker threads and wait for them to complete
+     *
+     * @note SPIN_THEN_PARK lowers the dispatch latency of small kernels run back to back but is only beneficial when every thread has a core of its own.
+     */
+    enum class WakeupMode
+    {
+        BLOCKING,       /**< Each worker blocks on its own condition variable between two workloads */
+        SPIN_THEN_PARK, /**< Workers spin on a shared epoch counter for a bounded time before parking, completion is signalled through a single barrier */
+    };
+    /** Policies available to bind the worker threads to CPU cores
+     *
+     * @note Only the worker threads of the pool are bound, the thread calling the scheduler is left untouched.
+     */
+    enum class AffinityPolicy
+    {
+        NONE,      /**< Let the operating system place and migrate the worker threads */
+        LINEAR,    /**< Pin worker N to core N */
+        BIG_CORES, /**< Pin the workers to the big cores of the system, as reported by @ref CPUInfo */
+        CUSTOM,    /**< Pin worker N to the N-th core of a list supplied by the user */
+    };
+    /** Methods available to estimate the relative throughput of the threads */
+    enum class WeightCalibration
+    {
+        CPU_MODEL, /**< Estimate the throughput from the @ref CPUModel of the core each thread runs on */
+        BENCHMARK, /**< Time a short arithmetic benchmark on each thread */
+    };
+    /** Constructor: create a pool of threads.
+     *
+     * @note Most users should use the singleton returned by @ref get(), additional instances are useful to run several workloads concurrently (See @ref Scheduler::set_thread_local).
+     */
+    CPPScheduler();
+    /** Default destructor */
+    ~CPPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the maximum number of threads supported by C++11 will be used, otherwise the number of threads specified.
@@ -44,6 +80,54 @@ public:
      * @return Number of threads available in CPPScheduler.
      */
     unsigned int num_threads() const override;
+    /** Sets the strategy used to hand work to the worker threads.
+     *
+     * @note The thread pool is re-created, therefore this must not be called while a kernel is running.
+     *
+     * @param[in] mode      Wake-up strategy to use.
+     * @param[in] spin_time (Optional) Maximum time a thread spins waiting for work or for completion before parking. Only used by @ref WakeupMode::SPIN_THEN_PARK.
+     */
+    void set_wakeup_mode(WakeupMode mode, std::chrono::microseconds spin_time = std::chrono::microseconds(50));
+    /** Returns the strategy used to hand work to the worker threads.
+     *
+     * @return The current wake-up mode.
+     */
+    WakeupMode wakeup_mode() const;
+    /** Sets the policy used to bind the worker threads to CPU cores.
+     *
+     * If there are more workers than cores the cores are reused in a round-robin fashion.
+     *
+     * @note The thread pool is re-created, therefore this must not be called while a kernel is running.
+     *
+     * @param[in] policy Affinity policy to use.
+     * @param[in] cores  (Optional) Ids of the cores to bind the workers to. Only used by @ref AffinityPolicy::CUSTOM.
+     */
+    void set_affinity_policy(AffinityPolicy policy, const std::vector<unsigned int> &cores = {});
+    /** Returns the policy used to bind the worker threads to CPU cores.
+     *
+     * @return The current affinity policy.
+     */
+    AffinityPolicy affinity_policy() const;
+    /** Sets the relative throughput of each thread.
+     *
+     * When set, the windows split using @ref StrategyHint::STATIC are divided proportionally to the weights so that all the threads complete at the same time.
+     * Weight N is used by worker N while the last weight is used by the thread calling the scheduler.
+     *
+     * @note The weights are reset when the thread pool is re-created. They are only meaningful when the workers are bound to cores (See @ref set_affinity_policy).
+     *
+     * @param[in] weights One positive weight per thread, or an empty vector to split the windows evenly.
+     */
+    void set_thread_weights(const std::vector<float> &weights);
+    /** Returns the relative throughput of each thread.
+     *
+     * @return The weight of each thread, or an empty vector if the windows are split evenly.
+     */
+    const std::vector<float> &thread_weights() const;
+    /** Estimate the relative throughput of each thread and use it to balance the static splits.
+     *
+     * @param[in] method Method used to estimate the throughput.
+     */
+    void calibrate_thread_weights(WeightCalibration method);
 
     /** Access the scheduler singleton
      *
@@ -70,11 +154,18 @@ protected:
 
 private:
     class Thread;
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
+    class SpinDispatcher;
+    /** (Re)create the pool of worker threads using the current number of threads, wake-up mode and affinity policy. */
+    void create_threads();
 
-    unsigned int      _num_threads;
-    std::list<Thread> _threads;
+    unsigned int                    _num_threads;
+    WakeupMode                      _wakeup_mode;
+    std::chrono::microseconds       _spin_time;
+    AffinityPolicy                  _affinity_policy;
+    std::vector<unsigned int>       _affinity_cores;
+    std::vector<float>              _thread_weights;
+    std::unique_ptr<SpinDispatcher> _dispatcher;
+    std::list<Thread>               _threads;
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 #define __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__
 
+#include <vector>
+
 namespace arm_compute
 {
 class CPUInfo;
@@ -40,5 +42,15 @@ void get_cpu_configuration(CPUInfo &cpuinfo);
  * @return The minumum number of common cores.
  */
 unsigned int get_threads_hint();
+/** Returns the ids of the big cores of the system.
+ *
+ * Cores detected as in-order cores (A53 / A55) are considered little, all the others are considered big.
+ * If all the cores of the system are little, all of them are returned.
+ *
+ * @param[in] cpuinfo @ref CPUInfo holding the system's cpu configuration.
+ *
+ * @return The ids of the big cores.
+ */
+std::vector<unsigned int> get_big_cores(const CPUInfo &cpuinfo);
 }
 #endif /* __ARM_COMPUTE_RUNTIME_CPU_UTILS_H__ */
@@ -78,6 +78,11 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Returns the size of the memory pools created by @ref create_pool
+     *
+     * @return Size in bytes of a memory pool fulfilling the requirements of the finalized groups
+     */
+    virtual size_t pool_size() const = 0;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_ILIFETIMEMANAGER_H__ */
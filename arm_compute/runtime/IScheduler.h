@@ -27,10 +27,12 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 
 #include <functional>
+#include <utility>
 
 namespace arm_compute
 {
 class ICPPKernel;
+class Window;
 
 /** Scheduler interface to run kernels */
 class IScheduler
@@ -49,13 +51,15 @@ public:
     class Hints
     {
     public:
+        /** Value of the secondary split dimension when the window must only be split along the split dimension */
+        static constexpr unsigned int no_split_dimension = ~0u;
         /** Constructor
          *
          * @param[in] split_dimension Dimension along which to split the kernel's execution window.
          * @param[in] strategy        (Optional) Split strategy.
          */
         Hints(unsigned int split_dimension, StrategyHint strategy = StrategyHint::STATIC)
-            : _split_dimension(split_dimension), _strategy(strategy)
+            : _split_dimension(split_dimension), _secondary_split_dimension(no_split_dimension), _strategy(strategy)
         {
         }
         /** Set the split_dimension hint
@@ -77,6 +81,30 @@ public:
         {
             return _split_dimension;
         }
+        /** Set the secondary split dimension hint
+         *
+         * When there are not enough iterations along the split dimension to keep all the threads busy,
+         * the scheduler also splits the kernel's execution window along this dimension.
+         *
+         * @note Only set it for kernels which can run on any sub-window along both dimensions.
+         *
+         * @param[in] secondary_split_dimension Second dimension along which to split the kernel's execution window, or @ref no_split_dimension.
+         *
+         * @return the Hints object
+         */
+        Hints &set_secondary_split_dimension(unsigned int secondary_split_dimension)
+        {
+            _secondary_split_dimension = secondary_split_dimension;
+            return *this;
+        }
+        /** Return the secondary split dimension
+         *
+         * @return The secondary split dimension or @ref no_split_dimension if the window must only be split along the split dimension.
+         */
+        unsigned int secondary_split_dimension() const
+        {
+            return _secondary_split_dimension;
+        }
 
         /** Set the strategy hint
          *
@@ -100,6 +128,7 @@ public:
 
     private:
         unsigned int _split_dimension;
+        unsigned int _secondary_split_dimension;
         StrategyHint _strategy;
     };
     /** Signature for the workloads to execute */
@@ -160,6 +189,37 @@ protected:
      * @param[in] workloads Array of workloads to run
      */
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
+    /** Return the number of iterations of a window along the split dimensions of the hints
+     *
+     * @param[in] window Window to split.
+     * @param[in] hints  Hints containing the split dimensions.
+     *
+     * @return The maximum number of sub-windows the window can be split into.
+     */
+    static unsigned int num_split_iterations(const Window &window, const Hints &hints);
+    /** Work out how many sub-windows to create along each of the split dimensions of the hints
+     *
+     * The window is only split along the secondary split dimension when there are fewer iterations than max_windows along the split dimension.
+     * In that case the grid minimising the size of the largest sub-window is selected.
+     *
+     * @param[in] window      Window to split.
+     * @param[in] hints       Hints containing the split dimensions.
+     * @param[in] max_windows Maximum number of sub-windows to create.
+     *
+     * @return The number of sub-windows along the split dimension and along the secondary split dimension.
+     */
+    static std::pair<unsigned int, unsigned int> split_grid(const Window &window, const Hints &hints, unsigned int max_windows);
+    /** Return one of the sub-windows of a grid returned by @ref split_grid
+     *
+     * @param[in] window Window to split.
+     * @param[in] hints  Hints containing the split dimensions.
+     * @param[in] grid   Number of sub-windows along the split dimension and along the secondary split dimension.
+     * @param[in] id     Id of the sub-window to return. Must be in the range [0, grid.first * grid.second).
+     *
+     * @return The sub-window "id" of the grid.
+     */
+    static Window split_window(const Window &window, const Hints &hints, const std::pair<unsigned int, unsigned int> &grid, unsigned int id);
+
     CPUInfo _cpu_info;
 
 private:
@@ -70,14 +70,16 @@ protected:
     struct Element
     {
         Element(void *id_ = nullptr, IMemory *handle_ = nullptr, size_t size_ = 0, size_t alignment_ = 0, bool status_ = false)
-            : id(id_), handle(handle_), size(size_), alignment(alignment_), status(status_)
+            : id(id_), handle(handle_), size(size_), alignment(alignment_), status(status_), lifetime_start(0), lifetime_end(0)
         {
         }
-        void    *id;        /**< Element id */
-        IMemory *handle;    /**< Element's memory handle */
-        size_t   size;      /**< Element's size */
-        size_t   alignment; /**< Alignment requirement */
-        bool     status;    /**< Lifetime status */
+        void    *id;             /**< Element id */
+        IMemory *handle;         /**< Element's memory handle */
+        size_t   size;           /**< Element's size */
+        size_t   alignment;      /**< Alignment requirement */
+        bool     status;         /**< Lifetime status */
+        size_t   lifetime_start; /**< Timestamp of the start of the element's lifetime */
+        size_t   lifetime_end;   /**< Timestamp of the end of the element's lifetime */
     };
 
     /** Blob struct */
@@ -90,6 +92,7 @@ protected:
     };
 
     IMemoryGroup *_active_group;                                           /**< Active group */
+    size_t        _timestamp;                                              /**< Timestamp of the next lifetime event of the active group */
     std::map<void *, Element> _active_elements;                            /**< A map that contains the active elements */
     std::list<Blob> _free_blobs;                                           /**< Free blobs */
     std::list<Blob> _occupied_blobs;                                       /**< Occupied blobs */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_ITRANSFORMWEIGHTS_H__
+#define __ARM_COMPUTE_ITRANSFORMWEIGHTS_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryRegion;
+class ITensor;
+class IWeightsManager;
+
+/** Weights tensor transform interface
+ *
+ * A weights transform converts a weights tensor into the layout expected by a function (e.g. a transposition or a reshape)
+ * and owns the resulting tensor. Transforms are registered with a @ref IWeightsManager which shares the memory of a single
+ * transformed tensor among all the transforms with the same @ref content_key.
+ *
+ * @note Two transforms producing the same output from the same weights must return the same @ref uid.
+ * @note A transform unregisters itself from its manager when destroyed.
+ */
+class ITransformWeights
+{
+public:
+    /** Default constructor */
+    ITransformWeights() = default;
+    /** Virtual destructor which unregisters the transform from its weights manager */
+    virtual ~ITransformWeights();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ITransformWeights(const ITransformWeights &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ITransformWeights &operator=(const ITransformWeights &) = delete;
+    /** Move constructor
+     *
+     * @note The registration with a weights manager is not transferred.
+     */
+    ITransformWeights(ITransformWeights &&other) noexcept;
+    /** Move assignment operator
+     *
+     * @note The registration with a weights manager is not transferred.
+     */
+    ITransformWeights &operator=(ITransformWeights &&other) noexcept;
+
+    /** Get a pointer to the transformed weights
+     *
+     * @return The pointer to the transformed weights tensor
+     */
+    virtual ITensor *get_weights() = 0;
+    /** Function that returns a unique id of the transform
+     *
+     * @return The unique id of the transform
+     */
+    virtual std::string uid() = 0;
+    /** Run the transformation function
+     *
+     * @note Implementations must set @ref _reshape_run once the transformed weights are available
+     */
+    virtual void run() = 0;
+    /** Release the transformed weights memory */
+    virtual void release() = 0;
+    /** Computes the key identifying the transformed weights by the content of the weights
+     *
+     * Transforms with the same key produce the same transformed weights and can therefore share their memory.
+     *
+     * @note Transforms reading other tensors than the weights (e.g. biases appended to the weights) must add them to the key.
+     *
+     * @param[in] weights Weights tensor to transform. Must be allocated.
+     *
+     * @return The key of the transformed weights
+     */
+    virtual std::string content_key(const ITensor &weights);
+    /** Imports the memory of the transformed weights from an equivalent transform instead of running the transform
+     *
+     * @param[in] memory Memory region holding the transformed weights, as returned by @ref shared_weights
+     */
+    void import_weights(const std::shared_ptr<IMemoryRegion> &memory);
+    /** Returns the memory region of the transformed weights to share with equivalent transforms
+     *
+     * @return The memory region of the transformed weights if allocated else nullptr
+     */
+    std::shared_ptr<IMemoryRegion> shared_weights();
+    /** Sets the weights manager the transform is registered with
+     *
+     * @note Used by the weights managers only.
+     *
+     * @param[in] weights_manager Weights manager to unregister from on destruction. Can be nullptr.
+     */
+    void set_weights_manager(IWeightsManager *weights_manager)
+    {
+        _weights_manager = weights_manager;
+    }
+    /** Checks if the transformation has been run
+     *
+     * @return True if the transformation has been run
+     */
+    bool is_reshape_run() const
+    {
+        return _reshape_run;
+    }
+    /** Increases the reference counter of the transformed weights */
+    void increase_refcount()
+    {
+        ++_num_refcount;
+    }
+    /** Decreases the reference counter of the transformed weights
+     *
+     * @return The reference counter after the decrement
+     */
+    int32_t decrease_refcount()
+    {
+        return --_num_refcount;
+    }
+
+protected:
+    int32_t _num_refcount{ 0 };    /**< Number of functions using the transformed weights */
+    bool    _reshape_run{ false }; /**< True if the transformation has been run */
+
+private:
+    IWeightsManager *_weights_manager{ nullptr }; /**< Weights manager the transform is registered with */
+};
+} // arm_compute
+#endif /*__ARM_COMPUTE_ITRANSFORMWEIGHTS_H__ */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_IWEIGHTSMANAGER_H__
+#define __ARM_COMPUTE_IWEIGHTSMANAGER_H__
+
+#include "arm_compute/runtime/ITransformWeights.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class WeightsCache;
+
+/** Weights manager interface to share the transformed weights among functions
+ *
+ * Functions first request the transformed weights with @ref acquire at configuration time and then
+ * ask the manager to @ref run the transform at preparation time. Transforms with the same
+ * @ref ITransformWeights::content_key share the memory of the transformed weights, so equivalent transforms of weights
+ * with the same content (e.g. several instances of the same model) are run only once.
+ *
+ * Transformed weights are themselves managed, so they can be transformed further (e.g. the transposed weights of a
+ * fully connected layer pretransposed by a GEMM). Once all the transforms of such an intermediate tensor have been run,
+ * the transform that produced it releases its memory.
+ */
+class IWeightsManager
+{
+public:
+    /** Default virtual destructor */
+    virtual ~IWeightsManager() = default;
+    /** Start managing a weights tensor
+     *
+     * @param[in] weights Weights tensor to manage
+     * @param[in] parent  (Optional) Transform which produced @p weights, if any
+     */
+    virtual void manage(const ITensor *weights, ITransformWeights *parent = nullptr) = 0;
+    /** Acquire the transformed weights
+     *
+     * Registers @p weights_transform, which stays owned by the function and unregisters itself when destroyed.
+     *
+     * @param[in] weights           Managed weights tensor
+     * @param[in] weights_transform Weights transform requested by the function
+     *
+     * @return The transformed weights tensor of @p weights_transform
+     */
+    virtual ITensor *acquire(const ITensor *weights, ITransformWeights *weights_transform) = 0;
+    /** Run the transform of the weights, if it hasn't been run yet
+     *
+     * If an equivalent transform of weights with the same content has already been run, the memory of its output is
+     * shared instead.
+     *
+     * @param[in] weights           Managed weights tensor
+     * @param[in] weights_transform Weights transform previously passed to @ref acquire
+     *
+     * @return The transformed weights tensor
+     */
+    virtual ITensor *run(const ITensor *weights, ITransformWeights *weights_transform) = 0;
+    /** Check if the weights are managed
+     *
+     * @param[in] weights Weights tensor
+     *
+     * @return True if the weights tensor is managed else false
+     */
+    virtual bool are_weights_managed(const ITensor *weights) = 0;
+    /** Stop using a weights transform
+     *
+     * @note Called by the destructor of the transforms.
+     *
+     * @param[in] weights_transform Weights transform to unregister
+     */
+    virtual void unregister_transform(ITransformWeights *weights_transform) = 0;
+    /** Returns the memory footprint of the transformed weights
+     *
+     * @return Total size in bytes of the distinct memory allocated for the transformed weights tensors
+     */
+    virtual size_t footprint() = 0;
+    /** Returns the persistent cache of transformed weights used by the functions sharing this manager
+     *
+     * @note Functions consult the cache even for the weights they transform without sharing them.
+     *
+     * @return The weights cache if any else nullptr
+     */
+    virtual WeightsCache *weights_cache() = 0;
+};
+} // arm_compute
+#endif /*__ARM_COMPUTE_IWEIGHTSMANAGER_H__ */
@@ -67,6 +67,12 @@ public:
     void set_region(IMemoryRegion *region) final;
     void set_owned_region(std::unique_ptr<IMemoryRegion> region) final;
 
+    /** Returns the region owned by this object
+     *
+     * @return The owned region if any else nullptr
+     */
+    std::shared_ptr<IMemoryRegion> owned_region() const;
+
 private:
     IMemoryRegion                 *_region;
     std::shared_ptr<IMemoryRegion> _region_owned;
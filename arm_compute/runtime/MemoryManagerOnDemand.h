@@ -49,6 +49,14 @@ public:
     /** Allow instances of this class to be moved */
     MemoryManagerOnDemand &operator=(MemoryManagerOnDemand &&) = default;
 
+    /** Returns the memory footprint of the manager
+     *
+     * @note The size of the pools is known once all the groups are finalized, see @ref ILifetimeManager::pool_size.
+     *
+     * @return Total size in bytes of the memory pools populated by @ref populate
+     */
+    size_t footprint() const;
+
     // Inherited methods overridden:
     ILifetimeManager *lifetime_manager() override;
     IPoolManager     *pool_manager() override;
@@ -30,6 +30,7 @@
 #include "support/ToolchainSupport.h"
 
 #include <cstddef>
+#include <memory>
 
 namespace arm_compute
 {
@@ -64,6 +65,15 @@ public:
             }
         }
     }
+    /** Constructor taking ownership of memory allocated by an allocator
+     *
+     * @param[in] mem  Backing memory, released through its deleter once the region is destroyed
+     * @param[in] size Region size
+     */
+    MemoryRegion(std::shared_ptr<uint8_t> mem, size_t size)
+        : IMemoryRegion(size), _mem(std::move(mem)), _ptr(_mem.get())
+    {
+    }
     MemoryRegion(void *ptr, size_t size)
         : IMemoryRegion(size), _mem(nullptr), _ptr(nullptr)
     {
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MMAPALLOCATOR_H__
+#define __ARM_COMPUTE_MMAPALLOCATOR_H__
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+/** Allocator backing the large allocations with anonymous memory mappings
+ *
+ * Allocations of at least @p mmap_threshold bytes are memory mapped, optionally using huge pages to reduce the TLB pressure of
+ * large buffers (memory pools, pretransposed weights) and bound to a NUMA node. Smaller allocations are served by the heap.
+ * All the returned pointers honour the requested alignment.
+ *
+ * @note Huge pages and NUMA binding are only available on Linux and are silently ignored where they are not supported.
+ */
+class MmapAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] huge_pages     (Optional) Huge page usage of the memory mapped allocations. Defaults to @ref HugePageMode::TRANSPARENT
+     * @param[in] numa_node      (Optional) NUMA node to bind the memory mapped allocations to. Defaults to -1 to keep the memory policy of the calling thread
+     * @param[in] mmap_threshold (Optional) Size in bytes from which the allocations are memory mapped. Defaults to 64KB
+     */
+    MmapAllocator(HugePageMode huge_pages = HugePageMode::TRANSPARENT, int numa_node = -1, size_t mmap_threshold = 64 * 1024);
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    MmapAllocator(const MmapAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a mutex) */
+    MmapAllocator &operator=(const MmapAllocator &) = delete;
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    /** Backing memory of an allocation */
+    struct Block
+    {
+        void  *base;      /**< Base address of the mapping or of the heap allocation */
+        size_t length;    /**< Length of the mapping */
+        bool   is_mapped; /**< True if the block is memory mapped, false if it was allocated on the heap */
+    };
+    /** Allocate a block
+     *
+     * @param[in]  size      Size in bytes to allocate
+     * @param[in]  alignment Alignment in bytes of the returned pointer
+     * @param[out] block     Backing memory of the allocation
+     *
+     * @return Pointer to the aligned memory, nullptr if the allocation failed
+     */
+    void *allocate_block(size_t size, size_t alignment, Block &block) const;
+    /** Release a block
+     *
+     * @param[in] block Block to release
+     */
+    static void release_block(const Block &block);
+
+    HugePageMode            _huge_pages;
+    int                     _numa_node;
+    size_t                  _mmap_threshold;
+    std::mutex              _mtx;
+    std::map<void *, Block> _blocks;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_MMAPALLOCATOR_H__ */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECONVOLUTIONTUNER_H__
+#define __ARM_COMPUTE_NECONVOLUTIONTUNER_H__
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Tuner selecting the fastest convolution method of @ref NEConvolutionLayer
+ *
+ * The methods supported by a convolution configuration are timed on the target CPU using the active scheduler,
+ * the fastest one being stored in a table that can be saved to a file and reused on later runs.
+ * The table can be accessed concurrently.
+ *
+ * @note The tuner is used by the layers configured after it has been registered with @ref NEConvolutionLayer::set_tuner:
+ *       new configurations are timed by @ref NEConvolutionLayer::configure, @ref NEConvolutionLayer::validate only looks them up.
+ */
+class NEConvolutionTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_configurations (Optional) Time the convolution methods of the configurations which are not present in the table?
+     * @param[in] num_iterations          (Optional) Number of timed runs of each convolution method. The fastest run is kept.
+     */
+    NEConvolutionTuner(bool tune_new_configurations = true, unsigned int num_iterations = 3);
+
+    /** Setter for tune_new_configurations option
+     *
+     * @param[in] tune_new_configurations Time the convolution methods of the configurations which are not present in the table?
+     */
+    void set_tune_new_configurations(bool tune_new_configurations);
+    /** Tune configurations that are not in the method table
+     *
+     * @return True if tuning of new configurations is enabled.
+     */
+    bool tune_new_configurations() const;
+
+    /** Looks up the convolution method to use for the given configuration in the table
+     *
+     * @note No convolution method is timed by this function, so it can be used while validating a configuration.
+     *
+     * @param[in]  input            Source tensor info. Data types supported: QASYMM8/F16/F32.
+     * @param[in]  weights          Weights tensor info. Data type supported: Same as @p input.
+     * @param[in]  output           Destination tensor info. Data types supported: Same as @p input.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation         Dilation, in elements, across x and y.
+     * @param[in]  act_info         Activation layer information in case of a fused activation.
+     * @param[in]  enable_fast_math Enable fast math computation.
+     * @param[out] method           The convolution method to use, if found.
+     *
+     * @return True if a convolution method was found for the configuration
+     */
+    bool find_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                 const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, ConvolutionMethod &method) const;
+    /** Times the supported convolution methods of a configuration which is not present in the table, and stores the fastest one
+     *
+     * @note Nothing is done if the configuration is already present in the table or if tuning of new configurations is disabled.
+     *
+     * @param[in] input            Source tensor info. Data types supported: QASYMM8/F16/F32.
+     * @param[in] weights          Weights tensor info. Data type supported: Same as @p input.
+     * @param[in] output           Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation         Dilation, in elements, across x and y.
+     * @param[in] act_info         Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math Enable fast math computation.
+     */
+    void tune_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                 const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math);
+
+    /** Manually add a convolution method for a configuration
+     *
+     * @param[in] config_id Unique identifier of the configuration
+     * @param[in] method    Convolution method to use for the given configuration
+     */
+    void add_method_to_table(const std::string &config_id, ConvolutionMethod method);
+    /** Give read access to the method table
+     *
+     * @return A copy of the method table as unordered_map container
+     */
+    std::unordered_map<std::string, ConvolutionMethod> method_table() const;
+
+    /** Load the method table from file
+     *
+     * @param[in] filename Load the method table from this file.(Must exist)
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the content of the method table to file
+     *
+     * @param[in] filename Save the method table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    /** Time the supported convolution methods of a configuration
+     *
+     * @param[in]  input            Source tensor info.
+     * @param[in]  weights          Weights tensor info.
+     * @param[in]  output           Destination tensor info.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation         Dilation, in elements, across x and y.
+     * @param[in]  act_info         Activation layer information in case of a fused activation.
+     * @param[in]  enable_fast_math Enable fast math computation.
+     * @param[out] method           The fastest convolution method.
+     *
+     * @return True if at least one convolution method supports the configuration
+     */
+    bool find_optimal_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                             const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, ConvolutionMethod &method);
+
+    std::unordered_map<std::string, ConvolutionMethod> _method_table;
+    mutable std::mutex _mtx;
+    bool               _tune_new_configurations;
+    unsigned int       _num_iterations;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NECONVOLUTIONTUNER_H__ */
@@ -27,7 +27,9 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/NEConvolutionTuner.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
@@ -47,8 +49,12 @@ class ITensor;
 class NEConvolutionLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager to use for the intermediate tensors.
+     * @param[in] weights_manager (Optional) Weights manager used to share the transformed weights among functions.
+     */
+    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Set the input and output tensors.
      *
@@ -68,6 +74,8 @@ public:
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
      * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     *
+     * @note If a tuner is set, the convolution methods of a configuration it has not tuned yet are timed here (See @ref NEConvolutionTuner::tune_convolution_method).
      */
     void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
                    const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false, unsigned int num_groups = 1);
@@ -111,16 +119,26 @@ public:
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
      *
+     * @note If a tuner is set, the method it selected for the configuration takes precedence over the built-in heuristics. The configuration is only tuned by @ref configure.
+     *
      * @return the Convolution Method Hint
      */
     static ConvolutionMethod get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
                                                     const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Set the tuner used to select the convolution method
+     *
+     * @note The tuner is not owned by this class and must outlive the configuration of the convolution layers.
+     *
+     * @param[in] tuner Tuner to use, or nullptr to use the built-in heuristics.
+     */
+    static void set_tuner(NEConvolutionTuner *tuner);
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
 
 private:
     std::shared_ptr<IMemoryManager> _memory_manager;
+    IWeightsManager                *_weights_manager;
     std::unique_ptr<IFunction>      _function; /**< Function to run */
 };
 }
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEDEPTHWISECONVOLUTION_H__
 
 #include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayer3x3Kernel.h"
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayerNativeKernel.h"
 #include "arm_compute/core/NEON/kernels/NEDepthwiseIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NEDepthwiseVectorToTensorKernel.h"
 #include "arm_compute/core/NEON/kernels/NEDepthwiseWeightsReshapeKernel.h"
@@ -159,6 +160,10 @@ private:
 
 /** Basic function to execute a generic depthwise convolution. This function calls the following NEON kernels:
  *
+ * If the data layout is NHWC and the data type is F16/F32:
+ * -# @ref NEDepthwiseConvolutionLayerNativeKernel
+ *
+ * otherwise:
  * -# @ref NEDepthwiseIm2ColKernel
  * -# @ref NEDepthwiseWeightsReshapeKernel
  * -# @ref NEGEMMMatrixVectorMultiplyKernel
@@ -215,6 +220,35 @@ public:
     void prepare() override;
 
 private:
+    /** Configure the kernels running the depthwise convolution directly on NHWC tensors
+     *
+     * @param[in]  input            Source tensor. Data type supported: F16/F32. Data layout supported: NHWC.
+     * @param[in]  weights          Weights tensor. These are 3D tensors with shape [IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
+     * @param[out] output           Destination tensor. Data type supported: same as @p input.
+     * @param[in]  conv_info        Padding and stride information to use for the convolution.
+     * @param[in]  depth_multiplier Multiplier to apply to the input's depth in order to retrieve the output's depth.
+     * @param[in]  act_info         Activation layer information in case of a fused activation.
+     * @param[in]  dilation         Dilation, in elements, across x and y.
+     */
+    void configure_native(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                          unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation);
+    /** Configure the kernels running the depthwise convolution as a matrix-vector multiplication
+     *
+     * @param[in, out] input            Source tensor. Data type supported: QASYMM8/F16/F32. (Written to only for border filling).
+     * @param[in]      weights          Weights tensor. These are 3D tensors with shape [kernel_x, kernel_y, IFM]. Data type supported: Same as @p input.
+     * @param[in]      biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
+     *                                  Data type supported: Same as @p input, S32 when input is QASYMM8.
+     * @param[out]     output           Destination tensor. Data type supported: same as @p input.
+     * @param[in]      conv_info        Padding and stride information to use for the convolution.
+     * @param[in]      depth_multiplier Multiplier to apply to the input's depth in order to retrieve the output's depth.
+     * @param[in]      act_info         Activation layer information in case of a fused activation.
+     * @param[in]      dilation         Dilation, in elements, across x and y.
+     */
+    void configure_generic(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                           unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation);
+
+    NEDepthwiseConvolutionLayerNativeKernel   _native_kernel;
     NEDepthwiseIm2ColKernel                   _im2col_kernel;
     NEDepthwiseWeightsReshapeKernel           _weights_reshape_kernel;
     NEGEMMMatrixVectorMultiplyKernel          _v2mm_kernel;
@@ -236,6 +270,7 @@ private:
     bool                                      _is_prepared;
     bool                                      _is_quantized;
     bool                                      _is_nhwc;
+    bool                                      _is_native;
     bool                                      _is_activationlayer_enabled;
     const ITensor                            *_original_weights;
 };
@@ -32,6 +32,7 @@
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMDirectConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
@@ -45,6 +46,8 @@ namespace arm_compute
  * -# @ref NEFillBorderKernel for the input
  * -# @ref NEDirectConvolutionLayerOutputStageKernel
  * -# @ref NEDirectConvolutionLayerKernel
+ *
+ * NHWC F16/F32 convolutions are run by @ref NEGEMMDirectConvolutionLayer when its requirements are met.
  */
 class NEDirectConvolutionLayer : public IFunction
 {
@@ -57,6 +60,7 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    Any kernel size and stride with data layout = NHWC and data type = F16/F32, if the IFM dimension of @p input is not padded
      *
      * @param[in, out] input     Input tensor. Data types supported: F16/F32.
      * @param[in]      weights   Set of kernels to convolve the input volume.
@@ -76,6 +80,7 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    Any kernel size and stride with data layout = NHWC and data type = F16/F32, if the IFM dimension of @p input is not padded
      *
      * @param[in] input     Input tensor. Data types supported: F16/F32.
      * @param[in] weights   Set of kernels to convolve the input volume.
@@ -95,6 +100,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     MemoryGroup                               _memory_group;
@@ -102,9 +108,11 @@ private:
     NEDirectConvolutionLayerKernel            _conv_kernel;
     NEFillBorderKernel                        _input_border_handler;
     NEActivationLayer                         _activationlayer_function;
+    NEGEMMDirectConvolutionLayer              _gemm_direct_function;
     Tensor                                    _accumulator;
     bool                                      _has_bias;
     bool                                      _is_activationlayer_enabled;
+    bool                                      _use_gemm_direct;
     unsigned int                              _dim_split;
 };
 }
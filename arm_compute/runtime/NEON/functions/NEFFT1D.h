@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/NEON/kernels/NEFFTDigitReverseKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFFTRadixStageKernel.h"
+#include "arm_compute/core/NEON/kernels/NEFFTRealSplitKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 
@@ -40,9 +41,14 @@ class ITensor;
 
 /** Basic function to execute one dimensional FFT. This function calls the following NEON kernels:
  *
+ * -# @ref NEFFTRealSplitKernel    Merges the half spectrum of a real sequence in case of an inverse half spectrum FFT
  * -# @ref NEFFTDigitReverseKernel Performs digit reverse
  * -# @ref NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
+ * -# @ref NEFFTRealSplitKernel    Splits the half spectrum of a real sequence in case of a forward half spectrum FFT
  * -# @ref NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ *
+ * @note Real sequences of even length N along the X axis can be transformed to and from their half spectrum of N/2 + 1 bins by
+ *       configuring the complex tensor with that width. The transform then runs a complex FFT of length N/2.
  */
 class NEFFT1D : public IFunction
 {
@@ -54,6 +60,7 @@ public:
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor.  Data types and data layouts supported: Same as @p input.
      *                    Number of channels supported: 1 (real tensor) or 2 (complex tensor).If @p input is real, @p output must be complex.
+     *                    Must be configured if a half spectrum transform is requested.
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT1DInfo &config);
@@ -75,11 +82,15 @@ protected:
     NEFFTDigitReverseKernel            _digit_reverse_kernel;
     std::vector<NEFFTRadixStageKernel> _fft_kernels;
     NEFFTScaleKernel                   _scale_kernel;
+    NEFFTRealSplitKernel               _real_split_kernel;
     Tensor                             _digit_reversed_input;
     Tensor                             _digit_reverse_indices;
+    Tensor                             _real_merged_input;
     unsigned int                       _num_ffts;
     unsigned int                       _axis;
     bool                               _run_scale;
+    bool                               _run_real_split;
+    bool                               _run_real_merge;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEFFT1D_H__ */
@@ -40,6 +40,9 @@ class ITensor;
  *
  * -# @ref NEFFT1D 1D FFT is performed on the first given axis
  * -# @ref NEFFT1D 1D FFT is performed on the second given axis
+ *
+ * @note A real tensor of even width N is transformed to and from its half spectrum if the complex tensor has a width of N/2 + 1.
+ *       The Y axis is then transformed first when going back to the real tensor.
  */
 class NEFFT2D : public IFunction
 {
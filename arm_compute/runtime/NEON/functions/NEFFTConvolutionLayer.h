@@ -27,6 +27,8 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
 #include "arm_compute/runtime/NEON/functions/NEFFT2D.h"
@@ -37,17 +39,62 @@
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEReverse.h"
 #include "arm_compute/runtime/NEON/functions/NESlice.h"
+#include "support/ToolchainSupport.h"
 
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
 
+/** Weights transform computing the frequency domain weights of @ref NEFFTConvolutionLayer, used to share them through a @ref IWeightsManager
+ *
+ * The weights are permuted to NCHW if needed, flipped, padded to the FFT size and transformed to their half spectrum.
+ */
+class NEFFTConvolutionLayerWeightsTransform : public ITransformWeights
+{
+public:
+    /** Configures the weights transform
+     *
+     * @param[in] weights  Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: F32.
+     * @param[in] fft_size Width and height of the transform. The width must be even.
+     */
+    void configure(const ITensor *weights, const Size2D &fft_size);
+
+    // Inherited methods overridden:
+    void run() override;
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+    std::string uid() override
+    {
+        return "NEFFTConvolutionLayerWeights_" + support::cpp11::to_string(_fft_size.x()) + "x" + support::cpp11::to_string(_fft_size.y());
+    }
+
+private:
+    const ITensor           *_weights{ nullptr };
+    Size2D                   _fft_size{};
+    bool                     _needs_permute{ false };
+    NEPermute                _permute_func{};
+    NEReverse                _flip_func{};
+    NEPadLayer               _pad_func{};
+    std::unique_ptr<NEFFT2D> _transform_func{ nullptr };
+    Tensor                   _permuted{};
+    Tensor                   _flip_axis{};
+    Tensor                   _flipped{};
+    Tensor                   _padded{};
+    Tensor                   _output{};
+};
+
 /** Basic function to execute FFT-based convolution on NEON. This function calls the following NEON functions/kernels:
  *
  *  -# @ref NEPermute                        Permute input if NHWC(only NCHW is supported).
  *  -# @ref NEPadLayer                       Pad input.
- *  -# @ref NEFFT2D                          Forward transform to the frequency domain.
+ *  -# @ref NEFFT2D                          Forward transform to the half spectrum of the input.
  *  -# @ref NEComplexPixelWiseMultiplication Complex element-wise product of input and the weights.
  *  -# @ref NEReductionOperation             Reduction across channels.
  *  -# @ref NEFFT2D                          Inverse transform back to the time domain.
@@ -55,12 +102,18 @@ class ITensor;
  *  -# @ref NEArithmeticAddition             Add bias.
  *  -# @ref NEActivationLayer                Perform activation.
  *  -# @ref NEPermute                        Permute output if NHWC(only NCHW is supported).
+ *
+ * The weights are transformed once by @ref NEFFTConvolutionLayerWeightsTransform when the function is prepared.
  */
 class NEFFTConvolutionLayer : public IFunction
 {
 public:
-    /** Default constructor */
-    NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Default constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager.
+     * @param[in] weights_manager (Optional) Weights manager used to share the frequency domain weights among functions.
+     */
+    NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEFFTConvolutionLayer(const NEFFTConvolutionLayer &) = delete;
     /** Default move constructor */
@@ -109,33 +162,26 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                      _memory_group;
-    NEReverse                        _flip_weights_func;
-    NEPermute                        _permute_input_func;
-    NEPermute                        _permute_output_func;
-    NEPermute                        _permute_weights_func;
-    NEPermute                        _permute_bias_func;
-    NEPadLayer                       _pad_input_func;
-    NEPadLayer                       _pad_weights_func;
-    NEFFT2D                          _transform_input_func;
-    std::unique_ptr<NEFFT2D>         _transform_weights_func;
-    NEFFT2D                          _itransform_output_func;
-    NEComplexPixelWiseMultiplication _prod_func;
-    NEReductionOperation             _reduce_func;
-    NESlice                          _extract_output_func;
-    NEArithmeticAddition             _bias_add_func;
-    NEActivationLayer                _activation_layer_func;
+    MemoryGroup                           _memory_group;
+    IWeightsManager                      *_weights_manager;
+    NEFFTConvolutionLayerWeightsTransform _weights_transform;
+    NEPermute                             _permute_input_func;
+    NEPermute                             _permute_output_func;
+    NEPermute                             _permute_bias_func;
+    NEPadLayer                            _pad_input_func;
+    NEFFT2D                               _transform_input_func;
+    NEFFT2D                               _itransform_output_func;
+    NEComplexPixelWiseMultiplication      _prod_func;
+    NEReductionOperation                  _reduce_func;
+    NESlice                               _extract_output_func;
+    NEArithmeticAddition                  _bias_add_func;
+    NEActivationLayer                     _activation_layer_func;
 
     Tensor _permuted_input;
-    Tensor _permuted_weights;
     Tensor _permuted_bias;
     Tensor _permuted_output;
     Tensor _padded_input;
-    Tensor _padded_weights;
-    Tensor _flip_axis;
-    Tensor _flipped_weights;
     Tensor _transformed_input;
-    Tensor _transformed_weights;
     Tensor _input_weights_product;
     Tensor _output_product;
     Tensor _output_reduced;
@@ -145,9 +191,11 @@ private:
 
     const ITensor *_original_weights;
     const ITensor *_original_bias;
+    ITensor       *_transformed_weights;
     bool           _is_activationlayer_enabled;
     bool           _needs_permute;
     bool           _has_bias;
+    bool           _is_weights_managed;
     bool           _is_prepared;
 };
 } // namespace arm_compute
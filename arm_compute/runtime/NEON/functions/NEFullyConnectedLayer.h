@@ -29,6 +29,7 @@
 #include "arm_compute/core/NEON/kernels/NEFlattenLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixAccumulateBiasesKernel.h"
 #include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEConvertFullyConnectedWeights.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
@@ -63,6 +64,44 @@ public:
     static Status validate(const ITensorInfo *input, const ITensorInfo *output);
 };
 
+/** Weights transform running @ref NEFullyConnectedLayerReshapeWeights, used to share the transposed weights through a @ref IWeightsManager */
+class NEFullyConnectedLayerReshapeWeightsManaged : public ITransformWeights
+{
+public:
+    /** Configures the @ref NEFullyConnectedLayerReshapeWeights function
+     *
+     * @param[in] input Source tensor. Data type supported: QASYMM8/F16/F32.
+     */
+    void configure(const ITensor *input)
+    {
+        _func.configure(input, &_output);
+    }
+
+    // Inherited methods overridden:
+    void run() override
+    {
+        _output.allocator()->allocate();
+        _func.run();
+        _reshape_run = true;
+    }
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+    std::string uid() override
+    {
+        return "NEFullyConnectedLayerReshapeWeights";
+    }
+
+private:
+    Tensor                              _output{};
+    NEFullyConnectedLayerReshapeWeights _func{};
+};
+
 /** Basic function to compute a Fully Connected layer on NEON. This function calls the following NEON kernels:
  *  -# @ref NEIm2ColKernel (called when the input comes from a convolutional layer)
  *  -# @ref NEFullyConnectedLayerReshapeWeights (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
@@ -74,8 +113,12 @@ public:
 class NEFullyConnectedLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager to use for the intermediate tensors.
+     * @param[in] weights_manager (Optional) Weights manager used to share the reshaped weights among functions.
+     */
+    NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEFullyConnectedLayer(const NEFullyConnectedLayer &) = delete;
     /** Default move constructor */
@@ -118,6 +161,13 @@ public:
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
                            FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
+    /** Size of the pretransposed weights held by the function
+     *
+     * @note The pretransposed weights shared through a weights manager are held by the weights manager and not accounted for.
+     *
+     * @return Size in bytes of the pretransposed weights allocated by the function, 0 if the weights are not pretransposed or not yet prepared
+     */
+    size_t pretransposed_weights_size() const;
 
     //Inherited methods override
     void run() override;
@@ -129,9 +179,11 @@ private:
     void configure_mm(const ITensor *input, const ITensor *weights, ITensor *output);
 
     MemoryGroup                                         _memory_group;
+    IWeightsManager                                    *_weights_manager;
     NEFlattenLayerKernel                                _flatten_kernel;
     NEConvertFullyConnectedWeights                      _convert_weights;
     NEFullyConnectedLayerReshapeWeights                 _reshape_weights_function;
+    NEFullyConnectedLayerReshapeWeightsManaged          _reshape_weights_managed_function;
     NEGEMM                                              _mm_gemm;
     NEGEMMLowpMatrixMultiplyCore                        _mm_gemmlowp;
     NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _gemmlowp_output_stage;
@@ -143,6 +195,7 @@ private:
     const ITensor                                      *_original_weights;
     bool                                                _are_weights_converted;
     bool                                                _are_weights_reshaped;
+    bool                                                _is_reshape_managed;
     bool                                                _is_fc_after_conv;
     bool                                                _accumulate_biases;
     bool                                                _is_quantized;
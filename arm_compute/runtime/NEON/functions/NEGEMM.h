@@ -31,6 +31,7 @@
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/Tensor.h"
@@ -50,8 +51,12 @@ namespace arm_compute
 class NEGEMM : public IFunction
 {
 public:
-    /** Constructor */
-    NEGEMM(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager to use for the intermediate tensors.
+     * @param[in] weights_manager (Optional) Weights manager used to share the reshaped B matrix among functions.
+     */
+    NEGEMM(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEGEMM(const NEGEMM &) = delete;
     /** Default move constructor */
@@ -89,6 +94,13 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *output, float alpha, float beta, const GEMMInfo &gemm_info = GEMMInfo());
+    /** Size of the pretransposed weights held by the function
+     *
+     * @note The pretransposed weights shared through a weights manager are held by the weights manager and not accounted for.
+     *
+     * @return Size in bytes of the pretransposed weights allocated by the function, 0 if the weights are not pretransposed or not yet prepared
+     */
+    size_t pretransposed_weights_size() const;
 
     // Inherited methods overridden:
     void run() override;
@@ -104,6 +116,7 @@ private:
     Tensor                     _tmp_a;
     Tensor                     _tmp_b;
     const ITensor             *_original_b;
+    IWeightsManager           *_weights_manager;
     bool                       _run_vector_matrix_multiplication;
     bool                       _run_addition;
     bool                       _reshape_b_only_on_first_run;
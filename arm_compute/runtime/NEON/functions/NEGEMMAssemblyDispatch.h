@@ -27,6 +27,7 @@
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -38,8 +39,12 @@ namespace arm_compute
 class NEGEMMAssemblyDispatch : public IFunction
 {
 public:
-    /** Default constructor */
-    NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Default constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager to use for the intermediate tensors.
+     * @param[in] weights_manager (Optional) Weights manager used to share the pretransposed B matrix among functions.
+     */
+    NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Prevent instances of this class from being copy constructed */
     NEGEMMAssemblyDispatch(const NEGEMMAssemblyDispatch &) = delete;
@@ -52,10 +57,11 @@ public:
     class IFallback
     {
     public:
-        virtual void run()                 = 0;
-        virtual void prepare()             = 0;
-        virtual bool is_configured() const = 0;
-        virtual ~IFallback()               = default;
+        virtual void   run()                              = 0;
+        virtual void   prepare()                          = 0;
+        virtual bool   is_configured() const              = 0;
+        virtual size_t pretransposed_weights_size() const = 0;
+        virtual ~IFallback()                              = default;
     };
 
 private:
@@ -80,6 +86,7 @@ private:
     std::unique_ptr<IFallback>      _arm_gemm;
     MemoryGroup                     _memory_group;   /**< Function memory group */
     std::shared_ptr<IMemoryManager> _memory_manager; /**< Copy of the memory manager used to create the memory group to be used when instantiating new functions */
+    IWeightsManager                *_weights_manager; /**< Weights manager used to share the pretransposed B matrix */
 public:
     /** If supported create an ACL function else fallback to the arm_gemm function.
      *
@@ -109,6 +116,13 @@ public:
      * @return True if the function is configured and ready to run
      */
     bool is_configured() const;
+    /** Size of the pretransposed B matrix held by the function
+     *
+     * @note The pretransposed B matrix shared through a weights manager is held by the weights manager and not accounted for.
+     *
+     * @return Size in bytes of the pretransposed B matrix allocated by the function, 0 if B is not pretransposed or not yet prepared
+     */
+    size_t pretransposed_weights_size() const;
     // Inherited methods overridden:
     /** Runs a preparation step, usually for pre-transposing matrix b */
     void prepare() override;
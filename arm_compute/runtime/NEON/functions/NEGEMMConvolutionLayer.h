@@ -32,6 +32,8 @@
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NEWeightsReshapeKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
@@ -78,6 +80,48 @@ private:
     NEWeightsReshapeKernel _weights_reshape_kernel;
 };
 
+/** Weights transform running @ref NEConvolutionLayerReshapeWeights, used to share the reshaped weights through a @ref IWeightsManager */
+class NEConvolutionLayerReshapeWeightsTransform : public ITransformWeights
+{
+public:
+    /** Configures the @ref NEConvolutionLayerReshapeWeights function
+     *
+     * @param[in] input  Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
+     * @param[in] biases Biases tensor to append to the reshaped weights. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] cache  (Optional) Cache to load the reshaped weights from or store them to. Can be nullptr.
+     */
+    void configure(const ITensor *input, const ITensor *biases, WeightsCache *cache = nullptr)
+    {
+        _input  = input;
+        _biases = biases;
+        _cache  = cache;
+        _func.configure(input, biases, &_output);
+    }
+
+    // Inherited methods overridden:
+    void run() override;
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+    std::string uid() override
+    {
+        return (_biases != nullptr) ? "NEConvolutionLayerReshapeWeights_biases" : "NEConvolutionLayerReshapeWeights";
+    }
+    std::string content_key(const ITensor &weights) override;
+
+private:
+    const ITensor                   *_input{ nullptr };
+    const ITensor                   *_biases{ nullptr };
+    WeightsCache                    *_cache{ nullptr };
+    Tensor                           _output{};
+    NEConvolutionLayerReshapeWeights _func{};
+};
+
 /** Basic function to compute the convolution layer. This function calls the following NEON kernels/functions:
  *
  * -# @ref NEIm2ColKernel
@@ -91,8 +135,12 @@ private:
 class NEGEMMConvolutionLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager to use for the intermediate tensors.
+     * @param[in] weights_manager (Optional) Weights manager used to share the reshaped weights among functions.
+     */
+    NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEGEMMConvolutionLayer(const NEGEMMConvolutionLayer &) = delete;
     /** Default move constructor */
@@ -141,6 +189,13 @@ public:
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
                            const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1);
+    /** Size of the pretransposed weights held by the function
+     *
+     * @note The pretransposed weights shared through a weights manager are held by the weights manager and not accounted for.
+     *
+     * @return Size in bytes of the pretransposed weights allocated by the function, 0 if the weights are not pretransposed or not yet prepared
+     */
+    size_t pretransposed_weights_size() const;
 
     // Inherited methods overridden:
     void run() override;
@@ -187,17 +242,20 @@ private:
     static Status validate_gemm3d(const ITensorInfo *input_info, const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col);
 
 private:
-    MemoryGroup                      _memory_group;
-    NEConvolutionLayerReshapeWeights _reshape_weights;
-    NEIm2ColKernel                   _im2col_kernel;
-    NEGEMM                           _mm_gemm;
-    NEGEMMLowpMatrixMultiplyCore     _mm_gemmlowp;
-    NECol2ImKernel                   _col2im_kernel;
-    NEActivationLayer                _activationlayer_function;
-    NEArithmeticAdditionKernel       _add_bias_kernel;
-    NEReshapeLayer                   _reshape_layer;
+    MemoryGroup                               _memory_group;
+    IWeightsManager                          *_weights_manager;
+    NEConvolutionLayerReshapeWeights          _reshape_weights;
+    NEConvolutionLayerReshapeWeightsTransform _reshape_weights_managed;
+    NEIm2ColKernel                            _im2col_kernel;
+    NEGEMM                                    _mm_gemm;
+    NEGEMMLowpMatrixMultiplyCore              _mm_gemmlowp;
+    NECol2ImKernel                            _col2im_kernel;
+    NEActivationLayer                         _activationlayer_function;
+    NEArithmeticAdditionKernel                _add_bias_kernel;
+    NEReshapeLayer                            _reshape_layer;
 
     const ITensor *_original_weights;
+    const ITensor *_appended_biases;
 
     Tensor _im2col_output;
     Tensor _weights_reshaped;
@@ -211,6 +269,7 @@ private:
     bool _skip_col2im;
     bool _is_quantized;
     bool _is_activationlayer_enabled;
+    bool _is_reshape_managed;
     bool _is_prepared;
 };
 } // namespace arm_compute
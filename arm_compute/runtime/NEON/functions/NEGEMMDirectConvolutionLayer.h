@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMDIRECTCONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_NEGEMMDIRECTCONVOLUTIONLAYER_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerOutputStageKernel.h"
+#include "arm_compute/core/NEON/kernels/NEMemsetKernel.h"
+#include "arm_compute/core/NEON/kernels/assembly/gemm_common.hpp"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run a NHWC convolution without im2col.
+ *
+ * The convolution is split in GEMMs which read the input rows in place: for each kernel row, the kernel_width * IFM
+ * consecutive values under an output pixel form one row of the left-hand side matrix, and consecutive output pixels are
+ * conv_stride_x * IFM values apart. The output columns whose receptive field crosses the left or right padding are computed
+ * by one GEMM per kernel column on the IFM values only, and the output rows crossing the top or bottom padding are skipped
+ * by the GEMMs of the kernel rows that fall in the padding. The resulting table of GEMMs, with the offsets of their first input
+ * and output rows, is built at configure time and all the GEMMs accumulate into the output.
+ *
+ * The GEMMs are run by arm_gemm, using the hybrid kernels when available, so the only working memory needed is the one
+ * required by the selected kernels.
+ *
+ * This function calls the following NEON kernels/functions:
+ *
+ * -# @ref NEMemsetKernel
+ * -# @ref NEGEMMAssemblyWrapperKernel (once per GEMM and batch)
+ * -# @ref NEDirectConvolutionLayerOutputStageKernel (if a bias is given)
+ * -# @ref NEActivationLayer (if a fused activation is given)
+ */
+class NEGEMMDirectConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDirectConvolutionLayer(const NEGEMMDirectConvolutionLayer &) = delete;
+    /** Default move constructor */
+    NEGEMMDirectConvolutionLayer(NEGEMMDirectConvolutionLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDirectConvolutionLayer &operator=(const NEGEMMDirectConvolutionLayer &) = delete;
+    /** Default move assignment operator */
+    NEGEMMDirectConvolutionLayer &operator=(NEGEMMDirectConvolutionLayer &&) = default;
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @note The IFM dimension of @p input and @p weights must not be padded.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F16/F32. Data layout supported: NHWC.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [IFM, kernel_x, kernel_y, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  (Optional) Activation layer information in case of a fused activation.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMDirectConvolutionLayer
+     *
+     * @param[in] input     Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                      while every optional dimension from 4 and above represent a batch of inputs.
+     *                      Data types supported: F16/F32. Data layout supported: NHWC.
+     * @param[in] weights   Weights tensor info. Weights are 4D tensor with dimensions [IFM, kernel_x, kernel_y, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases    Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output    Destination tensor info. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                      Data types supported: Same as @p input.
+     * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] act_info  (Optional) Activation layer information in case of a fused activation.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    /** GEMM computing the contribution of a block of kernel taps to a rectangle of the output */
+    struct RowGemm
+    {
+        std::unique_ptr<arm_gemm::IGemmCommon> gemm;                      /**< arm_gemm object */
+        std::unique_ptr<INEKernel>             kernel;                    /**< Kernel scheduling @p gemm */
+        Coordinates                            input_start;               /**< Coordinates of the first input value read */
+        Coordinates                            output_start;              /**< Coordinates of the first output value written */
+        Coordinates                            weights_start;             /**< Coordinates of the first weights value read */
+        size_t                                 pretransposed_offset{ 0 }; /**< Offset in bytes of the pretransposed weights */
+        bool                                   pretransposes_b{ false };  /**< True if the GEMM pretransposes the weights, false if it uses those pretransposed by a previous GEMM */
+    };
+
+    MemoryGroup                               _memory_group;
+    NEMemsetKernel                            _memset_kernel;
+    NEDirectConvolutionLayerOutputStageKernel _output_stage_kernel;
+    NEActivationLayer                         _activationlayer_function;
+    std::vector<RowGemm>                      _row_gemms;
+    Tensor                                    _workspace;
+    Tensor                                    _pretransposed_weights;
+    const ITensor                            *_input;
+    const ITensor                            *_weights;
+    ITensor                                  *_output;
+    PadStrideInfo                             _conv_info;
+    bool                                      _has_bias;
+    bool                                      _is_activationlayer_enabled;
+    bool                                      _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEGEMMDIRECTCONVOLUTIONLAYER_H__ */
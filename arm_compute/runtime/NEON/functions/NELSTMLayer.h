@@ -25,16 +25,15 @@
 #define __ARM_COMPUTE_NELSTMLAYER_H__
 
 #include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
-#include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
-#include "arm_compute/core/NEON/kernels/NEArithmeticSubtractionKernel.h"
 #include "arm_compute/core/NEON/kernels/NECopyKernel.h"
-#include "arm_compute/core/NEON/kernels/NEPixelWiseMultiplicationKernel.h"
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/NEON/functions/NEWidthConcatenateLayer.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 
 namespace arm_compute
@@ -42,7 +41,17 @@ namespace arm_compute
 // Forward declarations
 class ITensor;
 
-/** Basic function to run @ref NELSTMLayer */
+/** Basic function to run @ref NELSTMLayer
+ *
+ * This function calls the following NEON functions/kernels:
+ *
+ * -# @ref NEWidthConcatenateLayer (input and output_state_in)
+ * -# @ref NEFullyConnectedLayer (all the gates at once, using the concatenated input and recurrent weights)
+ * -# @ref NELSTMCellKernel
+ * -# @ref NEFullyConnectedLayer (projection, if projection weights are given)
+ * -# @ref NEActivationLayerKernel (projection clipping, if projection_threshold is not 0)
+ * -# @ref NECopyKernel
+ */
 class NELSTMLayer : public IFunction
 {
 public:
@@ -135,80 +144,32 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                     _memory_group;
-    NEFullyConnectedLayer           _fully_connected_input_gate;
-    NEGEMM                          _gemm_input_gate;
-    NETransposeKernel               _transpose_input_gate;
-    NEArithmeticAdditionKernel      _accum_input_gate1;
-    NEArithmeticAddition            _accum_input_gate2;
-    NEArithmeticSubtractionKernel   _subtract_input_gate;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_input_gate;
-    NEActivationLayerKernel         _activation_input_gate;
-    NEFullyConnectedLayer           _fully_connected_forget_gate;
-    NEGEMM                          _gemm_forget_gate;
-    NETransposeKernel               _transpose_forget_gate;
-    NEArithmeticAdditionKernel      _accum_forget_gate1;
-    NEArithmeticAddition            _accum_forget_gate2;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_forget_gate;
-    NEActivationLayerKernel         _activation_forget_gate;
-    NEFullyConnectedLayer           _fully_connected_cell_state;
-    NEGEMM                          _gemm_cell_state1;
-    NEGEMM                          _gemm_cell_state2;
-    NETransposeKernel               _transpose_cell_state;
-    NEArithmeticAdditionKernel      _accum_cell_state1;
-    NEArithmeticAdditionKernel      _accum_cell_state2;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_cell_state1;
-    NEActivationLayerKernel         _activation_cell_state;
-    NEActivationLayerKernel         _cell_clip;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_cell_state2;
-    NEFullyConnectedLayer           _fully_connected_output;
-    NEGEMM                          _gemm_output;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_output_state1;
-    NETransposeKernel               _transpose_output;
-    NEArithmeticAdditionKernel      _accum_output1;
-    NEArithmeticAddition            _accum_output2;
-    NEActivationLayerKernel         _activation_output;
-    NEActivationLayerKernel         _activation_output_state;
-    NEPixelWiseMultiplicationKernel _pixelwise_mul_output_state2;
-    NEFullyConnectedLayer           _fully_connected_output_state;
-    NEGEMM                          _gemm_output_state;
-    NEArithmeticAdditionKernel      _accum_output_state;
-    NEActivationLayerKernel         _projection_clip;
-    NECopyKernel                    _copy_cell_state;
-    NECopyKernel                    _copy_output;
-    NEWidthConcatenateLayer         _concat_scratch_buffer;
-    NEWidthConcatenateLayer         _concat_inputs_forget_gate;
-    NEWidthConcatenateLayer         _concat_weights_forget_gate;
-    NEWidthConcatenateLayer         _concat_weights_input_gate;
-    NEWidthConcatenateLayer         _concat_weights_output;
-    Tensor                          _input_gate_out1;
-    Tensor                          _input_gate_out2;
-    Tensor                          _input_gate_out3;
-    Tensor                          _input_gate_out4;
-    Tensor                          _forget_gate_out1;
-    Tensor                          _forget_gate_out2;
-    Tensor                          _forget_gate_out3;
-    Tensor                          _forget_gate_out4;
-    Tensor                          _forget_gate_out5;
-    Tensor                          _forget_gate_out6;
-    Tensor                          _cell_state_out1;
-    Tensor                          _cell_state_out2;
-    Tensor                          _cell_state_out3;
-    Tensor                          _cell_state_out4;
-    Tensor                          _cell_state_out5;
-    Tensor                          _output1;
-    Tensor                          _output2;
-    Tensor                          _output3;
-    Tensor                          _output4;
-    Tensor                          _cell_state_activation;
-    Tensor                          _output_state1;
-    Tensor                          _ones;
-    bool                            _run_peephole_opt;
-    bool                            _run_cifg_opt;
-    bool                            _perform_cell_clipping;
-    bool                            _has_projection_weights;
-    bool                            _perform_projection_clipping;
-    bool                            _is_prepared;
+    MemoryGroup                  _memory_group;
+    NEWidthConcatenateLayer      _concat_inputs;
+    NEWidthConcatenateLayer      _concat_weights_input_gate;
+    NEWidthConcatenateLayer      _concat_weights_cell_gate;
+    NEWidthConcatenateLayer      _concat_weights_forget_gate;
+    NEWidthConcatenateLayer      _concat_weights_output_gate;
+    NEConcatenateLayer           _concat_gates_weights;
+    NEWidthConcatenateLayer      _concat_gates_bias;
+    NEFullyConnectedLayer        _fully_connected_gates;
+    NELSTMCellKernel             _lstm_cell;
+    NEFullyConnectedLayer        _fully_connected_output_state;
+    NEActivationLayerKernel      _projection_clip;
+    NECopyKernel                 _copy_output;
+    Tensor                       _inputs_concat;
+    Tensor                       _input_gate_weights;
+    Tensor                       _cell_gate_weights;
+    Tensor                       _forget_gate_weights;
+    Tensor                       _output_gate_weights;
+    Tensor                       _gates_weights;
+    Tensor                       _gates_bias;
+    Tensor                       _output_state1;
+    std::vector<const ITensor *> _original_weights;
+    bool                         _run_cifg_opt;
+    bool                         _has_projection_weights;
+    bool                         _perform_projection_clipping;
+    bool                         _is_prepared;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NELSTMLAYER_H__ */
@@ -27,8 +27,10 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/kernels/assembly/gemm_common.hpp"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/functions/CPPPermute.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
@@ -36,6 +38,7 @@
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -47,19 +50,29 @@ class ITensor;
  * -# @ref NEGEMMAssemblyDispatch
  * -# @ref CPPPermute (three times: weights, input and output)
  *
- * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5)) are supported only with enable_fast_math = true
+ * When the transformed input and output do not fit in the L2 caches of the threads, the input transform, the GEMMs and the output
+ * transform of 2D kernels are instead fused in @ref NEWinogradLayerStreamingKernel, which processes bands of rows of tiles in
+ * per-thread buffers. These are created for the number of threads of the scheduler at configuration time, which bounds the number of
+ * threads running the kernel.
+ *
+ * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5) and F(4x4, 3x3) in F16) are supported only with enable_fast_math = true
+ * @note  F16 is supported only for 3x3 and 5x5 kernels. Without enable_fast_math, F16 3x3 kernels use F(2x2, 3x3) on any input size
  */
 class NEWinogradConvolutionLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager.
+     * @param[in] weights_manager (Optional) Weights manager providing the cache of the transformed weights (See @ref IWeightsManager::weights_cache).
+     */
+    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Set the input and output tensors.
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F32.
+     *                              Data types supported: F16/F32.
      * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
      *                              Currently only 3x3 and 5x5 kernels are supported.
      * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
@@ -73,6 +86,14 @@ public:
     void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
                    bool enable_fast_math = false);
 
+    /** Streams the tiles of 2D kernels through the transforms and the GEMMs regardless of the size of the transformed tensors
+     *
+     * @note Must be called before @ref configure
+     *
+     * @param[in] force_streaming True to always stream the tiles of 2D kernels, false to only stream them when they do not fit in the L2 caches
+     */
+    void set_force_streaming(bool force_streaming);
+
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
@@ -81,7 +102,7 @@ public:
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
-     *                             Data types supported: F32.
+     *                             Data types supported: F16/F32.
      * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
      *                             Currently only 3x3 and 5x5 kernels are supported.
      * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
@@ -104,6 +125,7 @@ public:
 
 private:
     MemoryGroup                _memory_group;
+    IWeightsManager           *_weights_manager;
     NEGEMM                     _gemm_function;
     std::unique_ptr<INEKernel> _transform_input_kernel;
     std::unique_ptr<INEKernel> _transform_output_kernel;
@@ -121,11 +143,19 @@ private:
     Tensor         _input_nhwc;
     Tensor         _output_nhwc;
     Tensor         _weights_hwio;
+
+    std::unique_ptr<INEKernel>                          _streaming_kernel;
+    std::vector<std::unique_ptr<arm_gemm::IGemmCommon>> _band_gemms;
+    Tensor                                              _band_workspace;
+    Tensor                                              _pretransposed_weights;
+
     const ITensor *_input;
     const ITensor *_weights;
     ITensor       *_output;
     bool           _is_prepared;
     bool           _is_activationlayer_enabled;
+    bool           _is_streaming;
+    bool           _force_streaming;
 };
 }
 #endif /* __ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYER_H__ */
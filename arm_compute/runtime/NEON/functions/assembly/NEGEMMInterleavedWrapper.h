@@ -32,6 +32,8 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -89,13 +91,37 @@ public:
     virtual ~IBufferManager() = default;
 };
 
+/** Weights transform running the pretranspose of B of @ref NEGEMMInterleavedWrapper */
+class NEGEMMInterleavedTransformB : public ITransformWeights
+{
+public:
+    /** Configure the transform
+     *
+     * @param[in] transformed_b Tensor to store the pretransposed B matrix into. Must be the output of @p prepare_b.
+     * @param[in] prepare_b     Kernel performing the pretranspose of B.
+     * @param[in] uid           Unique id of the pretranspose.
+     */
+    void configure(Tensor *transformed_b, INEKernel *prepare_b, const std::string &uid);
+
+    // Inherited methods overridden:
+    ITensor *get_weights() override;
+    std::string uid() override;
+    void run() override;
+    void release() override;
+
+private:
+    Tensor     *_transformed_b{ nullptr };
+    INEKernel  *_prepare_b{ nullptr };
+    std::string _uid{};
+};
+
 /** Equivalent to arm_gemm::GemmInterleaved but using Compute Library types.
  */
 class NEGEMMInterleavedWrapper : public IFunction
 {
 public:
-    NEGEMMInterleavedWrapper(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
-    ~NEGEMMInterleavedWrapper()                                             = default;
+    NEGEMMInterleavedWrapper(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
+    ~NEGEMMInterleavedWrapper() = default;
 
     NEGEMMInterleavedWrapper(const NEGEMMInterleavedWrapper &) = delete;
     NEGEMMInterleavedWrapper &operator=(const NEGEMMInterleavedWrapper &) = delete;
@@ -112,6 +138,11 @@ public:
      * @param[in]  pretranspose_b If true, pretranspose B once during the prepare() stage instead of on the fly every time.
      */
     void configure(const ITensor *a, const ITensor *b, ITensor *c, float alpha, float beta, bool pretranspose_b);
+    /** Size of the pretransposed B matrix held by the function
+     *
+     * @return Size in bytes of the pretransposed B matrix allocated by the function, 0 if B is not pretransposed, not yet prepared or shared through a weights manager
+     */
+    size_t pretransposed_weights_size() const;
 
     // Inherited methods overridden:
     void run() override;
@@ -119,6 +150,8 @@ public:
 
 private:
     MemoryGroup                                             _memory_group;
+    IWeightsManager                                        *_weights_manager{ nullptr };
+    NEGEMMInterleavedTransformB                             _weights_transform{};
     bool                                                    _is_prepared{ false };
     bool                                                    _pretranspose_b{ false };
     Window                                                  _block_walker{};
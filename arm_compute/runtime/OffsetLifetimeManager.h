@@ -37,12 +37,18 @@ namespace arm_compute
 class IMemoryPool;
 
 /** Concrete class that tracks the lifetime of registered tensors and
- *  calculates the systems memory requirements in terms of a single blob and a list of offsets */
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * The offsets are planned from the lifetime intervals of the tensors: two tensors share memory only if they are not alive at the same time.
+ */
 class OffsetLifetimeManager : public ISimpleLifetimeManager
 {
 public:
-    /** Constructor */
-    OffsetLifetimeManager();
+    /** Constructor
+     *
+     * @param[in] strategy (Optional) Strategy used to plan the offsets of the tensors. Defaults to @ref OffsetPlanningStrategy::GREEDY_BY_SIZE
+     */
+    OffsetLifetimeManager(OffsetPlanningStrategy strategy = OffsetPlanningStrategy::GREEDY_BY_SIZE);
     /** Prevent instances of this class to be copy constructed */
     OffsetLifetimeManager(const OffsetLifetimeManager &) = delete;
     /** Prevent instances of this class to be copied */
@@ -52,16 +58,32 @@ public:
     /** Allow instances of this class to be moved */
     OffsetLifetimeManager &operator=(OffsetLifetimeManager &&) = default;
 
+    /** Size of the blob planned for the groups finalized so far
+     *
+     * @return The size of the blob in bytes
+     */
+    size_t planned_size() const;
+    /** Largest total size of the tensors alive at the same time, over the groups finalized so far
+     *
+     * @note This is the lower bound of @ref planned_size, alignment requirements aside.
+     *
+     * @return The peak memory footprint in bytes
+     */
+    size_t peak_size() const;
+
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
     MappingType mapping_type() const override;
+    size_t      pool_size() const override;
 
 private:
     // Inherited methods overridden:
     void update_blobs_and_mappings() override;
 
 private:
-    BlobInfo _blob; /**< Memory blob size */
+    OffsetPlanningStrategy _strategy;  /**< Offset planning strategy */
+    BlobInfo               _blob;      /**< Memory blob size */
+    size_t                 _peak_size; /**< Peak memory footprint */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H__ */
@@ -29,15 +29,20 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "support/Mutex.h"
-#include "support/Semaphore.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
-#include <list>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
-/** Memory pool manager */
+/** Memory pool manager
+ *
+ * The pools are locked and unlocked without taking a lock: a thread only blocks when all the pools are occupied.
+ * A thread is handed the pool it locked last when it is free, so that its memory is still warm in the caches of the core.
+ */
 class PoolManager : public IPoolManager
 {
 public:
@@ -47,10 +52,10 @@ public:
     PoolManager(const PoolManager &) = delete;
     /** Prevent instances of this class to be copied */
     PoolManager &operator=(const PoolManager &) = delete;
-    /** Allow instances of this class to be move constructed */
-    PoolManager(PoolManager &&) = default;
-    /** Allow instances of this class to be moved */
-    PoolManager &operator=(PoolManager &&) = default;
+    /** Prevent instances of this class to be move constructed (As this class contains atomics) */
+    PoolManager(PoolManager &&) = delete;
+    /** Prevent instances of this class to be moved (As this class contains atomics) */
+    PoolManager &operator=(PoolManager &&) = delete;
 
     // Inherited methods overridden:
     IMemoryPool *lock_pool() override;
@@ -61,10 +66,21 @@ public:
     size_t                       num_pools() const override;
 
 private:
-    std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
-    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
-    std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
-    mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    /** Registered pool */
+    struct PoolSlot
+    {
+        std::unique_ptr<IMemoryPool> pool;       /**< Memory pool */
+        std::atomic<bool>            occupied;   /**< True if the pool is locked */
+        std::atomic<size_t>          last_owner; /**< Index of the thread that locked the pool last, 0 if it was never locked */
+    };
+    /** Wait until a pool is unlocked */
+    void wait_for_free_pool();
+
+    std::vector<std::unique_ptr<PoolSlot>> _slots;       /**< Registered pools */
+    std::atomic<int>                       _num_free;    /**< Number of free pools not reserved by a thread */
+    std::atomic<int>                       _num_waiters; /**< Number of threads waiting for a pool to be unlocked */
+    mutable arm_compute::Mutex             _mtx;         /**< Mutex to control the registration of the pools and the waiting threads */
+    std::condition_variable_any            _cv;          /**< Condition variable signalled when a pool is unlocked */
 };
 } // arm_compute
 #endif /*__ARM_COMPUTE_POOLMANAGER_H__ */
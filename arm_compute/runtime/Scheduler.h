@@ -36,10 +36,11 @@ public:
     /** Scheduler type */
     enum class Type
     {
-        ST,    /**< Single thread. */
-        CPP,   /**< C++11 threads. */
-        OMP,   /**< OpenMP. */
-        CUSTOM /**< Provided by the user. */
+        ST,            /**< Single thread. */
+        CPP,           /**< C++11 threads. */
+        OMP,           /**< OpenMP. */
+        WORK_STEALING, /**< C++11 threads balancing the work by stealing. */
+        CUSTOM         /**< Provided by the user. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
      *
@@ -47,10 +48,23 @@ public:
      */
     static void set(std::shared_ptr<IScheduler> scheduler);
     /** Access the scheduler singleton.
+     *
+     * @note If a scheduler was set for the calling thread using @ref set_thread_local, it is returned instead of the active scheduler.
      *
      * @return A reference to the scheduler object.
      */
     static IScheduler &get();
+    /** Sets a scheduler to be used by the calling thread only.
+     *
+     * This allows several threads to run functions concurrently, each one on its own pool of threads.
+     *
+     * @note The scheduler is not owned by this class and must outlive its use by the calling thread.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread, or nullptr to use the active scheduler again.
+     *
+     * @return The scheduler previously set for the calling thread, or nullptr if it was using the active scheduler.
+     */
+    static IScheduler *set_thread_local(IScheduler *scheduler);
     /** Set the active scheduler.
      *
      * Only one scheduler can be enabled at any time.
@@ -105,6 +105,22 @@ public:
      * @return An error status
      */
     Status import_memory(void *memory);
+    /** Import the memory of another tensor allocator as a tensor's backing memory
+     *
+     * @warning size is expected to be compliant with total_size reported by ITensorInfo.
+     * @warning tensor shouldn't be memory managed.
+     * @note Ownership of the memory becomes shared.
+     *
+     * @param[in] memory Memory region to be used as backing memory, as returned by @ref shared_memory
+     *
+     * @return An error status
+     */
+    Status import_shared_memory(std::shared_ptr<IMemoryRegion> memory);
+    /** Returns the backing memory of the tensor to share with other tensor allocators
+     *
+     * @return The memory region if owned by the allocator else nullptr
+     */
+    std::shared_ptr<IMemoryRegion> shared_memory() const;
     /** Associates the tensor with a memory group
      *
      * @param[in] associated_memory_group Memory group to associate the tensor with
@@ -37,6 +37,22 @@ enum class MappingType
     OFFSETS /**< Mappings are in offset granularity in the same blob */
 };
 
+/** Strategy used to assign offsets to the objects sharing a memory blob */
+enum class OffsetPlanningStrategy
+{
+    BLOBS,            /**< Objects reusing each other's memory during lifetime tracking share an offset, and these sets of objects are laid out one after the other */
+    GREEDY_BY_SIZE,   /**< Objects are placed from the largest to the smallest, each in the tightest gap left by the objects alive at the same time */
+    GREEDY_BY_BREADTH /**< Objects alive at the points of the execution with the largest memory footprint are placed first, each in the tightest gap left by the objects alive at the same time */
+};
+
+/** Huge page usage of the memory mapped allocations */
+enum class HugePageMode
+{
+    NONE,        /**< Regular pages are used */
+    TRANSPARENT, /**< The kernel is advised to back the mappings with transparent huge pages */
+    EXPLICIT     /**< The mappings are allocated from the pre-reserved huge pages pool, falling back to transparent huge pages if the pool is exhausted */
+};
+
 /** A map of (handle, index/offset), where handle is the memory handle of the object
  * to provide the memory for and index/offset is the buffer/offset from the pool that should be used
  *
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCACHE_H__
+#define __ARM_COMPUTE_WEIGHTSCACHE_H__
+
+#include "arm_compute/core/ITensor.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+/** Persistent cache of transformed weights
+ *
+ * Functions preparing their weights (pretranspose, reshape, Winograd transform) store the transformed blobs in a directory,
+ * one file per blob. The file name is a hash of the transformation identifier, of the source weights (shape, data type and values)
+ * and of the size of the transformed weights. On the next start the blobs are memory-mapped back instead of being recomputed.
+ *
+ * @note The cache is used by the functions sharing a @ref WeightsManager it has been set on (See @ref WeightsManager::set_weights_cache).
+ * @note The cache must outlive the functions using it as they reference the mapped memory.
+ */
+class WeightsCache final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] directory Directory where the transformed weights are stored. (Must exist)
+     */
+    WeightsCache(std::string directory);
+    /** Destructor: unmaps the loaded blobs */
+    ~WeightsCache();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WeightsCache(const WeightsCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WeightsCache &operator=(const WeightsCache &) = delete;
+
+    /** Computes the key of transformed weights
+     *
+     * @note The source weights values are read, hence the weights must be allocated and filled.
+     *
+     * @param[in] transform_id     Identifier of the transformation (e.g. kernel name and configuration).
+     * @param[in] weights          Source weights.
+     * @param[in] transformed_size Size in bytes of the transformed weights.
+     *
+     * @return The key of the transformed weights
+     */
+    static std::string compute_key(const std::string &transform_id, const ITensor &weights, size_t transformed_size);
+    /** Maps the transformed weights of a given key
+     *
+     * @param[in] key  Key of the transformed weights.
+     * @param[in] size Size in bytes of the transformed weights.
+     *
+     * @return A pointer to the transformed weights, aligned to the page size of the system, if present in the cache with the given size else nullptr
+     */
+    void *load(const std::string &key, size_t size);
+    /** Stores transformed weights in the cache
+     *
+     * @param[in] key  Key of the transformed weights.
+     * @param[in] data Transformed weights.
+     * @param[in] size Size in bytes of the transformed weights.
+     */
+    void store(const std::string &key, const void *data, size_t size);
+
+private:
+    /** Returns the file storing the blob of a given key
+     *
+     * @param[in] key Key of the transformed weights.
+     *
+     * @return The blob filename
+     */
+    std::string filename(const std::string &key) const;
+
+    std::string                                      _directory; /**< Directory storing the blobs */
+    std::map<std::string, std::pair<void *, size_t>> _mappings;  /**< Mapped blobs with their mapping size */
+    std::mutex                                       _mtx;       /**< Mutex protecting the mappings */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_WEIGHTSCACHE_H__ */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSMANAGER_H__
+#define __ARM_COMPUTE_WEIGHTSMANAGER_H__
+
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Weights manager which shares transformed weights keyed by the content of the weights and the transform id
+ *
+ * A single manager can be shared by several graphs (e.g. by inserting it in the weights management context of each
+ * @ref graph::GraphContext before finalizing the graphs) so that instances of the same model share their transformed weights.
+ *
+ * @note The manager is thread safe, so functions that are prepared concurrently can share it.
+ */
+class WeightsManager final : public IWeightsManager
+{
+public:
+    /** Default Constructor */
+    WeightsManager();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WeightsManager(const WeightsManager &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WeightsManager &operator=(const WeightsManager &) = delete;
+    /** Destructor which detaches the transforms still registered */
+    ~WeightsManager();
+    /** Sets the persistent cache of transformed weights used by the functions sharing this manager
+     *
+     * @note Must be set before the functions are prepared.
+     *
+     * @param[in] cache Cache to use, or nullptr to disable caching.
+     */
+    void set_weights_cache(std::shared_ptr<WeightsCache> cache);
+
+    // Inherited methods overridden:
+    void manage(const ITensor *weights, ITransformWeights *parent = nullptr) override;
+    ITensor *acquire(const ITensor *weights, ITransformWeights *weights_transform) override;
+    ITensor *run(const ITensor *weights, ITransformWeights *weights_transform) override;
+    bool are_weights_managed(const ITensor *weights) override;
+    void unregister_transform(ITransformWeights *weights_transform) override;
+    size_t footprint() override;
+    WeightsCache *weights_cache() override;
+
+private:
+    /** Start managing a weights tensor. Must be called with the mutex locked
+     *
+     * @param[in] weights Weights tensor to manage
+     * @param[in] parent  Transform which produced @p weights, if any
+     */
+    void manage_locked(const ITensor *weights, ITransformWeights *parent);
+    /** Register a transform of the weights if not registered yet. Must be called with the mutex locked
+     *
+     * @param[in] weights           Managed weights tensor
+     * @param[in] weights_transform Weights transform
+     */
+    void register_transform_locked(const ITensor *weights, ITransformWeights *weights_transform);
+
+private:
+    std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;         /**< Registered transforms of each managed tensor */
+    std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents; /**< Transform which produced each managed tensor */
+    std::map<std::string, std::weak_ptr<IMemoryRegion>>         _shared_weights;          /**< Memory of the transformed weights keyed by content */
+    std::shared_ptr<WeightsCache>                               _weights_cache;           /**< Cache of the transformed weights */
+    std::mutex                                                  _mtx;                     /**< Mutex to protect the maps */
+};
+} // arm_compute
+#endif /*__ARM_COMPUTE_WEIGHTSMANAGER_H__ */
@@ -96,10 +96,11 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads           = common_params.threads;
+        config.use_tuner             = common_params.enable_tuner;
+        config.tuner_mode            = common_params.tuner_mode;
+        config.tuner_file            = common_params.tuner_file;
+        config.num_parallel_branches = common_params.branches;
 
         graph.finalize(common_params.target, config);
 
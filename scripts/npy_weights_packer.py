@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+"""Packs a directory of numpy arrays in a single weights container.
+Usage
+    python npy_weights_packer.py -i path_to_data_directory -o path_to_container [-l NCHW|NHWC] [-a alignment]
+
+Each {name}.npy file found under the input directory is stored in the container under its path relative to the
+input directory. The container can then be passed as data path to the graph examples instead of the directory.
+
+Format (little endian):
+    Header: "ACLWPACK" magic, uint32 version, uint32 number of entries
+    Index:  for each entry: uint32 name length, name, uint32 typestring length, typestring, uint8 fortran order,
+            uint8 data layout (0: NCHW, 1: NHWC), uint16 reserved, uint32 number of dimensions,
+            uint64 dimensions, uint64 offset of the NPY header, uint64 offset of the data,
+            uint64 size of the data, uint32 data alignment
+    Payload: the NPY files stored verbatim, padded so that their data is aligned
+
+Tested with numpy 1.16 on Python 2.7 and 3.6
+"""
+import argparse
+import os
+import struct
+import numpy as np
+
+MAGIC = b'ACLWPACK'
+VERSION = 1
+
+
+def read_npy_header(path):
+    """Returns the shape, fortran order, typestring and header size of a npy file"""
+    with open(path, 'rb') as f:
+        major, minor = np.lib.format.read_magic(f)
+        if major == 1:
+            shape, fortran_order, dtype = np.lib.format.read_array_header_1_0(f)
+        else:
+            shape, fortran_order, dtype = np.lib.format.read_array_header_2_0(f)
+        return shape, fortran_order, dtype.str, f.tell()
+
+
+def index_entry_size(name, typestring, shape):
+    return 4 + len(name) + 4 + len(typestring) + 4 + 4 + 8 * len(shape) + 8 * 3 + 4
+
+
+def align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+if __name__ == "__main__":
+    # Parse arguments
+    parser = argparse.ArgumentParser('Pack numpy arrays in a weights container')
+    parser.add_argument('-i', dest='inputDir', type=str, required=True, help='Directory containing the npy files')
+    parser.add_argument('-o', dest='outputFile', type=str, required=True, help='Container to create')
+    parser.add_argument('-l', dest='layout', type=str, default='NCHW', choices=['NCHW', 'NHWC'], help='Layout in which the weights are stored')
+    parser.add_argument('-a', dest='alignment', type=int, default=64, help='Alignment in bytes of the tensors data')
+    args = parser.parse_args()
+
+    # Collect npy files
+    files = []
+    for root, _, names in os.walk(args.inputDir):
+        for name in sorted(names):
+            if name.endswith('.npy'):
+                path = os.path.join(root, name)
+                files.append((os.path.relpath(path, args.inputDir).replace(os.path.sep, '/').encode('utf-8'), path))
+    files.sort()
+
+    headers = [read_npy_header(path) for _, path in files]
+
+    # Compute the payload offsets
+    offset = len(MAGIC) + 8
+    offset += sum(index_entry_size(name, typestring, shape) for (name, _), (shape, _, typestring, _) in zip(files, headers))
+    entries = []
+    for (name, path), (shape, fortran_order, typestring, header_size) in zip(files, headers):
+        data_offset = align(offset + header_size, args.alignment)
+        file_size = os.path.getsize(path)
+        entries.append((data_offset - header_size, data_offset, file_size - header_size))
+        offset = data_offset + file_size - header_size
+
+    layout = 0 if args.layout == 'NCHW' else 1
+    with open(args.outputFile, 'wb') as out:
+        out.write(MAGIC)
+        out.write(struct.pack('<II', VERSION, len(files)))
+        for (name, _), (shape, fortran_order, typestring, _), (npy_offset, data_offset, data_size) in zip(files, headers, entries):
+            typestring = typestring.encode('utf-8')
+            out.write(struct.pack('<I', len(name)) + name)
+            out.write(struct.pack('<I', len(typestring)) + typestring)
+            out.write(struct.pack('<BBHI', int(fortran_order), layout, 0, len(shape)))
+            out.write(struct.pack('<%dQ' % len(shape), *shape))
+            out.write(struct.pack('<QQQI', npy_offset, data_offset, data_size, args.alignment))
+        for (name, path), (npy_offset, _, _) in zip(files, entries):
+            out.write(b'\0' * (npy_offset - out.tell()))
+            with open(path, 'rb') as f:
+                out.write(f.read())
+            print('Packed {0} at offset {1}'.format(name.decode('utf-8'), npy_offset))
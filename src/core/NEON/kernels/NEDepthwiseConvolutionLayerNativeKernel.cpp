@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayerNativeKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                          unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(depth_multiplier == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0) * depth_multiplier);
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(1) - 1) * dilation.x() + 1 > input->dimension(1) + conv_info.pad_left() + conv_info.pad_right());
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(2) - 1) * dilation.y() + 1 > input->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom());
+
+    if(act_info.enabled())
+    {
+        const ActivationFunction act = act_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActivationFunction::RELU && act != ActivationFunction::BOUNDED_RELU && act != ActivationFunction::LU_BOUNDED_RELU,
+                                        "Activation function not supported");
+    }
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(0));
+    }
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+
+/** Applies a fused activation function to a vector
+ *
+ * @param[in] in      Input vector
+ * @param[in] act     Activation function
+ * @param[in] va      Vector filled with the alpha parameter of the activation
+ * @param[in] vb      Vector filled with the beta parameter of the activation
+ * @param[in] const_0 Vector filled with 0
+ *
+ * @return The activated vector
+ */
+template <typename V>
+inline V activate(const V &in, ActivationFunction act, const V &va, const V &vb, const V &const_0)
+{
+    switch(act)
+    {
+        case ActivationFunction::RELU:
+            return wrapper::vmax(const_0, in);
+        case ActivationFunction::BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(const_0, in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(vb, in));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return in;
+    }
+}
+
+/** Applies a fused activation function to a scalar
+ *
+ * @param[in] in  Input value
+ * @param[in] act Activation function
+ * @param[in] a   Alpha parameter of the activation
+ * @param[in] b   Beta parameter of the activation
+ *
+ * @return The activated value
+ */
+template <typename T>
+inline T activate(T in, ActivationFunction act, T a, T b)
+{
+    switch(act)
+    {
+        case ActivationFunction::RELU:
+            return std::max<T>(static_cast<T>(0), in);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(static_cast<T>(0), in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(b, in));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return in;
+    }
+}
+} // namespace
+
+NEDepthwiseConvolutionLayerNativeKernel::NEDepthwiseConvolutionLayerNativeKernel()
+    : _func(nullptr), _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _conv_info(), _depth_multiplier(1), _act_info(), _dilation()
+{
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                        unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, depth_multiplier, act_info, dilation));
+
+    _input            = input;
+    _weights          = weights;
+    _biases           = biases;
+    _output           = output;
+    _conv_info        = conv_info;
+    _depth_multiplier = depth_multiplier;
+    _act_info         = act_info;
+    _dilation         = dilation;
+
+    // Use unrolled specialisations for the most common kernel sizes
+    const unsigned int kernel_w = weights->info()->dimension(1);
+    const unsigned int kernel_h = weights->info()->dimension(2);
+    const bool         is_3x3   = kernel_w == 3 && kernel_h == 3;
+    const bool         is_5x5   = kernel_w == 5 && kernel_h == 5;
+    const bool         is_7x7   = kernel_w == 7 && kernel_h == 7;
+
+    switch(input->info()->data_type())
+    {
+        case DataType::F32:
+            _func = is_3x3 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float, 3, 3> :
+                    is_5x5 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float, 5, 5> :
+                    is_7x7 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float, 7, 7> :
+                    &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float, 0, 0>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = is_3x3 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float16_t, 3, 3> :
+                    is_5x5 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float16_t, 5, 5> :
+                    is_7x7 ? &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float16_t, 7, 7> :
+                    &NEDepthwiseConvolutionLayerNativeKernel::run_depthwise<float16_t, 0, 0>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // Configure kernel window, the channels are processed in a single iteration so no padding is required
+    Window win = calculate_max_window(*output->info(), Steps());
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEDepthwiseConvolutionLayerNativeKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                         unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation));
+    return Status{};
+}
+
+template <typename T, int KW, int KH>
+void NEDepthwiseConvolutionLayerNativeKernel::run_depthwise(const Window &window)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const int step_c       = 16 / sizeof(T);
+    const int num_channels = _output->info()->dimension(0);
+    const int kernel_w     = (KW > 0) ? KW : static_cast<int>(_weights->info()->dimension(1));
+    const int kernel_h     = (KH > 0) ? KH : static_cast<int>(_weights->info()->dimension(2));
+    const int input_w      = _input->info()->dimension(1);
+    const int input_h      = _input->info()->dimension(2);
+    const int stride_x     = _conv_info.stride().first;
+    const int stride_y     = _conv_info.stride().second;
+    const int pad_left     = _conv_info.pad_left();
+    const int pad_top      = _conv_info.pad_top();
+    const int dilation_x   = _dilation.x();
+    const int dilation_y   = _dilation.y();
+    const int multiplier   = _depth_multiplier;
+
+    const size_t input_stride_w   = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_h   = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_n   = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_w = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_h = _weights->info()->strides_in_bytes()[2];
+
+    const uint8_t *input_base   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const T       *biases_ptr   = (_biases != nullptr) ? reinterpret_cast<const T *>(_biases->ptr_to_element(Coordinates(0))) : nullptr;
+
+    const bool               has_act = _act_info.enabled();
+    const ActivationFunction act     = _act_info.activation();
+    const auto               a       = static_cast<T>(_act_info.a());
+    const auto               b       = static_cast<T>(_act_info.b());
+    const auto               const_0 = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    const auto               va      = wrapper::vdup_n(a, ExactTagType{});
+    const auto               vb      = wrapper::vdup_n(b, ExactTagType{});
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(_output, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const int      in_x0       = id.y() * stride_x - pad_left;
+        const int      in_y0       = id.z() * stride_y - pad_top;
+        const uint8_t *input_batch = input_base + id[3] * input_stride_n;
+        const auto     out_ptr     = reinterpret_cast<T *>(out.ptr());
+
+        int c = 0;
+        if(multiplier == 1)
+        {
+            // Compute S channels per iteration
+            for(; c <= (num_channels - step_c); c += step_c)
+            {
+                auto acc = (biases_ptr != nullptr) ? wrapper::vloadq(biases_ptr + c) : const_0;
+                for(int kh = 0; kh < kernel_h; ++kh)
+                {
+                    const int in_y = in_y0 + kh * dilation_y;
+                    if(in_y < 0 || in_y >= input_h)
+                    {
+                        continue;
+                    }
+                    const uint8_t *input_row   = input_batch + in_y * input_stride_h;
+                    const uint8_t *weights_row = weights_base + kh * weights_stride_h;
+                    for(int kw = 0; kw < kernel_w; ++kw)
+                    {
+                        const int in_x = in_x0 + kw * dilation_x;
+                        if(in_x < 0 || in_x >= input_w)
+                        {
+                            continue;
+                        }
+                        const auto in_ptr = reinterpret_cast<const T *>(input_row + in_x * input_stride_w) + c;
+                        const auto w_ptr  = reinterpret_cast<const T *>(weights_row + kw * weights_stride_w) + c;
+                        acc               = wrapper::vmla(acc, wrapper::vloadq(in_ptr), wrapper::vloadq(w_ptr));
+                    }
+                }
+                if(has_act)
+                {
+                    acc = activate(acc, act, va, vb, const_0);
+                }
+                wrapper::vstore(out_ptr + c, acc);
+            }
+        }
+
+        // Compute left-over channels, or all the channels when the depth multiplier is not 1
+        for(; c < num_channels; ++c)
+        {
+            const int in_c = c / multiplier;
+            T         acc  = (biases_ptr != nullptr) ? biases_ptr[c] : static_cast<T>(0);
+            for(int kh = 0; kh < kernel_h; ++kh)
+            {
+                const int in_y = in_y0 + kh * dilation_y;
+                if(in_y < 0 || in_y >= input_h)
+                {
+                    continue;
+                }
+                const uint8_t *input_row   = input_batch + in_y * input_stride_h;
+                const uint8_t *weights_row = weights_base + kh * weights_stride_h;
+                for(int kw = 0; kw < kernel_w; ++kw)
+                {
+                    const int in_x = in_x0 + kw * dilation_x;
+                    if(in_x < 0 || in_x >= input_w)
+                    {
+                        continue;
+                    }
+                    acc += reinterpret_cast<const T *>(input_row + in_x * input_stride_w)[in_c] * reinterpret_cast<const T *>(weights_row + kw * weights_stride_w)[c];
+                }
+            }
+            out_ptr[c] = has_act ? activate<T>(acc, act, a, b) : acc;
+        }
+    },
+    out);
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -35,19 +35,27 @@ namespace arm_compute
 {
 namespace
 {
+TensorShape compute_output_shape(const ITensorInfo *input, const ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
+{
+    TensorShape output_shape = input->tensor_shape();
+    output_shape.set(config.axis, idx->tensor_shape().x());
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({ 0, 1 }).count(config.axis) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+    ARM_COMPUTE_RETURN_ERROR_ON(config.is_packed_real && (config.axis != 0 || input->num_channels() != 1));
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != (config.is_packed_real ? 2 : 1) * idx->tensor_shape().x());
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(input, idx, config));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -56,9 +64,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(idx, config);
-
-    auto_init_if_empty(*output, input->clone()->set_num_channels(2));
+    auto_init_if_empty(*output, input->clone()->set_num_channels(2).set_tensor_shape(compute_output_shape(input, idx, config)));
 
     Window win = calculate_max_window(*input, Steps());
     input->set_valid_region(ValidRegion(Coordinates(), input->tensor_shape()));
@@ -92,7 +98,7 @@ void NEFFTDigitReverseKernel::configure(const ITensor *input, ITensor *output, c
 
     if(axis == 0)
     {
-        if(is_input_complex)
+        if(is_input_complex || config.is_packed_real)
         {
             if(is_conj)
             {
@@ -142,7 +148,8 @@ Status NEFFTDigitReverseKernel::validate(const ITensorInfo *input, const ITensor
 template <bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
 {
-    const size_t N = _input->info()->dimension(0);
+    // Packed real inputs are read as complex sequences of the length of the look-up buffer
+    const size_t N = _idx->info()->dimension(0);
 
     // Copy the look-up buffer to a local array
     std::vector<unsigned int> buffer_idx(N);
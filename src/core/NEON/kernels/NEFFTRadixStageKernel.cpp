@@ -33,6 +33,7 @@
 #include <cmath>
 #include <complex>
 #include <map>
+#include <vector>
 
 #include "arm_compute/core/NEON/wrapper/traits.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
@@ -349,6 +350,41 @@ void fft_8(float32x2_t &x1, float32x2_t &x2, float32x2_t &x3, float32x2_t &x4, f
     x8 = reduce_sum_8(a, b6, c6, d6, e6, f6, g6, h6);
 }
 
+void fft_generic(float32x2_t *x, float32x2_t *sum, float32x2_t *diff, const float *cos_table, const float *sin_table, unsigned int radix)
+{
+    // Odd radix base-case transform: outputs m and radix - m share the sums and differences of the symmetric inputs
+    const unsigned int half_radix = radix / 2;
+    const float32x2_t  x0         = x[0];
+
+    float32x2_t dc = x0;
+    for(unsigned int r = 1; r <= half_radix; ++r)
+    {
+        sum[r]  = wrapper::vadd(x[r], x[radix - r]);
+        diff[r] = wrapper::vsub(x[r], x[radix - r]);
+        dc      = wrapper::vadd(dc, sum[r]);
+    }
+
+    for(unsigned int m = 1; m <= half_radix; ++m)
+    {
+        float32x2_t  re = x0;
+        float32x2_t  im = { 0.0f, 0.0f };
+        unsigned int q  = 0;
+        for(unsigned int r = 1; r <= half_radix; ++r)
+        {
+            q += m;
+            q = (q >= radix) ? q - radix : q;
+
+            re = wrapper::vmla(re, sum[r], float32x2_t{ cos_table[q], cos_table[q] });
+            im = wrapper::vmla(im, diff[r], float32x2_t{ sin_table[q], sin_table[q] });
+        }
+
+        const auto v = c_mul_neon_img(im, 1.f);
+        x[m]         = wrapper::vsub(re, v);
+        x[radix - m] = wrapper::vadd(re, v);
+    }
+    x[0] = dc;
+}
+
 template <bool first_stage>
 void fft_radix_2_axes_0(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
 {
@@ -898,11 +934,93 @@ void fft_radix_8_axes_1(float *X, float *x, unsigned int Nx, unsigned int NxRadi
     }
 }
 
+void fft_radix_generic_axes_0(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N,
+                              const float *cos_table, const float *sin_table, unsigned int radix, float32x2_t *scratch)
+{
+    float32x2_t *w_r  = scratch;
+    float32x2_t *v    = w_r + radix;
+    float32x2_t *sum  = v + radix;
+    float32x2_t *diff = sum + radix / 2 + 1;
+
+    float32x2_t w{ 1.0f, 0.0f };
+    for(unsigned int j = 0; j < Nx; j++)
+    {
+        // Twiddle factors of the stage
+        w_r[0] = float32x2_t{ 1.0f, 0.0f };
+        for(unsigned int r = 1; r < radix; ++r)
+        {
+            w_r[r] = c_mul_neon(w_r[r - 1], w);
+        }
+
+        for(unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
+        {
+            // Load inputs
+            v[0] = wrapper::vload(x + k);
+            for(unsigned int r = 1; r < radix; ++r)
+            {
+                v[r] = c_mul_neon(w_r[r], wrapper::vload(x + k + 2 * r * Nx));
+            }
+
+            // Base-case prime transform
+            fft_generic(v, sum, diff, cos_table, sin_table, radix);
+
+            // Store outputs
+            for(unsigned int r = 0; r < radix; ++r)
+            {
+                wrapper::vstore(X + k + 2 * r * Nx, v[r]);
+            }
+        }
+
+        w = c_mul_neon(w, w_m);
+    }
+}
+
+void fft_radix_generic_axes_1(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int M, unsigned int N,
+                              const float *cos_table, const float *sin_table, unsigned int radix, float32x2_t *scratch)
+{
+    float32x2_t *w_r  = scratch;
+    float32x2_t *v    = w_r + radix;
+    float32x2_t *sum  = v + radix;
+    float32x2_t *diff = sum + radix / 2 + 1;
+
+    float32x2_t w{ 1.0f, 0.0f };
+    for(unsigned int j = 0; j < Nx; j++)
+    {
+        // Twiddle factors of the stage
+        w_r[0] = float32x2_t{ 1.0f, 0.0f };
+        for(unsigned int r = 1; r < radix; ++r)
+        {
+            w_r[r] = c_mul_neon(w_r[r - 1], w);
+        }
+
+        for(unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
+        {
+            // Load inputs
+            v[0] = wrapper::vload(x + M * k);
+            for(unsigned int r = 1; r < radix; ++r)
+            {
+                v[r] = c_mul_neon(w_r[r], wrapper::vload(x + M * (k + 2 * r * Nx)));
+            }
+
+            // Base-case prime transform
+            fft_generic(v, sum, diff, cos_table, sin_table, radix);
+
+            // Store outputs
+            for(unsigned int r = 0; r < radix; ++r)
+            {
+                wrapper::vstore(X + M * (k + 2 * r * Nx), v[r]);
+            }
+        }
+
+        w = c_mul_neon(w, w_m);
+    }
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRadixStageKernelInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(config.axis > 1);
-    ARM_COMPUTE_RETURN_ERROR_ON(NEFFTRadixStageKernel::supported_radix().count(config.radix) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(!NEFFTRadixStageKernel::is_radix_supported(config.radix));
     ARM_COMPUTE_UNUSED(config);
 
     // Checks performed when output is configured
@@ -935,7 +1053,7 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 } // namespace
 
 NEFFTRadixStageKernel::NEFFTRadixStageKernel()
-    : _input(nullptr), _output(nullptr), _run_in_place(false), _Nx(0), _axis(0), _radix(0), _func_0(), _func_1()
+    : _input(nullptr), _output(nullptr), _run_in_place(false), _Nx(0), _axis(0), _radix(0), _cos_table(), _sin_table(), _func_0(), _func_1()
 {
 }
 
@@ -961,7 +1079,8 @@ void NEFFTRadixStageKernel::set_radix_stage_axis0(const FFTRadixStageKernelInfo
         fft_table_axis0[8][true] = &fft_radix_8_axes_0<true>;
     }
 
-    _func_0 = fft_table_axis0[config.radix][config.is_first_stage];
+    // The generic stage is run directly by run() with per-thread scratch memory
+    _func_0 = (supported_radix().count(config.radix) != 0) ? fft_table_axis0[config.radix][config.is_first_stage] : nullptr;
 }
 
 void NEFFTRadixStageKernel::set_radix_stage_axis1(const FFTRadixStageKernelInfo &config)
@@ -979,7 +1098,8 @@ void NEFFTRadixStageKernel::set_radix_stage_axis1(const FFTRadixStageKernelInfo
         fft_table_axis1[8] = &fft_radix_8_axes_1;
     }
 
-    _func_1 = fft_table_axis1[config.radix];
+    // The generic stage is run directly by run() with per-thread scratch memory
+    _func_1 = (supported_radix().count(config.radix) != 0) ? fft_table_axis1[config.radix] : nullptr;
 }
 
 void NEFFTRadixStageKernel::configure(ITensor *input, ITensor *output, const FFTRadixStageKernelInfo &config)
@@ -1001,6 +1121,21 @@ void NEFFTRadixStageKernel::configure(ITensor *input, ITensor *output, const FFT
     _axis         = config.axis;
     _radix        = config.radix;
 
+    // Roots of unity used by the generic radix stage
+    _cos_table.clear();
+    _sin_table.clear();
+    if(supported_radix().count(config.radix) == 0)
+    {
+        _cos_table.resize(config.radix);
+        _sin_table.resize(config.radix);
+        for(unsigned int q = 0; q < config.radix; ++q)
+        {
+            const double theta = 2.0 * M_PI * q / config.radix;
+            _cos_table[q]      = static_cast<float>(std::cos(theta));
+            _sin_table[q]      = static_cast<float>(std::sin(theta));
+        }
+    }
+
     switch(config.axis)
     {
         case 0:
@@ -1037,6 +1172,12 @@ std::set<unsigned int> NEFFTRadixStageKernel::supported_radix()
     return std::set<unsigned int> { 2, 3, 4, 5, 7, 8 };
 }
 
+bool NEFFTRadixStageKernel::is_radix_supported(unsigned int radix)
+{
+    // Radix without a specialised stage are handled by the generic odd radix stage
+    return (supported_radix().count(radix) != 0) || (radix > 1 && (radix % 2) != 0);
+}
+
 void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -1054,12 +1195,24 @@ void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
     const float        alpha   = 2.0f * kPi / float(NxRadix);
     const float32x2_t  w_m{ cosf(alpha), -sinf(alpha) };
 
+    // Twiddle factors, inputs, sums and differences of the generic stage, allocated once for all the rows of the window
+    const bool               is_generic = !_cos_table.empty();
+    std::vector<float32x2_t> scratch(is_generic ? 2 * _radix + 2 * (_radix / 2 + 1) : 0);
+
     if(_axis == 0)
     {
         const unsigned int N = _input->info()->dimension(0);
         execute_window_loop(input_window, [&](const Coordinates &)
         {
-            _func_0(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N);
+            if(is_generic)
+            {
+                fft_radix_generic_axes_0(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N,
+                                         _cos_table.data(), _sin_table.data(), _radix, scratch.data());
+            }
+            else
+            {
+                _func_0(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N);
+            }
         },
         in, out);
     }
@@ -1069,7 +1222,15 @@ void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
         const unsigned int M = _input->info()->dimension(1);
         execute_window_loop(input_window, [&](const Coordinates &)
         {
-            _func_1(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N, M);
+            if(is_generic)
+            {
+                fft_radix_generic_axes_1(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N, M,
+                                         _cos_table.data(), _sin_table.data(), _radix, scratch.data());
+            }
+            else
+            {
+                _func_1(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N, M);
+            }
         },
         in, out);
     }
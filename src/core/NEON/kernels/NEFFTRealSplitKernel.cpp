@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFFTRealSplitKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+float32x2_t c_mul_neon(float32x2_t a, float32x2_t b)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<float, 2>::tag_type;
+
+    const float32x2_t mask = { -1.0, 1.0 };
+    const float32x2_t tmp0 = wrapper::vdup_n(wrapper::vgetlane(a, 0), ExactTagType{});
+    const float32x2_t tmp1 = wrapper::vdup_n(wrapper::vgetlane(a, 1), ExactTagType{});
+
+    float32x2_t res = wrapper::vmul(tmp0, b);
+
+    b   = wrapper::vrev64(b);
+    b   = wrapper::vmul(b, mask);
+    res = wrapper::vmla(res, tmp1, b);
+
+    return res;
+}
+
+float32x2_t c_mul_neon_img(float32x2_t a, float img_constant)
+{
+    const float a_r = wrapper::vgetlane(a, 0);
+    const float a_i = wrapper::vgetlane(a, 1);
+
+    const auto out = wrapper::vmul(float32x2_t{ -a_i, a_r }, float32x2_t{ img_constant, img_constant });
+    return out;
+}
+
+float32x2_t c_conj_neon(float32x2_t a)
+{
+    return wrapper::vmul(a, float32x2_t{ 1.0f, -1.0f });
+}
+
+void split_row(const float *in, float *out, const float *twiddles, unsigned int N)
+{
+    const float32x2_t half = { 0.5f, 0.5f };
+    for(unsigned int k = 0; k <= N; ++k)
+    {
+        // Even and odd parts of the real sequence
+        const float32x2_t a = wrapper::vload(in + 2 * (k == N ? 0 : k));
+        const float32x2_t b = c_conj_neon(wrapper::vload(in + 2 * (k == 0 ? 0 : N - k)));
+        const float32x2_t e = wrapper::vmul(wrapper::vadd(a, b), half);
+        const float32x2_t o = c_mul_neon_img(wrapper::vmul(wrapper::vsub(a, b), half), -1.f);
+
+        wrapper::vstore(out + 2 * k, wrapper::vadd(e, c_mul_neon(wrapper::vload(twiddles + 2 * k), o)));
+    }
+}
+
+void merge_row(const float *in, float *out, const float *twiddles, unsigned int N)
+{
+    const float32x2_t half = { 0.5f, 0.5f };
+    for(unsigned int k = 0; k < N; ++k)
+    {
+        // Even and odd parts of the real sequence
+        const float32x2_t a = wrapper::vload(in + 2 * k);
+        const float32x2_t b = c_conj_neon(wrapper::vload(in + 2 * (N - k)));
+        const float32x2_t e = wrapper::vmul(wrapper::vadd(a, b), half);
+        const float32x2_t o = c_mul_neon(c_conj_neon(wrapper::vload(twiddles + 2 * k)), wrapper::vmul(wrapper::vsub(a, b), half));
+
+        wrapper::vstore(out + 2 * k, wrapper::vadd(e, c_mul_neon_img(o, 1.f)));
+    }
+}
+
+TensorShape compute_output_shape(const ITensorInfo *input, const FFTRealSplitKernelInfo &config)
+{
+    TensorShape output_shape = input->tensor_shape();
+    output_shape.set(0, config.inverse ? input->dimension(0) - 1 : input->dimension(0) + 1);
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRealSplitKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) < (config.inverse ? 2U : 1U));
+
+    // Checks performed when output is configured
+    if((output != nullptr) && (output->total_size() != 0))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(input, config));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFTRealSplitKernelInfo &config)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_output_shape(input, config)));
+
+    // A row is processed at each step
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // NEFFTRealSplitKernel doesn't need padding so update_window_and_padding() can be skipped
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTRealSplitKernel::NEFFTRealSplitKernel()
+    : _input(nullptr), _output(nullptr), _inverse(false), _twiddles()
+{
+}
+
+void NEFFTRealSplitKernel::configure(const ITensor *input, ITensor *output, const FFTRealSplitKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input   = input;
+    _output  = output;
+    _inverse = config.inverse;
+
+    // Twiddle factors exp(-i * 2 * pi * k / (2 * N)) of the full length real sequence
+    const unsigned int N = config.inverse ? input->info()->dimension(0) - 1 : input->info()->dimension(0);
+    _twiddles.resize(2 * (N + 1));
+    for(unsigned int k = 0; k <= N; ++k)
+    {
+        const double theta   = M_PI * k / N;
+        _twiddles[2 * k]     = static_cast<float>(std::cos(theta));
+        _twiddles[2 * k + 1] = static_cast<float>(-std::sin(theta));
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEFFTRealSplitKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealSplitKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), config).first);
+
+    return Status{};
+}
+
+void NEFFTRealSplitKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    const unsigned int N = _inverse ? _output->info()->dimension(0) : _input->info()->dimension(0);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        if(_inverse)
+        {
+            merge_row(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), _twiddles.data(), N);
+        }
+        else
+        {
+            split_row(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), _twiddles.data(), N);
+        }
+    },
+    in, out);
+}
+} // namespace arm_compute
@@ -49,15 +49,27 @@ void scale_complex(float *c_in, float *c_out, bool is_conjugate, float scale)
     wrapper::vstore(c_out, b);
 }
 
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTScaleKernelInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.is_packed_real && ((output == nullptr) || (output == input)));
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1 && output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        if(config.is_packed_real)
+        {
+            TensorShape packed_shape = input->tensor_shape();
+            packed_shape.set(0, 2 * input->dimension(0));
+
+            ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), packed_shape);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -85,20 +97,21 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 } // namespace
 
 NEFFTScaleKernel::NEFFTScaleKernel()
-    : _input(nullptr), _output(nullptr), _scale(), _run_in_place(false), _is_conj(false)
+    : _input(nullptr), _output(nullptr), _scale(), _run_in_place(false), _is_conj(false), _is_packed_real(false)
 {
 }
 
 void NEFFTScaleKernel::configure(ITensor *input, ITensor *output, const FFTScaleKernelInfo &config)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr, config));
 
-    _input        = input;
-    _output       = output;
-    _run_in_place = (output == nullptr) || (output == input);
-    _is_conj      = config.conjugate;
-    _scale        = config.scale;
+    _input          = input;
+    _output         = output;
+    _run_in_place   = (output == nullptr) || (output == input);
+    _is_conj        = config.conjugate;
+    _scale          = config.scale;
+    _is_packed_real = config.is_packed_real;
 
     // Configure kernel window
     auto win_config = validate_and_configure_window(input->info(), _run_in_place ? nullptr : output->info());
@@ -108,8 +121,7 @@ void NEFFTScaleKernel::configure(ITensor *input, ITensor *output, const FFTScale
 
 Status NEFFTScaleKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTScaleKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(config);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get()).first);
 
     return Status{};
@@ -127,6 +139,25 @@ void NEFFTScaleKernel::run(const Window &window, const ThreadInfo &info)
     Iterator in(_input, input_window);
     Iterator out(_run_in_place ? _input : _output, input_window);
 
+    if(_is_packed_real)
+    {
+        // Complex element x is stored as the real elements 2x and 2x + 1 of the output row
+        const int start_x = window.x().start();
+        const int end_x   = window.x().end();
+
+        execute_window_loop(input_window, [&](const Coordinates &)
+        {
+            auto in_ptr  = reinterpret_cast<float *>(in.ptr());
+            auto out_ptr = reinterpret_cast<float *>(out.ptr());
+            for(int x = start_x; x < end_x; ++x)
+            {
+                scale_complex(in_ptr + 2 * x, out_ptr + 2 * x, _is_conj, _scale);
+            }
+        },
+        in, out);
+        return;
+    }
+
     execute_window_loop(window, [&](const Coordinates &)
     {
         scale_complex(reinterpret_cast<float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), _is_conj, _scale);
@@ -378,7 +378,8 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     }
     // Set step_x and step_y for matrix B. Scale by a factor of 4 the X range as the input transposed matrix A has 4 times less the cols of the output matrix
     // The step along the x direction is 2 times the in_b_stride because for each iteration we compute 2 blocks of size 4x4
-    win_b.set(Window::DimX, Window::Dimension(window.x().start() / 4, window.x().end() / 4, 2 * in_b_stride));
+    // Each row of the transposed matrix B holds 4 columns of the output matrix, so the window may start in the middle of the output rows
+    win_b.set(Window::DimX, Window::Dimension((window.x().start() / 4) * in_b_stride, (window.x().end() / 4) * in_b_stride, 2 * in_b_stride));
     win_b.set(Window::DimY, Window::Dimension(0, 0, 0));
 
     Iterator ina(input0, win_a);
@@ -678,7 +679,8 @@ void matrix_matrix_multiply_f16(const ITensor *input0, const ITensor *input1, IT
         win_b = window;
     }
     // Set step_x and step_y for matrix B. Scale by a factor of 8 the X range as the input transposed matrix A has 8 times less the cols of the output matrix
-    win_b.set(Window::DimX, Window::Dimension(window.x().start() / 8, window.x().end() / 8, in_b_stride));
+    // Each row of the transposed matrix B holds 8 columns of the output matrix, so the window may start in the middle of the output rows
+    win_b.set(Window::DimX, Window::Dimension((window.x().start() / 8) * in_b_stride, (window.x().end() / 8) * in_b_stride, in_b_stride));
     win_b.set(Window::DimY, Window::Dimension(0, 1, 0));
 
     Iterator ina(input0, win_a);
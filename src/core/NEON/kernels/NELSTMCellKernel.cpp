@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+Status validate_arguments(const ITensorInfo *scratch_buffer, const ITensorInfo *cell_state_in, const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights,
+                          const ITensorInfo *cell_to_output_weights, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(scratch_buffer, cell_state_in, cell_state_out, output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scratch_buffer, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scratch_buffer, cell_state_in);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_threshold < 0.f);
+
+    const unsigned int num_cells = cell_state_in->dimension(0);
+    const bool         has_cifg  = scratch_buffer->dimension(0) == num_cells * 3;
+    ARM_COMPUTE_RETURN_ERROR_ON(!has_cifg && scratch_buffer->dimension(0) != num_cells * 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(scratch_buffer->dimension(1) != cell_state_in->dimension(1));
+
+    // Check peephole weights
+    ARM_COMPUTE_RETURN_ERROR_ON((cell_to_forget_weights == nullptr) != (cell_to_output_weights == nullptr));
+    if(cell_to_forget_weights != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(!has_cifg && cell_to_input_weights == nullptr);
+        for(const ITensorInfo *weights : { cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights })
+        {
+            if(weights != nullptr)
+            {
+                ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scratch_buffer, weights);
+                ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 1);
+                ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != num_cells);
+            }
+        }
+    }
+
+    // Checks performed when outputs are configured
+    for(const ITensorInfo *output : { cell_state_out, output_state_out })
+    {
+        if(output->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, output);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(cell_state_in, output);
+        }
+    }
+
+    return Status{};
+}
+
+/** Applies an activation function to a vector
+ *
+ * @param[in] in      Input vector
+ * @param[in] act     Activation function
+ * @param[in] va      Vector filled with the alpha parameter of the activation
+ * @param[in] vb      Vector filled with the beta parameter of the activation
+ * @param[in] const_0 Vector filled with 0
+ * @param[in] const_1 Vector filled with 1
+ *
+ * @return The activated vector
+ */
+template <typename V>
+inline V activate(const V &in, ActivationFunction act, const V &va, const V &vb, const V &const_0, const V &const_1)
+{
+    switch(act)
+    {
+        case ActivationFunction::ABS:
+            return wrapper::vabs(in);
+        case ActivationFunction::LINEAR:
+            return wrapper::vmla(vb, va, in);
+        case ActivationFunction::LOGISTIC:
+            return wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(in))));
+        case ActivationFunction::RELU:
+            return wrapper::vmax(const_0, in);
+        case ActivationFunction::BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(const_0, in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return wrapper::vmin(va, wrapper::vmax(vb, in));
+        case ActivationFunction::LEAKY_RELU:
+            return wrapper::vbsl(wrapper::vcgt(in, const_0), in, wrapper::vmul(va, in));
+        case ActivationFunction::SOFT_RELU:
+            return wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(in)));
+        case ActivationFunction::SQRT:
+            return wrapper::vinv(wrapper::vinvsqrt(in));
+        case ActivationFunction::SQUARE:
+            return wrapper::vmul(in, in);
+        case ActivationFunction::TANH:
+            return wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, in)));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return in;
+    }
+}
+
+/** Applies an activation function to a scalar
+ *
+ * @param[in] in  Input value
+ * @param[in] act Activation function
+ * @param[in] a   Alpha parameter of the activation
+ * @param[in] b   Beta parameter of the activation
+ *
+ * @return The activated value
+ */
+template <typename T>
+inline T activate(T in, ActivationFunction act, T a, T b)
+{
+    switch(act)
+    {
+        case ActivationFunction::ABS:
+            return std::abs(in);
+        case ActivationFunction::LINEAR:
+            return a * in + b;
+        case ActivationFunction::LOGISTIC:
+            return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in));
+        case ActivationFunction::RELU:
+            return std::max<T>(static_cast<T>(0), in);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(static_cast<T>(0), in));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min<T>(a, std::max<T>(b, in));
+        case ActivationFunction::LEAKY_RELU:
+            return (in > 0) ? in : a * in;
+        case ActivationFunction::SOFT_RELU:
+            return std::log(static_cast<T>(1) + std::exp(in));
+        case ActivationFunction::SQRT:
+            return std::sqrt(in);
+        case ActivationFunction::SQUARE:
+            return in * in;
+        case ActivationFunction::TANH:
+            return a * std::tanh(b * in);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return in;
+    }
+}
+} // namespace
+
+NELSTMCellKernel::NELSTMCellKernel()
+    : _func(nullptr), _scratch_buffer(nullptr), _cell_state_in(nullptr), _cell_to_input_weights(nullptr), _cell_to_forget_weights(nullptr), _cell_to_output_weights(nullptr), _cell_state_out(nullptr),
+      _output_state_out(nullptr), _activation_info(), _cell_threshold(0.f)
+{
+}
+
+void NELSTMCellKernel::configure(ITensor *scratch_buffer, const ITensor *cell_state_in, const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights,
+                                 const ITensor *cell_to_output_weights, ITensor *cell_state_out, ITensor *output_state_out, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(scratch_buffer, cell_state_in, cell_state_out, output_state_out);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*cell_state_out->info(), *cell_state_in->info()->clone());
+    auto_init_if_empty(*output_state_out->info(), *cell_state_in->info()->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(scratch_buffer->info(), cell_state_in->info(),
+                                                  (cell_to_input_weights != nullptr) ? cell_to_input_weights->info() : nullptr,
+                                                  (cell_to_forget_weights != nullptr) ? cell_to_forget_weights->info() : nullptr,
+                                                  (cell_to_output_weights != nullptr) ? cell_to_output_weights->info() : nullptr,
+                                                  cell_state_out->info(), output_state_out->info(), cell_threshold));
+
+    _scratch_buffer         = scratch_buffer;
+    _cell_state_in          = cell_state_in;
+    _cell_to_input_weights  = cell_to_input_weights;
+    _cell_to_forget_weights = cell_to_forget_weights;
+    _cell_to_output_weights = cell_to_output_weights;
+    _cell_state_out         = cell_state_out;
+    _output_state_out       = output_state_out;
+    _activation_info        = activation_info;
+    _cell_threshold         = cell_threshold;
+
+    switch(scratch_buffer->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NELSTMCellKernel::run_lstm_cell<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NELSTMCellKernel::run_lstm_cell<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // Configure kernel window, NELSTMCellKernel doesn't need padding so update_window_and_padding() can be skipped
+    Window win = calculate_max_window(*cell_state_in->info(), Steps());
+
+    Coordinates coord;
+    coord.set_num_dimensions(cell_state_out->info()->num_dimensions());
+    cell_state_out->info()->set_valid_region(ValidRegion(coord, cell_state_out->info()->tensor_shape()));
+    output_state_out->info()->set_valid_region(ValidRegion(coord, output_state_out->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NELSTMCellKernel::validate(const ITensorInfo *scratch_buffer, const ITensorInfo *cell_state_in, const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights,
+                                  const ITensorInfo *cell_to_output_weights, const ITensorInfo *cell_state_out, const ITensorInfo *output_state_out, const ActivationLayerInfo &activation_info,
+                                  float cell_threshold)
+{
+    ARM_COMPUTE_UNUSED(activation_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(scratch_buffer, cell_state_in, cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights, cell_state_out, output_state_out,
+                                                   cell_threshold));
+    return Status{};
+}
+
+template <typename T>
+void NELSTMCellKernel::run_lstm_cell(const Window &window)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const int  window_step_x  = 16 / sizeof(T);
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    const int  num_cells     = _cell_state_in->info()->dimension(0);
+    const bool has_cifg      = _scratch_buffer->info()->dimension(0) == static_cast<size_t>(num_cells) * 3;
+    const bool has_peephole  = _cell_to_forget_weights != nullptr;
+    const bool has_clipping  = _cell_threshold != 0.f;
+    const int  cell_offset   = has_cifg ? 0 : num_cells;
+    const int  forget_offset = cell_offset + num_cells;
+    const int  output_offset = forget_offset + num_cells;
+
+    const T *cell_to_input_w  = (has_peephole && !has_cifg) ? reinterpret_cast<const T *>(_cell_to_input_weights->ptr_to_element(Coordinates(0))) : nullptr;
+    const T *cell_to_forget_w = has_peephole ? reinterpret_cast<const T *>(_cell_to_forget_weights->ptr_to_element(Coordinates(0))) : nullptr;
+    const T *cell_to_output_w = has_peephole ? reinterpret_cast<const T *>(_cell_to_output_weights->ptr_to_element(Coordinates(0))) : nullptr;
+
+    const ActivationFunction act     = _activation_info.activation();
+    const auto               a       = static_cast<T>(_activation_info.a());
+    const auto               b       = static_cast<T>(_activation_info.b());
+    const auto               clip    = static_cast<T>(_cell_threshold);
+    const auto               const_0 = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    const auto               const_1 = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
+    const auto               va      = wrapper::vdup_n(a, ExactTagType{});
+    const auto               vb      = wrapper::vdup_n(b, ExactTagType{});
+    const auto               vclip   = wrapper::vdup_n(clip, ExactTagType{});
+
+    const auto sigmoid = [&](const decltype(const_1) & in)
+    {
+        return wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(in))));
+    };
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator scratch(_scratch_buffer, win);
+    Iterator cell_in(_cell_state_in, win);
+    Iterator cell_out(_cell_state_out, win);
+    Iterator output_out(_output_state_out, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto gates_ptr      = reinterpret_cast<T *>(scratch.ptr());
+        const auto cell_in_ptr    = reinterpret_cast<const T *>(cell_in.ptr());
+        const auto cell_out_ptr   = reinterpret_cast<T *>(cell_out.ptr());
+        const auto output_out_ptr = reinterpret_cast<T *>(output_out.ptr());
+
+        // Compute S elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const auto c_prev = wrapper::vloadq(cell_in_ptr + x);
+
+            auto forget_gate = wrapper::vloadq(gates_ptr + forget_offset + x);
+            auto output_gate = wrapper::vloadq(gates_ptr + output_offset + x);
+            auto input_gate  = const_0;
+            if(has_peephole)
+            {
+                forget_gate = wrapper::vmla(forget_gate, c_prev, wrapper::vloadq(cell_to_forget_w + x));
+            }
+            forget_gate = sigmoid(forget_gate);
+            if(has_cifg)
+            {
+                input_gate = wrapper::vsub(const_1, forget_gate);
+            }
+            else
+            {
+                input_gate = wrapper::vloadq(gates_ptr + x);
+                if(has_peephole)
+                {
+                    input_gate = wrapper::vmla(input_gate, c_prev, wrapper::vloadq(cell_to_input_w + x));
+                }
+                input_gate = sigmoid(input_gate);
+                wrapper::vstore(gates_ptr + x, input_gate);
+            }
+
+            const auto cell_gate = activate(wrapper::vloadq(gates_ptr + cell_offset + x), act, va, vb, const_0, const_1);
+            auto       cell      = wrapper::vmla(wrapper::vmul(forget_gate, c_prev), input_gate, cell_gate);
+            if(has_clipping)
+            {
+                cell = wrapper::vmin(vclip, wrapper::vmax(wrapper::vneg(vclip), cell));
+            }
+            if(has_peephole)
+            {
+                output_gate = wrapper::vmla(output_gate, cell, wrapper::vloadq(cell_to_output_w + x));
+            }
+            output_gate = sigmoid(output_gate);
+
+            wrapper::vstore(gates_ptr + cell_offset + x, cell);
+            wrapper::vstore(gates_ptr + forget_offset + x, forget_gate);
+            wrapper::vstore(gates_ptr + output_offset + x, output_gate);
+            wrapper::vstore(cell_out_ptr + x, cell);
+            wrapper::vstore(output_out_ptr + x, wrapper::vmul(output_gate, activate(cell, act, va, vb, const_0, const_1)));
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const T c_prev = cell_in_ptr[x];
+
+            T forget_gate = gates_ptr[forget_offset + x];
+            T output_gate = gates_ptr[output_offset + x];
+            T input_gate  = static_cast<T>(0);
+            if(has_peephole)
+            {
+                forget_gate += c_prev * cell_to_forget_w[x];
+            }
+            forget_gate = activate<T>(forget_gate, ActivationFunction::LOGISTIC, a, b);
+            if(has_cifg)
+            {
+                input_gate = static_cast<T>(1) - forget_gate;
+            }
+            else
+            {
+                input_gate = gates_ptr[x];
+                if(has_peephole)
+                {
+                    input_gate += c_prev * cell_to_input_w[x];
+                }
+                input_gate   = activate<T>(input_gate, ActivationFunction::LOGISTIC, a, b);
+                gates_ptr[x] = input_gate;
+            }
+
+            T cell = forget_gate * c_prev + input_gate * activate<T>(gates_ptr[cell_offset + x], act, a, b);
+            if(has_clipping)
+            {
+                cell = std::min<T>(clip, std::max<T>(-clip, cell));
+            }
+            if(has_peephole)
+            {
+                output_gate += cell * cell_to_output_w[x];
+            }
+            output_gate = activate<T>(output_gate, ActivationFunction::LOGISTIC, a, b);
+
+            gates_ptr[cell_offset + x]   = cell;
+            gates_ptr[forget_offset + x] = forget_gate;
+            gates_ptr[output_offset + x] = output_gate;
+            cell_out_ptr[x]              = cell;
+            output_out_ptr[x]            = output_gate * activate<T>(cell, act, a, b);
+        }
+    },
+    scratch, cell_in, cell_out, output_out);
+}
+
+void NELSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -31,6 +31,7 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/core/NEON/kernels/assembly/gemm_common.hpp"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "support/ToolchainSupport.h"
 
@@ -50,7 +51,7 @@ Status validate_arguments_winograd_weight_trans(const ITensorInfo *input, const
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
 
     const size_t idx_width    = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_height   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -104,7 +105,7 @@ Status validate_arguments_winograd_input_trans(const ITensorInfo *input, const I
     const PadStrideInfo &conv_info   = winograd_info.convolution_info;
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd input transform only supports unit strides");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
@@ -157,12 +158,12 @@ Status validate_arguments_winograd_output_trans(const ITensorInfo *input, const
 
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != num_tiles.area());
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
 
-    const std::array<unsigned int, 3> supported_gemm_sizes = { { 8U, 16U, 36U } };
+    const std::array<unsigned int, 4> supported_gemm_sizes = { { 8U, 16U, 36U, 64U } };
     ARM_COMPUTE_RETURN_ERROR_ON(std::end(supported_gemm_sizes) == std::find(std::begin(supported_gemm_sizes), std::end(supported_gemm_sizes), input->dimension(2)));
     ARM_COMPUTE_UNUSED(kernel_dims);
     if(bias != nullptr)
@@ -211,10 +212,9 @@ std::pair<Status, Window> validate_and_configure_window_winograd_output_trans(IT
 }
 } // namespace
 
-template <typename T>
-Status INEWinogradLayerTransformWeightsKernel<T>::validate(const ITensorInfo *input, const ITensorInfo *weights)
+Status INEWinogradLayerTransformWeightsKernel::validate(const ITensorInfo *input, const ITensorInfo *weights)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     const DataLayout   data_layout = input->data_layout();
     const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
@@ -225,8 +225,6 @@ Status INEWinogradLayerTransformWeightsKernel<T>::validate(const ITensorInfo *in
     return Status{};
 }
 
-template class INEWinogradLayerTransformWeightsKernel<float>;
-
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 unsigned int NEWinogradLayerTransformWeightsKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::get_weight_storage_size(int num_output_channels, int num_input_channels) const
 {
@@ -304,6 +302,7 @@ Status NEWinogradLayerTransformWeightsKernel<T, OutputTileRows, OutputTileCols,
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformWeightsKernel<float, 4, 4, 3, 3>;
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 2, 5, 5>;
+template class NEWinogradLayerTransformWeightsKernel<float, 4, 4, 5, 5>;
 template class NEWinogradLayerTransformWeightsKernel<float, 1, 6, 1, 3>;
 template class NEWinogradLayerTransformWeightsKernel<float, 6, 1, 3, 1>;
 
@@ -311,6 +310,12 @@ template class NEWinogradLayerTransformWeightsKernel<float, 1, 4, 1, 5>;
 template class NEWinogradLayerTransformWeightsKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformWeightsKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 1, 7, 1>;
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformWeightsKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformWeightsKernel<float16_t, 4, 4, 3, 3>;
+template class NEWinogradLayerTransformWeightsKernel<float16_t, 2, 2, 5, 5>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 // Input transform
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -389,6 +394,8 @@ void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kern
                      _padding_bottom, /**< Padding to apply to the bottom of the image. */
                      _padding_right   /**< Padding to apply to the right of the image. */
                  );
+    // The row stride of the matrices is needed to transform bands of rows of tiles
+    _transform->set_output_matrices(nullptr, matrix_stride, num_channels);
 
     Window win;
     auto   win_last = _transform->get_window();
@@ -422,6 +429,24 @@ void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kern
     _transform->run(fst, lst, info.thread_id);
 }
 
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::run_tile_rows(int batch, int first_tile_row, int last_tile_row, void *matrices, int matrix_stride,
+                                                                                                                   const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_workspace, matrices);
+
+    const int  element_size_in_bytes = _input_nhwc->info()->element_size();
+    const int  input_col_stride      = _input_nhwc->info()->strides_in_bytes().y() / element_size_in_bytes;
+    const int  input_row_stride      = _input_nhwc->info()->strides_in_bytes().z() / element_size_in_bytes;
+    const int  input_batch_stride    = _input_nhwc->info()->strides_in_bytes()[3] / element_size_in_bytes;
+    const auto input_nhwc_ptr        = reinterpret_cast<const T *>(_input_nhwc->buffer() + _input_nhwc->info()->offset_first_element_in_bytes());
+
+    _transform->set_input_tensor(input_nhwc_ptr, input_batch_stride, input_row_stride, input_col_stride);
+    _transform->set_working_space(_workspace->buffer());
+    _transform->run_tile_rows(batch, first_tile_row, last_tile_row, matrices, matrix_stride, info.thread_id);
+}
+
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 Status NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::validate(const ITensorInfo *input, const ITensorInfo *output, const WinogradInfo &winograd_info)
 {
@@ -434,6 +459,7 @@ Status NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Ke
 template class NEWinogradLayerTransformInputKernel<float, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformInputKernel<float, 4, 4, 3, 3>;
 template class NEWinogradLayerTransformInputKernel<float, 2, 2, 5, 5>;
+template class NEWinogradLayerTransformInputKernel<float, 4, 4, 5, 5>;
 template class NEWinogradLayerTransformInputKernel<float, 1, 6, 1, 3>;
 template class NEWinogradLayerTransformInputKernel<float, 6, 1, 3, 1>;
 
@@ -442,6 +468,12 @@ template class NEWinogradLayerTransformInputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformInputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformInputKernel<float, 2, 1, 7, 1>;
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformInputKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformInputKernel<float16_t, 4, 4, 3, 3>;
+template class NEWinogradLayerTransformInputKernel<float16_t, 2, 2, 5, 5>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
 // Output transform
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -513,6 +545,8 @@ void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, Ker
     _num_channels       = num_channels;
     // We don't have the biases buffer at this stage as it hasn't been allocated, we pass in nullptr OutputTransform is only used here to compute the window
     _transform = arm_compute::support::cpp14::make_unique<OutputTransform>(num_batches, num_rows, num_cols, num_channels);
+    // The row stride of the matrices is needed to transform bands of rows of tiles
+    _transform->set_input_matrices(nullptr, matrix_stride, _matrix_row_stride);
     Window win;
     auto   win_last = _transform->get_window();
     win.set(Window::DimX, Window::Dimension(0, win_last, 1));
@@ -544,6 +578,23 @@ void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, Ker
     _transform->run(fst, lst, info.thread_id);
 }
 
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::run_tile_rows(int batch, int first_tile_row, int last_tile_row, const void *matrices,
+                                                                                                                    int matrix_stride, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_workspace, _output_nhwc, matrices);
+
+    const int out_batch_stride = _output_nhwc->info()->strides_in_bytes()[3] / sizeof(T);
+    const int out_row_stride   = _output_nhwc->info()->strides_in_bytes()[2] / sizeof(T);
+    const int out_col_stride   = _output_nhwc->info()->strides_in_bytes()[1] / sizeof(T);
+
+    _transform->set_bias((_biases ? reinterpret_cast<T *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr));
+    _transform->set_output_tensor(_output_nhwc->buffer() + _output_nhwc->info()->offset_first_element_in_bytes(), out_batch_stride, out_row_stride, out_col_stride);
+    _transform->set_working_space(_workspace->buffer());
+    _transform->run_tile_rows(batch, first_tile_row, last_tile_row, matrices, matrix_stride, info.thread_id);
+}
+
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 Status NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output,
                                                                                                                  const WinogradInfo &winograd_info)
@@ -559,6 +610,7 @@ Status NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, K
 template class NEWinogradLayerTransformOutputKernel<float, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformOutputKernel<float, 4, 4, 3, 3>;
 template class NEWinogradLayerTransformOutputKernel<float, 2, 2, 5, 5>;
+template class NEWinogradLayerTransformOutputKernel<float, 4, 4, 5, 5>;
 template class NEWinogradLayerTransformOutputKernel<float, 1, 6, 1, 3>;
 template class NEWinogradLayerTransformOutputKernel<float, 6, 1, 3, 1>;
 
@@ -567,4 +619,106 @@ template class NEWinogradLayerTransformOutputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformOutputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformOutputKernel<float, 2, 1, 7, 1>;
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformOutputKernel<float16_t, 2, 2, 3, 3>;
+template class NEWinogradLayerTransformOutputKernel<float16_t, 4, 4, 3, 3>;
+template class NEWinogradLayerTransformOutputKernel<float16_t, 2, 2, 5, 5>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+// Streaming of the transforms and the batched GEMM
+
+NEWinogradLayerStreamingKernel::NEWinogradLayerStreamingKernel()
+    : _transform_input(nullptr), _transform_output(nullptr), _gemms(), _weights(nullptr), _workspace(nullptr), _num_tile_rows(0), _band_rows(0), _num_bands(0), _input_matrix_row_stride(0),
+      _output_matrix_row_stride(0), _input_matrix_stride(0), _output_matrix_stride(0), _input_storage_size(0), _output_storage_size(0), _thread_storage_size(0)
+{
+}
+
+int NEWinogradLayerStreamingKernel::get_band_rows(int num_tile_cols, int num_gemms, int input_matrix_row_stride, int output_matrix_row_stride, size_t element_size, size_t cache_size)
+{
+    const size_t tile_row_size = static_cast<size_t>(num_tile_cols) * num_gemms * (input_matrix_row_stride + output_matrix_row_stride) * element_size;
+    return std::max(1, static_cast<int>(cache_size / tile_row_size));
+}
+
+void NEWinogradLayerStreamingKernel::configure(INEWinogradLayerTransformInputKernel *transform_input, INEWinogradLayerTransformOutputKernel *transform_output,
+                                               std::vector<arm_gemm::IGemmCommon *> gemms, const ITensor *weights, ITensor *workspace, int num_batches, int num_tile_rows,
+                                               int num_tile_cols, int band_rows, int num_gemms, int input_matrix_row_stride, int output_matrix_row_stride)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(transform_input, transform_output, weights, workspace);
+    ARM_COMPUTE_ERROR_ON(gemms.empty());
+    ARM_COMPUTE_ERROR_ON(band_rows <= 0);
+
+    // Buffers of each thread are aligned as the tensors storing the transformed matrices of the non streaming mode
+    constexpr size_t storage_alignment = 64;
+    const size_t     element_size      = weights->info()->element_size();
+    const int        band_tiles        = band_rows * num_tile_cols;
+
+    _transform_input          = transform_input;
+    _transform_output         = transform_output;
+    _gemms                    = std::move(gemms);
+    _weights                  = weights;
+    _workspace                = workspace;
+    _num_tile_rows            = num_tile_rows;
+    _band_rows                = band_rows;
+    _num_bands                = iceildiv(num_tile_rows, band_rows);
+    _input_matrix_row_stride  = input_matrix_row_stride;
+    _output_matrix_row_stride = output_matrix_row_stride;
+    _input_matrix_stride      = band_tiles * input_matrix_row_stride;
+    _output_matrix_stride     = band_tiles * output_matrix_row_stride;
+    _input_storage_size       = roundup(num_gemms * _input_matrix_stride * element_size, storage_alignment);
+    _output_storage_size      = roundup(num_gemms * _output_matrix_stride * element_size, storage_alignment);
+    _thread_storage_size      = _input_storage_size + _output_storage_size + roundup(_gemms[0]->get_working_size(), storage_alignment);
+
+    // Each window step processes a band of rows of tiles of a batch
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_batches * _num_bands, 1));
+    INEKernel::configure(win);
+}
+
+size_t NEWinogradLayerStreamingKernel::get_workspace_size() const
+{
+    return _gemms.size() * _thread_storage_size;
+}
+
+void NEWinogradLayerStreamingKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_workspace->buffer());
+
+    // The GEMMs and the buffers only exist for the number of threads the kernel has been configured for
+    if(static_cast<size_t>(info.thread_id) >= _gemms.size())
+    {
+        ARM_COMPUTE_ERROR("The kernel is run by more threads than it has been configured for");
+    }
+
+    uint8_t *const input_matrices  = _workspace->buffer() + info.thread_id * _thread_storage_size;
+    uint8_t *const output_matrices = input_matrices + _input_storage_size;
+
+    // The B matrix is ignored by the GEMMs using the pretransposed weights
+    arm_gemm::IGemmCommon *gemm           = _gemms[info.thread_id];
+    const size_t           element_size   = _weights->info()->element_size();
+    const uint8_t         *weights        = _weights->buffer() != nullptr ? _weights->buffer() + _weights->info()->offset_first_element_in_bytes() : nullptr;
+    const int              weights_ldb    = _weights->info()->strides_in_bytes()[1] / element_size;
+    const int              weights_stride = _weights->info()->strides_in_bytes()[2] / element_size;
+    gemm->set_arrays_generic(input_matrices, _input_matrix_row_stride, 0, _input_matrix_stride,
+                             weights, weights_ldb, weights_stride,
+                             output_matrices, _output_matrix_row_stride, 0, _output_matrix_stride);
+    if(gemm->get_working_size() != 0)
+    {
+        gemm->set_working_space(output_matrices + _output_storage_size);
+    }
+    const unsigned int gemm_window = gemm->get_window_size();
+
+    for(int band = window.x().start(); band < window.x().end(); ++band)
+    {
+        const int batch          = band / _num_bands;
+        const int first_tile_row = (band % _num_bands) * _band_rows;
+        const int last_tile_row  = std::min(first_tile_row + _band_rows, _num_tile_rows);
+
+        _transform_input->run_tile_rows(batch, first_tile_row, last_tile_row, input_matrices, _input_matrix_stride, info);
+        // Each GEMM is created for a single thread and runs its whole window
+        gemm->execute(0, gemm_window, 0);
+        _transform_output->run_tile_rows(batch, first_tile_row, last_tile_row, output_matrices, _output_matrix_stride, info);
+    }
+}
+
 } // namespace arm_compute
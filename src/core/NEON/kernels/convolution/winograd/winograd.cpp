@@ -228,9 +228,16 @@ template class WinogradGEMM<1, 6, 1, 3, WinogradRoots::Integers>::Convolution<fl
 template class WinogradGEMM<6, 1, 3, 1, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 
 template class WinogradGEMM<2, 2, 5, 5, WinogradRoots::Integers>::Convolution<float, float, float, float>;
+template class WinogradGEMM<4, 4, 5, 5, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 
 template class WinogradGEMM<1, 4, 1, 5, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 template class WinogradGEMM<4, 1, 5, 1, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 
 template class WinogradGEMM<1, 2, 1, 7, WinogradRoots::Integers>::Convolution<float, float, float, float>;
 template class WinogradGEMM<2, 1, 7, 1, WinogradRoots::Integers>::Convolution<float, float, float, float>;
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class WinogradGEMM<2, 2, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+template class WinogradGEMM<4, 4, 3, 3, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+template class WinogradGEMM<2, 2, 5, 5, WinogradRoots::Integers>::Convolution<float16_t, float16_t, float16_t, float16_t>;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
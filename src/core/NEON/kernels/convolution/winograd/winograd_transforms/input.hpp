@@ -169,53 +169,84 @@ MEMBERFN(void)::run(
   // Loop over batches
   for (int batch = 0; batch < _n_batches; batch++)
   {
-    const TIn* const inptr_batch = _inptr + start_channel + batch*_in_batch_stride;
     TOut* const outptr_batch = _outptr + start_channel + batch*_matrix_batch_stride;
 
     // Loop over rows of tiles
     for (int tile_i = 0; tile_i < _tiles_M; tile_i++)
     {
-      // Compute the starting and ending row of pixels within the row of tiles,
-      // hence compute the padding to apply to the top and bottom of each tile.
-      const int row_top = tile_i * (InnerTileRows - _overlap_rows) - _padding_top;
-      const int row_bottom = row_top + InnerTileRows;
-      const int row_pad_top = std::max(0, _padding_top - tile_i * (InnerTileRows - _overlap_rows));
-      const int row_pad_bottom = std::max(0, row_bottom - _n_rows);
-
-      // Get a pointer to the start of the row.
-      const int row_offset = std::min(0, row_pad_top - _padding_top);
-      const TIn* const inptr_row = inptr_batch + _in_row_stride*(row_offset + tile_i*(InnerTileRows - _overlap_rows));
       TOut* const outptr_row = outptr_batch + tile_i*_tiles_N*_matrix_row_stride;
+      transform_tile_row(threadid, batch, tile_i, start_channel, n_channels, outptr_row, _matrix_stride);
+    }
+  }
+}
+
+MEMBERFN(void)::run_tile_rows(
+  const unsigned int batch,
+  const unsigned int tile_row_start,
+  const unsigned int tile_row_stop,
+  void * const matrices,
+  const int inter_matrix_stride,
+  const unsigned int threadid
+)
+{
+  const unsigned int stop = std::min<unsigned int>(tile_row_stop, _tiles_M);
+  for (unsigned int tile_i = tile_row_start; tile_i < stop; tile_i++)
+  {
+    TOut* const outptr_row = static_cast<TOut *>(matrices) + (tile_i - tile_row_start)*_tiles_N*_matrix_row_stride;
+    transform_tile_row(threadid, batch, tile_i, 0, _n_channels, outptr_row, inter_matrix_stride);
+  }
+}
+
+MEMBERFN(void)::transform_tile_row(
+  const unsigned int threadid,
+  const int batch,
+  const int tile_i,
+  const int start_channel,
+  const int n_channels,
+  TOut * const outptr_row,
+  const int matrix_stride
+)
+{
+  const TIn* const inptr_batch = _inptr + start_channel + batch*_in_batch_stride;
+
+  // Compute the starting and ending row of pixels within the row of tiles,
+  // hence compute the padding to apply to the top and bottom of each tile.
+  const int row_top = tile_i * (InnerTileRows - _overlap_rows) - _padding_top;
+  const int row_bottom = row_top + InnerTileRows;
+  const int row_pad_top = std::max(0, _padding_top - tile_i * (InnerTileRows - _overlap_rows));
+  const int row_pad_bottom = std::max(0, row_bottom - _n_rows);
+
+  // Get a pointer to the start of the row.
+  const int row_offset = std::min(0, row_pad_top - _padding_top);
+  const TIn* const inptr_row = inptr_batch + _in_row_stride*(row_offset + tile_i*(InnerTileRows - _overlap_rows));
 
-      // Loop over tiles within the row
-      for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
-      {
-        // Compute the starting and ending column of pixels within the tile,
-        // hence compute the padding to apply to the left and right of the
-        // tile.
-        const int tile_left = tile_j * (InnerTileCols - _overlap_cols) - _padding_left;
-        const int tile_right = tile_left + InnerTileCols;
-        const int tile_pad_left = std::max(0, _padding_left - tile_j * (InnerTileCols - _overlap_cols));
-        const int tile_pad_right = std::max(0, tile_right - _n_cols);
-
-        // Get a pointer to the start of the tile.
-        const int col_offset = std::min(0, tile_pad_left - _padding_left);
-        const TIn* const inptr_tile = inptr_row + _in_col_stride*(col_offset + tile_j*(InnerTileCols - _overlap_cols));
-        TOut* const outptr_tile = outptr_row + tile_j * _matrix_row_stride;
-
-        // Transform the tile, applying padding if necessary.
-        if (row_pad_top || tile_pad_left || row_pad_bottom || tile_pad_right)
-        {
-          transform_padded_tile(
-            threadid, n_channels, outptr_tile, inptr_tile,
-            row_pad_top, tile_pad_left, row_pad_bottom, tile_pad_right
-          );
-        }
-        else
-        {
-          transform_unpadded_tile(threadid, n_channels, outptr_tile, inptr_tile);
-        }
-      }
+  // Loop over tiles within the row
+  for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
+  {
+    // Compute the starting and ending column of pixels within the tile,
+    // hence compute the padding to apply to the left and right of the
+    // tile.
+    const int tile_left = tile_j * (InnerTileCols - _overlap_cols) - _padding_left;
+    const int tile_right = tile_left + InnerTileCols;
+    const int tile_pad_left = std::max(0, _padding_left - tile_j * (InnerTileCols - _overlap_cols));
+    const int tile_pad_right = std::max(0, tile_right - _n_cols);
+
+    // Get a pointer to the start of the tile.
+    const int col_offset = std::min(0, tile_pad_left - _padding_left);
+    const TIn* const inptr_tile = inptr_row + _in_col_stride*(col_offset + tile_j*(InnerTileCols - _overlap_cols));
+    TOut* const outptr_tile = outptr_row + tile_j * _matrix_row_stride;
+
+    // Transform the tile, applying padding if necessary.
+    if (row_pad_top || tile_pad_left || row_pad_bottom || tile_pad_right)
+    {
+      transform_padded_tile(
+        threadid, n_channels, outptr_tile, inptr_tile, matrix_stride,
+        row_pad_top, tile_pad_left, row_pad_bottom, tile_pad_right
+      );
+    }
+    else
+    {
+      transform_unpadded_tile(threadid, n_channels, outptr_tile, inptr_tile, matrix_stride);
     }
   }
 }
@@ -224,11 +255,12 @@ MEMBERFN(void)::transform_unpadded_tile(
   const unsigned int /* threadid unused */,
   const int n_channels,
   TOut * const outptr,
-  const TIn * const inptr
+  const TIn * const inptr,
+  const int matrix_stride
 )
 {
   transform_tile(
-    n_channels, inptr, _in_row_stride, _in_col_stride, outptr, _matrix_stride
+    n_channels, inptr, _in_row_stride, _in_col_stride, outptr, matrix_stride
   );
 }
 
@@ -237,6 +269,7 @@ MEMBERFN(void)::transform_padded_tile(
   const int n_channels,
   TOut * const outptr,
   const TIn * const inptr,
+  const int matrix_stride,
   const int padding_top,
   const int padding_left,
   const int padding_bottom,
@@ -253,7 +286,7 @@ MEMBERFN(void)::transform_padded_tile(
   transform_tile(
     n_channels, static_cast<const TIn *>(get_working_space(threadid)),
     _working_space_row_stride, _working_space_col_stride,
-    outptr, _matrix_stride
+    outptr, matrix_stride
   );
 }
 
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm.hpp"
+#include "input.hpp"
+
+namespace winograd
+{
+
+template <>
+void InputTransform<8, 8, float, float, WinogradRoots::Integers>::transform_tile(
+  const int n_channels,
+  const float* const input_base,
+  const int input_row_stride,
+  const int input_col_stride,
+  float* outptr,
+  const int matrix_stride
+)
+{
+  constexpr int inner_tile_rows = 8, inner_tile_cols = 8;
+
+  // Get pointers into the input tile
+  const float *x_ptrs[inner_tile_rows][inner_tile_cols];
+  for (int i = 0, xi = 0; i < inner_tile_rows; i++, xi++)
+  {
+    // Get a pointer into the row
+    const float* const row_ptr = input_base + xi*input_row_stride;
+
+    for (int j = 0, xj = 0; j < inner_tile_cols; j++, xj++)
+    {
+      x_ptrs[i][j] = row_ptr + xj*input_col_stride;
+    }
+  }
+
+  // Matrices used/computed in this kernel.
+  float x[inner_tile_rows][inner_tile_cols];
+  float XTx[inner_tile_rows][inner_tile_cols];
+  float U[inner_tile_rows][inner_tile_cols];
+
+  // Perform the Winograd input transformation for each channel in the input
+  // tensor.
+  int channels_remaining = n_channels;
+#ifdef __aarch64__
+  for (; channels_remaining >= 4; channels_remaining -= 4)
+  {
+    // Matrices used/computed in this kernel.
+    float32x4_t x[inner_tile_rows][inner_tile_cols];
+    float32x4_t XTx[inner_tile_rows][inner_tile_cols];
+    float32x4_t U[inner_tile_rows][inner_tile_cols];
+
+    // Read a 8x8 tile in the spatial domain
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[i][j] = vld1q_f32(x_ptrs[i][j]);
+        x_ptrs[i][j] += 4;
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      // XTx[0][j] = -36*x[0][j] + 49*x[2][j] + -14*x[4][j] +  1*x[6][j];
+      XTx[0][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[0][j], -36.0f), x[2][j], 49.0f), x[4][j], -14.0f);
+
+      // XTx[1][j] = -36*x[1][j] + 36*x[2][j] + 13*x[3][j] + -13*x[4][j] + -1*x[5][j] +  1*x[6][j];
+      XTx[1][j] = vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[1][j], -36.0f), x[2][j], 36.0f), x[3][j], 13.0f), x[4][j], -13.0f), x[5][j]);
+
+      // XTx[2][j] = 36*x[1][j] + 36*x[2][j] + -13*x[3][j] + -13*x[4][j] +  1*x[5][j] +  1*x[6][j];
+      XTx[2][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(x[6][j], x[5][j]), x[1][j], 36.0f), x[2][j], 36.0f), x[3][j], -13.0f), x[4][j], -13.0f);
+
+      // XTx[3][j] = -18*x[1][j] +  9*x[2][j] + 20*x[3][j] + -10*x[4][j] + -2*x[5][j] +  1*x[6][j];
+      XTx[3][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[1][j], -18.0f), x[2][j], 9.0f), x[3][j], 20.0f), x[4][j], -10.0f), x[5][j], -2.0f);
+
+      // XTx[4][j] = 18*x[1][j] +  9*x[2][j] + -20*x[3][j] + -10*x[4][j] +  2*x[5][j] +  1*x[6][j];
+      XTx[4][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[1][j], 18.0f), x[2][j], 9.0f), x[3][j], -20.0f), x[4][j], -10.0f), x[5][j], 2.0f);
+
+      // XTx[5][j] = -12*x[1][j] +  4*x[2][j] + 15*x[3][j] + -5*x[4][j] + -3*x[5][j] +  1*x[6][j];
+      XTx[5][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[1][j], -12.0f), x[2][j], 4.0f), x[3][j], 15.0f), x[4][j], -5.0f), x[5][j], -3.0f);
+
+      // XTx[6][j] = 12*x[1][j] +  4*x[2][j] + -15*x[3][j] + -5*x[4][j] +  3*x[5][j] +  1*x[6][j];
+      XTx[6][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[6][j], x[1][j], 12.0f), x[2][j], 4.0f), x[3][j], -15.0f), x[4][j], -5.0f), x[5][j], 3.0f);
+
+      // XTx[7][j] = -36*x[1][j] + 49*x[3][j] + -14*x[5][j] +  1*x[7][j];
+      XTx[7][j] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(x[7][j], x[1][j], -36.0f), x[3][j], 49.0f), x[5][j], -14.0f);
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      // U[i][0] = -36*XTx[i][0] + 49*XTx[i][2] + -14*XTx[i][4] +  1*XTx[i][6];
+      U[i][0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][0], -36.0f), XTx[i][2], 49.0f), XTx[i][4], -14.0f);
+
+      // U[i][1] = -36*XTx[i][1] + 36*XTx[i][2] + 13*XTx[i][3] + -13*XTx[i][4] + -1*XTx[i][5] +  1*XTx[i][6];
+      U[i][1] = vsubq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][1], -36.0f), XTx[i][2], 36.0f), XTx[i][3], 13.0f), XTx[i][4], -13.0f), XTx[i][5]);
+
+      // U[i][2] = 36*XTx[i][1] + 36*XTx[i][2] + -13*XTx[i][3] + -13*XTx[i][4] +  1*XTx[i][5] +  1*XTx[i][6];
+      U[i][2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vaddq_f32(XTx[i][6], XTx[i][5]), XTx[i][1], 36.0f), XTx[i][2], 36.0f), XTx[i][3], -13.0f), XTx[i][4], -13.0f);
+
+      // U[i][3] = -18*XTx[i][1] +  9*XTx[i][2] + 20*XTx[i][3] + -10*XTx[i][4] + -2*XTx[i][5] +  1*XTx[i][6];
+      U[i][3] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][1], -18.0f), XTx[i][2], 9.0f), XTx[i][3], 20.0f), XTx[i][4], -10.0f), XTx[i][5], -2.0f);
+
+      // U[i][4] = 18*XTx[i][1] +  9*XTx[i][2] + -20*XTx[i][3] + -10*XTx[i][4] +  2*XTx[i][5] +  1*XTx[i][6];
+      U[i][4] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][1], 18.0f), XTx[i][2], 9.0f), XTx[i][3], -20.0f), XTx[i][4], -10.0f), XTx[i][5], 2.0f);
+
+      // U[i][5] = -12*XTx[i][1] +  4*XTx[i][2] + 15*XTx[i][3] + -5*XTx[i][4] + -3*XTx[i][5] +  1*XTx[i][6];
+      U[i][5] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][1], -12.0f), XTx[i][2], 4.0f), XTx[i][3], 15.0f), XTx[i][4], -5.0f), XTx[i][5], -3.0f);
+
+      // U[i][6] = 12*XTx[i][1] +  4*XTx[i][2] + -15*XTx[i][3] + -5*XTx[i][4] +  3*XTx[i][5] +  1*XTx[i][6];
+      U[i][6] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][6], XTx[i][1], 12.0f), XTx[i][2], 4.0f), XTx[i][3], -15.0f), XTx[i][4], -5.0f), XTx[i][5], 3.0f);
+
+      // U[i][7] = -36*XTx[i][1] + 49*XTx[i][3] + -14*XTx[i][5] +  1*XTx[i][7];
+      U[i][7] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(XTx[i][7], XTx[i][1], -36.0f), XTx[i][3], 49.0f), XTx[i][5], -14.0f);
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        vst1q_f32(outptr + m*matrix_stride, U[i][j]);
+      }
+    }
+    outptr += 4;
+  }
+#endif  // __aarch64__
+#ifdef __arm_any__
+  for (; channels_remaining >= 2; channels_remaining -= 2)
+  {
+    // Matrices used/computed in this kernel.
+    float32x2_t x[inner_tile_rows][inner_tile_cols];
+    float32x2_t XTx[inner_tile_rows][inner_tile_cols];
+    float32x2_t U[inner_tile_rows][inner_tile_cols];
+
+    // Read a 8x8 tile in the spatial domain
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[i][j] = vld1_f32(x_ptrs[i][j]);
+        x_ptrs[i][j] += 2;
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      // XTx[0][j] = -36*x[0][j] + 49*x[2][j] + -14*x[4][j] +  1*x[6][j];
+      XTx[0][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[0][j], -36.0f), x[2][j], 49.0f), x[4][j], -14.0f);
+
+      // XTx[1][j] = -36*x[1][j] + 36*x[2][j] + 13*x[3][j] + -13*x[4][j] + -1*x[5][j] +  1*x[6][j];
+      XTx[1][j] = vsub_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[1][j], -36.0f), x[2][j], 36.0f), x[3][j], 13.0f), x[4][j], -13.0f), x[5][j]);
+
+      // XTx[2][j] = 36*x[1][j] + 36*x[2][j] + -13*x[3][j] + -13*x[4][j] +  1*x[5][j] +  1*x[6][j];
+      XTx[2][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vadd_f32(x[6][j], x[5][j]), x[1][j], 36.0f), x[2][j], 36.0f), x[3][j], -13.0f), x[4][j], -13.0f);
+
+      // XTx[3][j] = -18*x[1][j] +  9*x[2][j] + 20*x[3][j] + -10*x[4][j] + -2*x[5][j] +  1*x[6][j];
+      XTx[3][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[1][j], -18.0f), x[2][j], 9.0f), x[3][j], 20.0f), x[4][j], -10.0f), x[5][j], -2.0f);
+
+      // XTx[4][j] = 18*x[1][j] +  9*x[2][j] + -20*x[3][j] + -10*x[4][j] +  2*x[5][j] +  1*x[6][j];
+      XTx[4][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[1][j], 18.0f), x[2][j], 9.0f), x[3][j], -20.0f), x[4][j], -10.0f), x[5][j], 2.0f);
+
+      // XTx[5][j] = -12*x[1][j] +  4*x[2][j] + 15*x[3][j] + -5*x[4][j] + -3*x[5][j] +  1*x[6][j];
+      XTx[5][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[1][j], -12.0f), x[2][j], 4.0f), x[3][j], 15.0f), x[4][j], -5.0f), x[5][j], -3.0f);
+
+      // XTx[6][j] = 12*x[1][j] +  4*x[2][j] + -15*x[3][j] + -5*x[4][j] +  3*x[5][j] +  1*x[6][j];
+      XTx[6][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(x[6][j], x[1][j], 12.0f), x[2][j], 4.0f), x[3][j], -15.0f), x[4][j], -5.0f), x[5][j], 3.0f);
+
+      // XTx[7][j] = -36*x[1][j] + 49*x[3][j] + -14*x[5][j] +  1*x[7][j];
+      XTx[7][j] = vmla_n_f32(vmla_n_f32(vmla_n_f32(x[7][j], x[1][j], -36.0f), x[3][j], 49.0f), x[5][j], -14.0f);
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      // U[i][0] = -36*XTx[i][0] + 49*XTx[i][2] + -14*XTx[i][4] +  1*XTx[i][6];
+      U[i][0] = vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][0], -36.0f), XTx[i][2], 49.0f), XTx[i][4], -14.0f);
+
+      // U[i][1] = -36*XTx[i][1] + 36*XTx[i][2] + 13*XTx[i][3] + -13*XTx[i][4] + -1*XTx[i][5] +  1*XTx[i][6];
+      U[i][1] = vsub_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][1], -36.0f), XTx[i][2], 36.0f), XTx[i][3], 13.0f), XTx[i][4], -13.0f), XTx[i][5]);
+
+      // U[i][2] = 36*XTx[i][1] + 36*XTx[i][2] + -13*XTx[i][3] + -13*XTx[i][4] +  1*XTx[i][5] +  1*XTx[i][6];
+      U[i][2] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vadd_f32(XTx[i][6], XTx[i][5]), XTx[i][1], 36.0f), XTx[i][2], 36.0f), XTx[i][3], -13.0f), XTx[i][4], -13.0f);
+
+      // U[i][3] = -18*XTx[i][1] +  9*XTx[i][2] + 20*XTx[i][3] + -10*XTx[i][4] + -2*XTx[i][5] +  1*XTx[i][6];
+      U[i][3] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][1], -18.0f), XTx[i][2], 9.0f), XTx[i][3], 20.0f), XTx[i][4], -10.0f), XTx[i][5], -2.0f);
+
+      // U[i][4] = 18*XTx[i][1] +  9*XTx[i][2] + -20*XTx[i][3] + -10*XTx[i][4] +  2*XTx[i][5] +  1*XTx[i][6];
+      U[i][4] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][1], 18.0f), XTx[i][2], 9.0f), XTx[i][3], -20.0f), XTx[i][4], -10.0f), XTx[i][5], 2.0f);
+
+      // U[i][5] = -12*XTx[i][1] +  4*XTx[i][2] + 15*XTx[i][3] + -5*XTx[i][4] + -3*XTx[i][5] +  1*XTx[i][6];
+      U[i][5] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][1], -12.0f), XTx[i][2], 4.0f), XTx[i][3], 15.0f), XTx[i][4], -5.0f), XTx[i][5], -3.0f);
+
+      // U[i][6] = 12*XTx[i][1] +  4*XTx[i][2] + -15*XTx[i][3] + -5*XTx[i][4] +  3*XTx[i][5] +  1*XTx[i][6];
+      U[i][6] = vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][6], XTx[i][1], 12.0f), XTx[i][2], 4.0f), XTx[i][3], -15.0f), XTx[i][4], -5.0f), XTx[i][5], 3.0f);
+
+      // U[i][7] = -36*XTx[i][1] + 49*XTx[i][3] + -14*XTx[i][5] +  1*XTx[i][7];
+      U[i][7] = vmla_n_f32(vmla_n_f32(vmla_n_f32(XTx[i][7], XTx[i][1], -36.0f), XTx[i][3], 49.0f), XTx[i][5], -14.0f);
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        vst1_f32(outptr + m*matrix_stride, U[i][j]);
+      }
+    }
+    outptr += 2;
+  }
+#endif  // __arm_any__
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Load x
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[i][j] = *(x_ptrs[i][j]++);
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      XTx[0][j] = -36*x[0][j] + 49*x[2][j] - 14*x[4][j] + x[6][j];
+      XTx[1][j] = -36*x[1][j] + 36*x[2][j] + 13*x[3][j] - 13*x[4][j] - x[5][j] + x[6][j];
+      XTx[2][j] = 36*x[1][j] + 36*x[2][j] - 13*x[3][j] - 13*x[4][j] + x[5][j] + x[6][j];
+      XTx[3][j] = -18*x[1][j] + 9*x[2][j] + 20*x[3][j] - 10*x[4][j] - 2*x[5][j] + x[6][j];
+      XTx[4][j] = 18*x[1][j] + 9*x[2][j] - 20*x[3][j] - 10*x[4][j] + 2*x[5][j] + x[6][j];
+      XTx[5][j] = -12*x[1][j] + 4*x[2][j] + 15*x[3][j] - 5*x[4][j] - 3*x[5][j] + x[6][j];
+      XTx[6][j] = 12*x[1][j] + 4*x[2][j] - 15*x[3][j] - 5*x[4][j] + 3*x[5][j] + x[6][j];
+      XTx[7][j] = -36*x[1][j] + 49*x[3][j] - 14*x[5][j] + x[7][j];
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      U[i][0] = -36*XTx[i][0] + 49*XTx[i][2] - 14*XTx[i][4] + XTx[i][6];
+      U[i][1] = -36*XTx[i][1] + 36*XTx[i][2] + 13*XTx[i][3] - 13*XTx[i][4] - XTx[i][5] + XTx[i][6];
+      U[i][2] = 36*XTx[i][1] + 36*XTx[i][2] - 13*XTx[i][3] - 13*XTx[i][4] + XTx[i][5] + XTx[i][6];
+      U[i][3] = -18*XTx[i][1] + 9*XTx[i][2] + 20*XTx[i][3] - 10*XTx[i][4] - 2*XTx[i][5] + XTx[i][6];
+      U[i][4] = 18*XTx[i][1] + 9*XTx[i][2] - 20*XTx[i][3] - 10*XTx[i][4] + 2*XTx[i][5] + XTx[i][6];
+      U[i][5] = -12*XTx[i][1] + 4*XTx[i][2] + 15*XTx[i][3] - 5*XTx[i][4] - 3*XTx[i][5] + XTx[i][6];
+      U[i][6] = 12*XTx[i][1] + 4*XTx[i][2] - 15*XTx[i][3] - 5*XTx[i][4] + 3*XTx[i][5] + XTx[i][6];
+      U[i][7] = -36*XTx[i][1] + 49*XTx[i][3] - 14*XTx[i][5] + XTx[i][7];
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = U[i][j];
+      }
+    }
+    outptr++;
+  }
+}
+
+template class InputTransform<8, 8, float, float, WinogradRoots::Integers>;
+
+}  // namespace winograd
@@ -161,43 +161,73 @@ MEMBERFN(void)::run(
   const auto matrix_tile_col_stride = _matrix_row_stride;
   const auto matrix_tile_row_stride = _tiles_N * matrix_tile_col_stride;
 
-  const TOut* const bptr = (_biases == nullptr) ? nullptr : _biases + start_channel;
-
   // Loop over batches
   for (int batch = 0; batch < _n_batches; batch++)
   {
     const TIn* const matrix_batch = _matrix_base + start_channel + batch * _matrix_batch_stride;
-    TOut* const outptr_batch = _outptr + start_channel + batch * _out_batch_stride;
 
     for (int tile_i = 0; tile_i < _tiles_M; tile_i++)
     {
-      // Compute properties of the row of output tiles
-      const int row_pad_bottom = std::max(0, (tile_i + 1)*output_tile_rows - _n_rows);
       const TIn* const matrix_tile_row = matrix_batch + tile_i * matrix_tile_row_stride;
-      TOut* const outptr_row = outptr_batch + tile_i * output_tile_rows * _out_row_stride;
-
-      for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
-      {
-        // Compute property of this specific tile
-        const int tile_pad_right = std::max(0, (tile_j + 1)*output_tile_cols - _n_cols);
-        const TIn* const matrix_tile = matrix_tile_row + tile_j * matrix_tile_col_stride;
-        TOut* const outptr_tile = outptr_row + tile_j * output_tile_cols * _out_col_stride;
-
-        // Perform the transformation
-        if (row_pad_bottom || tile_pad_right)
-        {
-          transform_cropped_tile(
-            threadid, n_channels, outptr_tile, matrix_tile, bptr,
-            row_pad_bottom, tile_pad_right
-          );
-        }
-        else
-        {
-          transform_uncropped_tile(
-            threadid, n_channels, outptr_tile, matrix_tile, bptr
-          );
-        }
-      }
+      transform_tile_row(threadid, batch, tile_i, start_channel, n_channels, matrix_tile_row, _matrix_stride);
+    }
+  }
+}
+
+MEMBERFN(void)::run_tile_rows(
+  const unsigned int batch,
+  const unsigned int tile_row_start,
+  const unsigned int tile_row_stop,
+  const void * const matrices,
+  const int inter_matrix_stride,
+  const unsigned int threadid
+)
+{
+  const unsigned int stop = std::min<unsigned int>(tile_row_stop, _tiles_M);
+  for (unsigned int tile_i = tile_row_start; tile_i < stop; tile_i++)
+  {
+    const TIn* const matrix_tile_row = static_cast<const TIn *>(matrices) + (tile_i - tile_row_start) * _tiles_N * _matrix_row_stride;
+    transform_tile_row(threadid, batch, tile_i, 0, _n_channels, matrix_tile_row, inter_matrix_stride);
+  }
+}
+
+MEMBERFN(void)::transform_tile_row(
+  const unsigned int threadid,
+  const int batch,
+  const int tile_i,
+  const int start_channel,
+  const int n_channels,
+  const TIn * const matrix_tile_row,
+  const int matrix_stride
+)
+{
+  const TOut* const bptr = (_biases == nullptr) ? nullptr : _biases + start_channel;
+  TOut* const outptr_batch = _outptr + start_channel + batch * _out_batch_stride;
+
+  // Compute properties of the row of output tiles
+  const int row_pad_bottom = std::max(0, (tile_i + 1)*output_tile_rows - _n_rows);
+  TOut* const outptr_row = outptr_batch + tile_i * output_tile_rows * _out_row_stride;
+
+  for (int tile_j = 0; tile_j < _tiles_N; tile_j++)
+  {
+    // Compute property of this specific tile
+    const int tile_pad_right = std::max(0, (tile_j + 1)*output_tile_cols - _n_cols);
+    const TIn* const matrix_tile = matrix_tile_row + tile_j * _matrix_row_stride;
+    TOut* const outptr_tile = outptr_row + tile_j * output_tile_cols * _out_col_stride;
+
+    // Perform the transformation
+    if (row_pad_bottom || tile_pad_right)
+    {
+      transform_cropped_tile(
+        threadid, n_channels, outptr_tile, matrix_tile, matrix_stride, bptr,
+        row_pad_bottom, tile_pad_right
+      );
+    }
+    else
+    {
+      transform_uncropped_tile(
+        threadid, n_channels, outptr_tile, matrix_tile, matrix_stride, bptr
+      );
     }
   }
 }
@@ -207,11 +237,12 @@ MEMBERFN(void)::transform_uncropped_tile(
   const int n_channels,
   TOut * const outptr,
   const TIn * const inptr,
+  const int matrix_stride,
   const TOut * const biases
 )
 {
   transform_tile(
-    n_channels, inptr, _matrix_stride, biases,
+    n_channels, inptr, matrix_stride, biases,
     outptr, _out_row_stride, _out_col_stride
   );
 }
@@ -221,6 +252,7 @@ MEMBERFN(void)::transform_cropped_tile(
   const int n_channels,
   TOut * const outptr,
   const TIn * const inptr,
+  const int matrix_stride,
   const TOut * const biases,
   const int pad_bottom,
   const int pad_right
@@ -229,7 +261,7 @@ MEMBERFN(void)::transform_cropped_tile(
   // Transform into working space and then copy the relevant section out.
   TOut *wsptr = static_cast<TOut *>(get_working_space(threadid));
   transform_tile(
-    n_channels, inptr, _matrix_stride, biases,
+    n_channels, inptr, matrix_stride, biases,
     wsptr, _working_space_row_stride, _working_space_col_stride
   );
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm.hpp"
+#include "kernel.hpp"
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+namespace winograd
+{
+
+template <>
+void WeightTransform<3, 3, 4, 4, float16_t, float16_t, WinogradRoots::Integers>::execute(
+  const int n_output_channels,
+  const int n_input_channels,
+  const float16_t* const input,
+  float16_t* const output,
+  const int matrix_stride,
+  const int matrix_row_stride
+)
+{
+  constexpr int inner_tile_i = 4;
+  constexpr int inner_tile_j = 4;
+
+  // Get pointers to each cell of the weight tensor
+  const auto weight_col_stride = n_input_channels * n_output_channels;
+  const auto weight_row_stride = 3 * weight_col_stride;
+  const float16_t *inptrs[3][3];
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      inptrs[i][j] = input + i*weight_row_stride + j*weight_col_stride;
+    }
+  }
+
+  // For each input channel
+  for (int ic = 0; ic < n_input_channels; ic++)
+  {
+    float16_t *outptr = output + ic * matrix_row_stride;
+
+    // For each output channel
+    for (int channels_remaining = n_output_channels; channels_remaining; channels_remaining--)
+    {
+      // Matrices used and computed in this kernel, accumulated in single
+      // precision as the weights are only transformed once
+      float w[3][3], Ww[inner_tile_i][3], V[inner_tile_i][inner_tile_j];
+
+      // Read weights
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          w[i][j] = *(inptrs[i][j]++);
+        }
+      }
+
+      // Compute the matrix W w
+      for (int j = 0; j < 3; j++)
+      {
+        Ww[0][j] = w[0][j];
+        Ww[1][j] = (w[0][j] + w[1][j] + w[2][j]) / 2.0f;
+        Ww[2][j] = (w[0][j] - w[1][j] + w[2][j]) / 2.0f;
+        Ww[3][j] = w[2][j];
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < inner_tile_i; i++)
+      {
+        V[i][0] = Ww[i][0];
+        V[i][1] = (Ww[i][0] + Ww[i][1] + Ww[i][2]) / 2.0f;
+        V[i][2] = (Ww[i][0] - Ww[i][1] + Ww[i][2]) / 2.0f;
+        V[i][3] = Ww[i][2];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < inner_tile_i; i++)
+      {
+        for (int j = 0; j < inner_tile_j; j++, m++)
+        {
+          *(outptr + m*matrix_stride) = static_cast<float16_t>(V[i][j]);
+        }
+      }
+      outptr++;
+    }
+  }
+}
+
+template class WeightTransform<3, 3, 4, 4, float16_t, float16_t, WinogradRoots::Integers>;
+
+}  // namespace winograd
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
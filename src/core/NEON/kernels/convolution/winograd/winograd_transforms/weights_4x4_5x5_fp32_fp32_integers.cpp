@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm.hpp"
+#include "kernel.hpp"
+
+namespace winograd
+{
+
+template <>
+void WeightTransform<5, 5, 8, 8, float, float, WinogradRoots::Integers>::execute(
+  const int n_output_channels,
+  const int n_input_channels,
+  const float* const input,
+  float* const output,
+  const int matrix_stride,
+  const int matrix_row_stride
+)
+{
+  constexpr int inner_tile_i = 8;
+  constexpr int inner_tile_j = 8;
+
+  // Get pointers to each cell of the weight tensor
+  const auto weight_col_stride = n_input_channels * n_output_channels;
+  const auto weight_row_stride = 5 * weight_col_stride;
+  const float *inptrs[5][5];
+  for (int i = 0; i < 5; i++)
+  {
+    for (int j = 0; j < 5; j++)
+    {
+      inptrs[i][j] = input + i*weight_row_stride + j*weight_col_stride;
+    }
+  }
+
+  // For each input channel
+  for (int ic = 0; ic < n_input_channels; ic++)
+  {
+    float *outptr = output + ic * matrix_row_stride;
+
+    // For each output channel
+    for (int channels_remaining = n_output_channels; channels_remaining; channels_remaining--)
+    {
+      // Matrices used and computed in this kernel, accumulated in single
+      // precision as the weights are only transformed once
+      float w[5][5], Ww[inner_tile_i][5], V[inner_tile_i][inner_tile_j];
+
+      // Read weights
+      for (int i = 0; i < 5; i++)
+      {
+        for (int j = 0; j < 5; j++)
+        {
+          w[i][j] = *(inptrs[i][j]++);
+        }
+      }
+
+      // Compute the matrix W w
+      for (int j = 0; j < 5; j++)
+      {
+        Ww[0][j] = -w[0][j] / 36.0f;
+        Ww[1][j] = (w[0][j] - w[1][j] + w[2][j] - w[3][j] + w[4][j]) / 48.0f;
+        Ww[2][j] = (w[0][j] + w[1][j] + w[2][j] + w[3][j] + w[4][j]) / 48.0f;
+        Ww[3][j] = (-w[0][j] + 2*w[1][j] - 4*w[2][j] + 8*w[3][j] - 16*w[4][j]) / 120.0f;
+        Ww[4][j] = (-w[0][j] - 2*w[1][j] - 4*w[2][j] - 8*w[3][j] - 16*w[4][j]) / 120.0f;
+        Ww[5][j] = (w[0][j] - 3*w[1][j] + 9*w[2][j] - 27*w[3][j] + 81*w[4][j]) / 720.0f;
+        Ww[6][j] = (w[0][j] + 3*w[1][j] + 9*w[2][j] + 27*w[3][j] + 81*w[4][j]) / 720.0f;
+        Ww[7][j] = w[4][j];
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < inner_tile_i; i++)
+      {
+        V[i][0] = -Ww[i][0] / 36.0f;
+        V[i][1] = (Ww[i][0] - Ww[i][1] + Ww[i][2] - Ww[i][3] + Ww[i][4]) / 48.0f;
+        V[i][2] = (Ww[i][0] + Ww[i][1] + Ww[i][2] + Ww[i][3] + Ww[i][4]) / 48.0f;
+        V[i][3] = (-Ww[i][0] + 2*Ww[i][1] - 4*Ww[i][2] + 8*Ww[i][3] - 16*Ww[i][4]) / 120.0f;
+        V[i][4] = (-Ww[i][0] - 2*Ww[i][1] - 4*Ww[i][2] - 8*Ww[i][3] - 16*Ww[i][4]) / 120.0f;
+        V[i][5] = (Ww[i][0] - 3*Ww[i][1] + 9*Ww[i][2] - 27*Ww[i][3] + 81*Ww[i][4]) / 720.0f;
+        V[i][6] = (Ww[i][0] + 3*Ww[i][1] + 9*Ww[i][2] + 27*Ww[i][3] + 81*Ww[i][4]) / 720.0f;
+        V[i][7] = Ww[i][4];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < inner_tile_i; i++)
+      {
+        for (int j = 0; j < inner_tile_j; j++, m++)
+        {
+          *(outptr + m*matrix_stride) = V[i][j];
+        }
+      }
+      outptr++;
+    }
+  }
+}
+
+template class WeightTransform<5, 5, 8, 8, float, float, WinogradRoots::Integers>;
+
+}  // namespace winograd
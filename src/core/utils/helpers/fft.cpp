@@ -76,6 +76,55 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
     return stages;
 }
 
+std::vector<unsigned int> decompose_stages_with_prime_factors(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    std::vector<unsigned int> prime_stages;
+    unsigned int              decomposable = 1;
+    unsigned int              res          = N;
+
+    // Split N in the part made of supported factors and the remaining prime factors
+    for(unsigned int p = 2; p * p <= res; ++p)
+    {
+        while(0 == (res % p))
+        {
+            if(supported_factors.count(p) != 0)
+            {
+                decomposable *= p;
+            }
+            else
+            {
+                prime_stages.push_back(p);
+            }
+            res /= p;
+        }
+    }
+    if(res > 1)
+    {
+        if(supported_factors.count(res) != 0)
+        {
+            decomposable *= res;
+        }
+        else
+        {
+            prime_stages.push_back(res);
+        }
+    }
+
+    std::vector<unsigned int> stages;
+    if(decomposable > 1)
+    {
+        stages = decompose_stages(decomposable, supported_factors);
+        if(stages.empty())
+        {
+            // Couldn't decompose with given factors
+            return stages;
+        }
+    }
+    stages.insert(std::end(stages), std::begin(prime_stages), std::end(prime_stages));
+
+    return stages;
+}
+
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages)
 {
     std::vector<unsigned int> idx_digit_reverse;
@@ -26,19 +26,36 @@
 #include "arm_compute/graph.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+void log_memory_plan(const char *name, IMemoryManager &mm)
+{
+    ARM_COMPUTE_UNUSED(name);
+    const auto *lifetime_mgr = dynamic_cast<const OffsetLifetimeManager *>(mm.lifetime_manager());
+    if(lifetime_mgr != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(name << " memory: planned " << lifetime_mgr->planned_size() << " bytes, peak " << lifetime_mgr->peak_size() << " bytes" << std::endl);
+    }
+}
+} // namespace
+
 GraphContext::GraphContext()
-    : _config(), _memory_managers()
+    : _config(), _memory_managers(), _weights_managers()
 {
 }
 
 GraphContext::~GraphContext()
 {
     _memory_managers.clear();
+    _weights_managers.clear();
     release_default_graph_context(*this);
 }
 
@@ -74,9 +91,32 @@ std::map<Target, MemoryManagerContext> &GraphContext::memory_managers()
     return _memory_managers;
 }
 
+bool GraphContext::insert_weights_management_ctx(WeightsManagerContext &&weights_ctx)
+{
+    Target target = weights_ctx.target;
+    if(target == Target::UNSPECIFIED || _weights_managers.find(target) != std::end(_weights_managers))
+    {
+        return false;
+    }
+
+    _weights_managers[target] = std::move(weights_ctx);
+    return true;
+}
+
+WeightsManagerContext *GraphContext::weights_management_ctx(Target target)
+{
+    return (_weights_managers.find(target) != std::end(_weights_managers)) ? &_weights_managers[target] : nullptr;
+}
+
+std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
+{
+    return _weights_managers;
+}
+
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Functions of concurrently executed branches need their own memory pools
+    const size_t num_pools = static_cast<size_t>(std::max(_config.num_parallel_branches, 1));
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -85,11 +125,13 @@ void GraphContext::finalize()
         if(mm_obj.second.intra_mm != nullptr)
         {
             mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
+            log_memory_plan("Intra layer", *mm_obj.second.intra_mm);
         }
         // Finalize cross layer memory manager
         if(mm_obj.second.cross_mm != nullptr)
         {
             mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, num_pools);
+            log_memory_plan("Cross layer", *mm_obj.second.cross_mm);
         }
     }
 }
@@ -33,13 +33,33 @@
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <map>
+#include <set>
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Total size of the memory pools of a memory manager */
+size_t memory_manager_footprint(IMemoryManager *mm)
+{
+    return (mm != nullptr) ? mm->lifetime_manager()->pool_size() * mm->pool_manager()->num_pools() : 0;
+}
+} // namespace
+
 GraphManager::GraphManager()
-    : _workloads()
+    : _workloads(), _schedulers()
 {
 }
 
@@ -81,6 +101,9 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Functions size their per-thread buffers from the number of threads of the scheduler at configuration time
+    workload.num_threads = Scheduler::get().num_threads();
+
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
@@ -88,13 +111,26 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
+    // Build the task graph to execute independent branches concurrently
+    if(forced_target == Target::NEON && ctx.config().num_parallel_branches > 1)
+    {
+        detail::configure_task_graph(workload, static_cast<unsigned int>(ctx.config().num_parallel_branches));
+    }
+
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // The transition manager assumes the tasks are executed in order, so it can't be used when branches are executed concurrently
+    workload.uses_transition_manager = ctx.config().use_transition_memory_manager && workload.task_graph.schedulers.empty();
+    if(workload.uses_transition_manager)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
     else
     {
+        if(ctx.config().use_transition_memory_manager)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Transition memory manager disabled for graph with ID : " << graph.id()
+                                          << " as its branches are executed concurrently, all its tensors are allocated individually" << std::endl);
+        }
         detail::allocate_all_tensors(graph);
     }
 
@@ -104,6 +140,17 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
+
+#ifdef ARM_COMPUTE_LOGGING_ENABLED
+    // Only build the memory report when it is logged
+    ARM_COMPUTE_CREATE_DEFAULT_GRAPH_LOGGER();
+    auto logger = logging::LoggerRegistry::get().logger("GRAPH");
+    if(logger != nullptr && logger->log_level() <= logging::LogLevel::INFO)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Memory report of graph with ID : " << graph.id() << std::endl
+                                   << memory_report(graph));
+    }
+#endif /* ARM_COMPUTE_LOGGING_ENABLED */
 }
 
 void GraphManager::execute_graph(Graph &graph)
@@ -112,6 +159,13 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Overlap the accessors with the execution of the graph
+    if(it->second.ctx->config().use_pipelined_execution)
+    {
+        detail::execute_workload_pipelined(it->second);
+        return;
+    }
+
     while(true)
     {
         // Call input accessors
@@ -131,12 +185,214 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+std::future<void> GraphManager::execute_graph_async(Graph &graph, unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_workloads.find(graph.id()) == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_ERROR_ON(num_threads == 0);
+
+    IScheduler *scheduler = scheduler_partition(graph, num_threads);
+
+    // Without a dedicated partition the graph would share the global scheduler, which is not re-entrant:
+    // defer the execution to the thread waiting for it instead
+    const std::launch policy = (scheduler != nullptr) ? std::launch::async : std::launch::deferred;
+    return std::async(policy, [this, &graph, scheduler]()
+    {
+        IScheduler *previous_scheduler = Scheduler::set_thread_local(scheduler);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            execute_graph(graph);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            Scheduler::set_thread_local(previous_scheduler);
+            throw;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        Scheduler::set_thread_local(previous_scheduler);
+    });
+}
+
+void GraphManager::execute_graphs(const std::vector<Graph *> &graphs, unsigned int core_budget)
+{
+    if(graphs.empty())
+    {
+        return;
+    }
+
+    // Graphs sharing a context would compete for the same transition memory
+    std::set<const GraphContext *> contexts;
+    for(auto &graph : graphs)
+    {
+        auto it = _workloads.find(graph->id());
+        if(it == std::end(_workloads))
+        {
+            ARM_COMPUTE_ERROR("Graph is not registered!");
+        }
+        if(!contexts.insert(it->second.ctx).second)
+        {
+            ARM_COMPUTE_ERROR("Graphs executed concurrently must use different graph contexts!");
+        }
+    }
+
+    // Split the core budget evenly between the graphs
+    const unsigned int num_graphs = graphs.size();
+    const unsigned int budget     = std::max(core_budget == 0 ? Scheduler::get().num_threads() : core_budget, num_graphs);
+
+    std::vector<std::future<void>> executions;
+    executions.reserve(num_graphs);
+    for(unsigned int i = 0; i < num_graphs; ++i)
+    {
+        const unsigned int num_threads = budget / num_graphs + (i < budget % num_graphs ? 1 : 0);
+        executions.emplace_back(execute_graph_async(*graphs[i], num_threads));
+    }
+
+    // Wait for all the executions to complete before reporting any error
+    for(auto &execution : executions)
+    {
+        execution.wait();
+    }
+    for(auto &execution : executions)
+    {
+        execution.get();
+    }
+}
+
+IScheduler *GraphManager::scheduler_partition(const Graph &graph, unsigned int num_threads)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // The per-thread buffers of the functions can't serve more threads than at configuration time
+    auto it = _workloads.find(graph.id());
+    if(it != std::end(_workloads) && it->second.num_threads != 0)
+    {
+        num_threads = std::min(num_threads, it->second.num_threads);
+    }
+
+    std::unique_ptr<IScheduler> &scheduler = _schedulers[graph.id()];
+    if(scheduler == nullptr)
+    {
+        scheduler = support::cpp14::make_unique<CPPScheduler>();
+    }
+    if(scheduler->num_threads() != num_threads)
+    {
+        scheduler->set_num_threads(num_threads);
+    }
+    return scheduler.get();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(graph, num_threads);
+    return nullptr;
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+MemoryReport GraphManager::memory_report(Graph &graph)
+{
+    auto it = _workloads.find(graph.id());
+    if(it == std::end(_workloads))
+    {
+        ARM_COMPUTE_ERROR("Graph is not registered!");
+    }
+    ExecutionWorkload &workload = it->second;
+    GraphContext      &ctx      = *workload.ctx;
+
+    // When the transition memory manager is used only the inputs and outputs of the graph are allocated individually
+    std::set<const ITensorHandle *> io_handles;
+    for(auto *tensor : workload.inputs)
+    {
+        io_handles.insert(tensor->handle()->parent_handle());
+    }
+    for(auto *tensor : workload.outputs)
+    {
+        io_handles.insert(tensor->handle()->parent_handle());
+    }
+
+    // Pretransposed weights held by the functions themselves rather than by a weights manager
+    std::map<NodeID, size_t> pretransposed_sizes;
+    for(auto &task : workload.tasks)
+    {
+        if(task.task != nullptr && task.node != nullptr)
+        {
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(task.node->assigned_target());
+            pretransposed_sizes[task.node->id()] += backend.pretransposed_weights_size(*task.task);
+        }
+    }
+
+    MemoryReport report;
+    for(auto &node : graph.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        NodeMemoryReport node_report;
+        node_report.id   = node->id();
+        node_report.name = node->name();
+        node_report.type = node->type();
+
+        auto pretransposed = pretransposed_sizes.find(node->id());
+        if(pretransposed != std::end(pretransposed_sizes))
+        {
+            node_report.pretransposed_weights = pretransposed->second;
+            report.pretransposed_weights      += pretransposed->second;
+        }
+
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+
+            // Sub-tensors use the memory of their parent, and released tensors (e.g. the original weights once transformed) use none
+            if(tensor == nullptr || tensor->handle() == nullptr || tensor->handle()->is_subtensor() || tensor->handle()->tensor().info()->is_resizable())
+            {
+                continue;
+            }
+
+            const ITensorInfo &info         = *tensor->handle()->tensor().info();
+            const size_t       size         = info.total_size();
+            const size_t       logical_size = info.tensor_shape().total_size() * info.element_size();
+            node_report.padding += (size > logical_size) ? size - logical_size : 0;
+            if(node->type() == NodeType::Const)
+            {
+                node_report.weights += size;
+                report.weights      += size;
+            }
+            else
+            {
+                node_report.activations += size;
+                if(!workload.uses_transition_manager || io_handles.find(tensor->handle()) != std::end(io_handles))
+                {
+                    report.activations += size;
+                }
+            }
+        }
+        report.padding += node_report.padding;
+        report.nodes.push_back(std::move(node_report));
+    }
+
+    for(auto &mm_ctx : ctx.memory_managers())
+    {
+        report.scratch     += memory_manager_footprint(mm_ctx.second.intra_mm.get());
+        report.transitions += memory_manager_footprint(mm_ctx.second.cross_mm.get());
+    }
+    for(auto &wm_ctx : ctx.weights_managers())
+    {
+        if(wm_ctx.second.wm != nullptr)
+        {
+            report.transformed_weights += wm_ctx.second.wm->footprint();
+        }
+    }
+
+    return report;
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
     _workloads.erase(it);
+    _schedulers.erase(graph.id());
 }
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
@@ -204,6 +204,12 @@ std::shared_ptr<arm_compute::IMemoryManager> CLDeviceBackend::create_memory_mana
 
     return mm;
 }
+
+size_t CLDeviceBackend::pretransposed_weights_size(arm_compute::IFunction &func)
+{
+    ARM_COMPUTE_UNUSED(func);
+    return 0;
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
@@ -39,24 +39,49 @@
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/MmapAllocator.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/WeightsManager.h"
 
 #include "support/ToolchainSupport.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register NEON backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _mmap_allocators(), _weights_managers(), _tuner(), _tuner_file()
+{
+}
+
+NEDeviceBackend::~NEDeviceBackend()
 {
+    NEConvolutionLayer::set_tuner(nullptr);
+    if(_tuner.tune_new_configurations() && !_tuner.method_table().empty() && !_tuner_file.empty())
+    {
+        _tuner.save_to_file(_tuner_file);
+    }
 }
 
 void NEDeviceBackend::initialize_backend()
@@ -78,6 +103,15 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup the convolution method tuner
+    _tuner_file = ctx.config().neon_tuner_file;
+    if(file_exists(_tuner_file))
+    {
+        _tuner.load_from_file(_tuner_file);
+    }
+    _tuner.set_tune_new_configurations(ctx.config().use_tuner);
+    NEConvolutionLayer::set_tuner(&_tuner);
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -88,8 +122,43 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
 
+        // Back the memory pools with memory mappings if huge pages or a NUMA node are requested
+        if(ctx.config().huge_page_mode != HugePageMode::NONE || ctx.config().numa_node >= 0)
+        {
+            std::unique_ptr<MmapAllocator> &mmap_allocator = _mmap_allocators[std::make_pair(ctx.config().huge_page_mode, ctx.config().numa_node)];
+            if(mmap_allocator == nullptr)
+            {
+                mmap_allocator = support::cpp14::make_unique<MmapAllocator>(ctx.config().huge_page_mode, ctx.config().numa_node);
+            }
+            mm_ctx.allocator = mmap_allocator.get();
+        }
+
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
+
+    // Create function level weights manager, shared by the contexts using the same weights cache
+    if(ctx.config().use_function_weights_manager && ctx.weights_management_ctx(Target::NEON) == nullptr)
+    {
+        const std::string              &cache_dir = ctx.config().weights_cache_dir;
+        std::shared_ptr<WeightsManager> wm        = _weights_managers[cache_dir].lock();
+        if(wm == nullptr)
+        {
+            wm = std::make_shared<WeightsManager>();
+
+            // Setup the prepared weights cache of the manager
+            if(!cache_dir.empty())
+            {
+                wm->set_weights_cache(std::make_shared<WeightsCache>(cache_dir));
+            }
+            _weights_managers[cache_dir] = wm;
+        }
+
+        WeightsManagerContext wm_ctx;
+        wm_ctx.target = Target::NEON;
+        wm_ctx.wm     = std::move(wm);
+
+        ctx.insert_weights_management_ctx(std::move(wm_ctx));
+    }
 }
 
 bool NEDeviceBackend::is_backend_supported()
@@ -159,6 +228,19 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
 
     return mm;
 }
+
+size_t NEDeviceBackend::pretransposed_weights_size(arm_compute::IFunction &func)
+{
+    if(auto *conv = dynamic_cast<NEGEMMConvolutionLayer *>(&func))
+    {
+        return conv->pretransposed_weights_size();
+    }
+    if(auto *fc = dynamic_cast<NEFullyConnectedLayer *>(&func))
+    {
+        return fc->pretransposed_weights_size();
+    }
+    return 0;
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
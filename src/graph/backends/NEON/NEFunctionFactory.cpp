@@ -112,6 +112,7 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
 
     // Create and configure function (we assume that functions have been validated before creation)
     std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, Target::NEON);
+    IWeightsManager                *wm = get_weights_manager(ctx, Target::NEON);
     std::unique_ptr<IFunction>      func;
     std::string                     func_name;
     if(conv_algorithm == ConvolutionMethod::Direct)
@@ -121,18 +122,24 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     }
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<NEGEMMConvolutionLayer>(
-                                        std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1, 1), fused_act);
+        auto f = support::cpp14::make_unique<NEGEMMConvolutionLayer>(mm, wm);
+        f->configure(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1, 1), fused_act);
+        func      = std::move(f);
+        func_name = "GEMMConvolutionLayer";
     }
     else if(conv_algorithm == ConvolutionMethod::Winograd)
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<NEWinogradConvolutionLayer>(
-                                        std::string("WinogradConvolutionLayer"), mm, input, weights, biases, output, conv_info, fused_act);
+        auto f = support::cpp14::make_unique<NEWinogradConvolutionLayer>(mm, wm);
+        f->configure(input, weights, biases, output, conv_info, fused_act);
+        func      = std::move(f);
+        func_name = "WinogradConvolutionLayer";
     }
     else
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<NEConvolutionLayer>(
-                                        std::string("ConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1, 1), fused_act);
+        auto f = support::cpp14::make_unique<NEConvolutionLayer>(mm, wm);
+        f->configure(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1, 1), fused_act);
+        func      = std::move(f);
+        func_name = "ConvolutionLayer";
     }
 
     // Log info
@@ -157,6 +164,50 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     return func;
 }
 
+template <>
+std::unique_ptr<IFunction> create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(FullyConnectedLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType     *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType     *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType     *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType     *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    const FullyConnectedLayerInfo fc_info = node.info();
+
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<NEFullyConnectedLayer>(get_memory_manager(ctx, NETargetInfo::TargetType), get_weights_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, fc_info);
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+
+    // Log info
+    std::ostringstream qss;
+    if(is_quantized)
+    {
+        qss << " Input QuantInfo: " << input->info()->quantization_info()
+            << " Weights QuantInfo: " << weights->info()->quantization_info()
+            << " Output QuantInfo: " << output->info()->quantization_info();
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << qss.str()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << std::endl);
+
+    return std::move(func);
+}
+
 template <>
 std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETargetInfo>(NormalizationLayerNode &node, GraphContext &ctx)
 {
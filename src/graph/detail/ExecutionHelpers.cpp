@@ -29,12 +29,270 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Job run concurrently with others by @ref run_jobs_concurrently */
+struct ConcurrentJob
+{
+    IScheduler           *scheduler; /**< Scheduler to use for the functions run by the job */
+    std::function<void()> function;  /**< Function to run */
+};
+
+/** Runs a set of jobs concurrently on the persistent threads of a dispatcher scheduler
+ *
+ * @note Any exception raised by a job is rethrown once all the jobs have completed.
+ *
+ * @param[in] dispatcher Scheduler whose threads run the jobs (Must have at least as many threads as jobs)
+ * @param[in] jobs       Jobs to run
+ */
+void run_jobs_concurrently(IScheduler &dispatcher, std::vector<ConcurrentJob> &jobs)
+{
+    ARM_COMPUTE_ERROR_ON(dispatcher.num_threads() < jobs.size());
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    std::mutex         mutex;
+    std::exception_ptr error = nullptr;
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    std::vector<IScheduler::Workload> workloads;
+    workloads.reserve(jobs.size());
+    for(auto &job : jobs)
+    {
+        workloads.emplace_back([&](const ThreadInfo &)
+        {
+            // The job may be run by the calling thread, so restore its scheduler afterwards
+            IScheduler *previous = Scheduler::set_thread_local(job.scheduler);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                job.function();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(error == nullptr)
+                {
+                    error = std::current_exception();
+                }
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            Scheduler::set_thread_local(previous);
+        });
+    }
+    dispatcher.run_tagged_workloads(workloads, "graph_jobs");
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if(error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+/** Executes the tasks of a workload following its task graph
+ *
+ * Tasks are picked by a set of branch workers as soon as all the tasks they depend on have completed.
+ * The branch workers run on the persistent threads of the task graph dispatcher.
+ *
+ * @param[in] workload Workload to execute
+ */
+void call_all_tasks_concurrently(ExecutionWorkload &workload)
+{
+    ExecutionTaskGraph &task_graph  = workload.task_graph;
+    const size_t        num_tasks   = workload.tasks.size();
+    const unsigned int  num_workers = task_graph.schedulers.size();
+
+    // Share the threads of the active scheduler between the branch workers
+    const unsigned int num_threads = std::max(Scheduler::get().num_threads() / num_workers, 1u);
+    for(auto &scheduler : task_graph.schedulers)
+    {
+        if(scheduler->num_threads() != num_threads)
+        {
+            scheduler->set_num_threads(num_threads);
+        }
+    }
+
+    std::mutex                mutex;
+    std::condition_variable   cv;
+    std::deque<size_t>        ready_tasks;
+    std::vector<unsigned int> num_pending(task_graph.num_predecessors);
+    size_t                    num_completed = 0;
+    bool                      failed        = false;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    std::exception_ptr error = nullptr;
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        if(num_pending[i] == 0)
+        {
+            ready_tasks.push_back(i);
+        }
+    }
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            cv.wait(lock, [&]()
+            {
+                return !ready_tasks.empty() || num_completed == num_tasks || failed;
+            });
+            if(failed || ready_tasks.empty())
+            {
+                break;
+            }
+
+            const size_t task_id = ready_tasks.front();
+            ready_tasks.pop_front();
+            lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                workload.tasks[task_id]();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                lock.lock();
+                failed = true;
+                error  = std::current_exception();
+                cv.notify_all();
+                break;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            lock.lock();
+            for(auto &successor : task_graph.successors[task_id])
+            {
+                if(--num_pending[successor] == 0)
+                {
+                    ready_tasks.push_back(successor);
+                }
+            }
+            ++num_completed;
+            cv.notify_all();
+        }
+    };
+
+    std::vector<ConcurrentJob> workers;
+    workers.reserve(num_workers);
+    for(auto &scheduler : task_graph.schedulers)
+    {
+        workers.push_back(ConcurrentJob{ scheduler.get(), worker });
+    }
+    run_jobs_concurrently(*task_graph.dispatcher, workers);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if(error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+/** Staging buffers of graph tensors bound to accessors */
+struct StagingBuffers
+{
+    std::vector<Tensor *>                             tensors    = {}; /**< Graph tensors */
+    std::vector<std::unique_ptr<arm_compute::Tensor>> buffers[2] = {}; /**< Staging buffer of each tensor, for each of the two executions in flight */
+};
+
+/** Creates two staging buffers for each of the given tensors
+ *
+ * @param[in] tensors Graph tensors to create the buffers for
+ *
+ * @return The staging buffers
+ */
+StagingBuffers create_staging_buffers(const std::vector<Tensor *> &tensors)
+{
+    StagingBuffers staging;
+    staging.tensors = tensors;
+    for(auto &buffers : staging.buffers)
+    {
+        for(auto &tensor : tensors)
+        {
+            ARM_COMPUTE_ERROR_ON(tensor == nullptr || tensor->handle() == nullptr);
+            auto buffer = support::cpp14::make_unique<arm_compute::Tensor>();
+            buffer->allocator()->init(TensorInfo(*tensor->handle()->tensor().info()));
+            buffer->allocator()->allocate();
+            buffers.emplace_back(std::move(buffer));
+        }
+    }
+    return staging;
+}
+
+/** Calls the accessors of the graph tensors on a set of staging buffers
+ *
+ * @param[in] staging Staging buffers
+ * @param[in] slot    Index of the set of buffers to use
+ *
+ * @return True if all the accessors were valid and expect more data
+ */
+bool call_staging_accessors(StagingBuffers &staging, unsigned int slot)
+{
+    bool is_valid = true;
+    for(size_t i = 0; i < staging.tensors.size(); ++i)
+    {
+        ITensorAccessor *accessor    = staging.tensors[i]->accessor();
+        const bool       valid_call = (accessor != nullptr) && accessor->access_tensor(*staging.buffers[slot][i]);
+        is_valid                    = is_valid && valid_call;
+    }
+    return is_valid;
+}
+
+/** Copies a set of staging buffers to or from the graph tensors
+ *
+ * @param[in] staging  Staging buffers
+ * @param[in] slot     Index of the set of buffers to use
+ * @param[in] to_graph True to copy the buffers to the graph tensors, false to copy the graph tensors to the buffers
+ */
+void copy_staging_buffers(StagingBuffers &staging, unsigned int slot, bool to_graph)
+{
+    for(size_t i = 0; i < staging.tensors.size(); ++i)
+    {
+        ITensorHandle *handle = staging.tensors[i]->handle();
+        handle->map(true);
+        if(to_graph)
+        {
+            handle->tensor().copy_from(*staging.buffers[slot][i]);
+        }
+        else
+        {
+            staging.buffers[slot][i]->copy_from(handle->tensor());
+        }
+        handle->unmap();
+    }
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -172,6 +430,72 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+void configure_task_graph(ExecutionWorkload &workload, unsigned int num_branches)
+{
+    ARM_COMPUTE_ERROR_ON(num_branches < 2);
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    ExecutionTaskGraph &task_graph = workload.task_graph;
+    const size_t        num_tasks  = workload.tasks.size();
+
+    std::map<NodeID, size_t> node_to_task;
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        node_to_task[workload.tasks[i].node->id()] = i;
+    }
+
+    task_graph.successors.assign(num_tasks, std::vector<size_t>());
+    task_graph.num_predecessors.assign(num_tasks, 0);
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        // Find the tasks producing the inputs of the node, looking through the nodes without a task (e.g. in-place concatenations)
+        std::set<size_t>          predecessors;
+        std::set<NodeID>          visited;
+        std::vector<const INode *> to_visit = { workload.tasks[i].node };
+        while(!to_visit.empty())
+        {
+            const INode *node = to_visit.back();
+            to_visit.pop_back();
+            for(auto &input_edge : node->input_edges())
+            {
+                const Edge  *edge     = workload.graph->edge(input_edge);
+                const INode *producer = (edge != nullptr) ? edge->producer() : nullptr;
+                if(producer == nullptr || !visited.insert(producer->id()).second)
+                {
+                    continue;
+                }
+
+                auto it = node_to_task.find(producer->id());
+                if(it != std::end(node_to_task))
+                {
+                    predecessors.insert(it->second);
+                }
+                else
+                {
+                    to_visit.push_back(producer);
+                }
+            }
+        }
+
+        for(auto &predecessor : predecessors)
+        {
+            task_graph.successors[predecessor].push_back(i);
+        }
+        task_graph.num_predecessors[i] = predecessors.size();
+    }
+
+    task_graph.schedulers.clear();
+    for(unsigned int i = 0; i < num_branches; ++i)
+    {
+        task_graph.schedulers.emplace_back(support::cpp14::make_unique<CPPScheduler>());
+    }
+    task_graph.dispatcher = support::cpp14::make_unique<CPPScheduler>();
+    task_graph.dispatcher->set_num_threads(num_branches);
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(workload, num_branches);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
 void release_unused_tensors(Graph &g)
 {
     for(auto &tensor : g.tensors())
@@ -237,9 +561,16 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+    if(!workload.task_graph.schedulers.empty())
     {
-        task();
+        call_all_tasks_concurrently(workload);
+    }
+    else
+    {
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
     }
 
     // Release memory for the transition buffers
@@ -252,6 +583,106 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+void execute_workload_pipelined(ExecutionWorkload &workload)
+{
+    StagingBuffers inputs  = create_staging_buffers(workload.inputs);
+    StagingBuffers outputs = create_staging_buffers(workload.outputs);
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // The graph and the accessors are run by the persistent threads of the workload, created on the first execution
+    if(workload.accessors_dispatcher == nullptr)
+    {
+        workload.accessors_dispatcher = support::cpp14::make_unique<CPPScheduler>();
+        workload.accessors_dispatcher->set_num_threads(3);
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    // The scheduler of the calling thread runs the graph: the accessors, which run concurrently with it, get their own single threaded scheduler
+    IScheduler &scheduler           = Scheduler::get();
+    IScheduler &accessors_scheduler = SingleThreadScheduler::get();
+    auto        run_jobs            = [&](std::vector<ConcurrentJob> &jobs)
+    {
+        if(workload.accessors_dispatcher != nullptr)
+        {
+            run_jobs_concurrently(*workload.accessors_dispatcher, jobs);
+        }
+        else
+        {
+            // No thread available to overlap the accessors with the execution of the graph
+            for(auto &job : jobs)
+            {
+                job.function();
+            }
+        }
+    };
+
+    // Fill the inputs of the first execution
+    bool                       valid_inputs = true;
+    std::vector<ConcurrentJob> first_jobs;
+    first_jobs.push_back(ConcurrentJob{ &accessors_scheduler, [&]()
+    {
+        valid_inputs = call_staging_accessors(inputs, 0);
+    } });
+    run_jobs(first_jobs);
+    if(!valid_inputs)
+    {
+        return;
+    }
+
+    bool         has_outputs = false;
+    unsigned int output_slot = 0;
+    for(unsigned int slot = 0;; slot = 1 - slot)
+    {
+        copy_staging_buffers(inputs, slot, true);
+
+        // Fill the inputs of the next execution and consume the outputs of the previous one while the current one runs
+        bool valid_outputs = true;
+
+        std::vector<ConcurrentJob> jobs;
+        jobs.push_back(ConcurrentJob{ &scheduler, [&]()
+        {
+            call_all_tasks(workload);
+        } });
+        jobs.push_back(ConcurrentJob{ &accessors_scheduler, [&]()
+        {
+            valid_inputs = call_staging_accessors(inputs, 1 - slot);
+        } });
+        if(has_outputs)
+        {
+            jobs.push_back(ConcurrentJob{ &accessors_scheduler, [&]()
+            {
+                valid_outputs = call_staging_accessors(outputs, output_slot);
+            } });
+        }
+        run_jobs(jobs);
+
+        // Keep the outputs of the current execution only if the previous ones were consumed
+        has_outputs = false;
+        if(valid_outputs)
+        {
+            copy_staging_buffers(outputs, slot, false);
+            has_outputs = true;
+            output_slot = slot;
+        }
+
+        if(!valid_inputs || !valid_outputs)
+        {
+            break;
+        }
+    }
+
+    // Consume the outputs of the last execution
+    if(has_outputs)
+    {
+        std::vector<ConcurrentJob> last_jobs;
+        last_jobs.push_back(ConcurrentJob{ &accessors_scheduler, [&]()
+        {
+            call_staging_accessors(outputs, output_slot);
+        } });
+        run_jobs(last_jobs);
+    }
+}
+
 bool call_all_output_node_accessors(ExecutionWorkload &workload)
 {
     bool is_valid = true;
@@ -49,6 +49,11 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+MemoryReport Stream::memory_report()
+{
+    return _manager.memory_report(_g);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
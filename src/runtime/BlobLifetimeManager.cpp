@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <numeric>
 
 using namespace arm_compute;
 
@@ -51,6 +52,14 @@ MappingType BlobLifetimeManager::mapping_type() const
     return MappingType::BLOBS;
 }
 
+size_t BlobLifetimeManager::pool_size() const
+{
+    return std::accumulate(std::begin(_blobs), std::end(_blobs), static_cast<size_t>(0), [](size_t total, const BlobInfo &bi)
+    {
+        return total + bi.size;
+    });
+}
+
 void BlobLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
@@ -28,14 +28,25 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/CPUUtils.h"
+#include "support/ToolchainSupport.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <mutex>
+#include <numeric>
 #include <system_error>
 #include <thread>
 
+#ifndef BARE_METAL
+#include <sched.h>
+#endif /* BARE_METAL */
+
 namespace arm_compute
 {
 namespace
@@ -88,13 +99,284 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
     while(feeder.get_next(workload_index));
 }
 
+/** Bind the calling thread to a given core.
+ *
+ * @param[in] core_id Id of the core to bind the thread to.
+ *
+ * @return True if the thread was successfully bound to the core.
+ */
+bool set_thread_affinity(unsigned int core_id)
+{
+#if !defined(BARE_METAL) && !defined(__APPLE__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core_id, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else  /* !defined(BARE_METAL) && !defined(__APPLE__) */
+    ARM_COMPUTE_UNUSED(core_id);
+    return false;
+#endif /* !defined(BARE_METAL) && !defined(__APPLE__) */
+}
+
+/** Rough estimate of the relative throughput of a core based on its model.
+ *
+ * @param[in] model Model of the core.
+ *
+ * @return The estimated throughput relative to an in-order core.
+ */
+float estimated_throughput(CPUModel model)
+{
+    switch(model)
+    {
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+            return 1.f;
+        default:
+            return 2.5f;
+    }
+}
+
+/** Time a short arithmetic benchmark on the calling thread.
+ *
+ * @return The throughput of the calling thread in iterations per second.
+ */
+float benchmark_throughput()
+{
+    constexpr unsigned int num_elements = 256;
+    constexpr unsigned int num_runs     = 2000;
+
+    std::array<float, num_elements> data{};
+    const auto start = std::chrono::steady_clock::now();
+    for(unsigned int r = 0; r < num_runs; ++r)
+    {
+        for(auto &d : data)
+        {
+            d = d * 0.999f + 0.001f;
+        }
+    }
+    const std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Make sure the compiler doesn't optimise the loop away
+    volatile float sink = std::accumulate(data.begin(), data.end(), 0.f);
+    ARM_COMPUTE_UNUSED(sink);
+
+    return num_runs / std::max(elapsed.count(), std::numeric_limits<float>::min());
+}
+
+/** Compute the boundaries of the sub-windows when splitting a dimension proportionally to some weights.
+ *
+ * Each sub-window gets at least one iteration.
+ *
+ * @param[in] dim     Dimension to split. Must have at least weights.size() iterations.
+ * @param[in] weights Weight of each sub-window.
+ *
+ * @return The weights.size() + 1 boundaries of the sub-windows.
+ */
+std::vector<int> weighted_split_boundaries(const Window::Dimension &dim, const std::vector<float> &weights)
+{
+    const int num_iterations = (dim.end() - dim.start()) / dim.step();
+    const int num_windows    = weights.size();
+    ARM_COMPUTE_ERROR_ON(num_iterations < num_windows);
+
+    const float      total_weight = std::accumulate(weights.begin(), weights.end(), 0.f);
+    std::vector<int> boundaries(num_windows + 1);
+    boundaries[0]           = dim.start();
+    boundaries[num_windows] = dim.end();
+
+    float cumulated_weight = 0.f;
+    int   prev_iteration   = 0;
+    for(int i = 1; i < num_windows; ++i)
+    {
+        cumulated_weight += weights[i - 1];
+        int iteration  = static_cast<int>(num_iterations * cumulated_weight / total_weight + 0.5f);
+        iteration      = std::max(prev_iteration + 1, std::min(iteration, num_iterations - (num_windows - i)));
+        boundaries[i]  = dim.start() + iteration * dim.step();
+        prev_iteration = iteration;
+    }
+    return boundaries;
+}
+
+/** Hint the CPU that we are in a spin-wait loop. */
+inline void cpu_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::
+                             : "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+}
+
+/** Busy-wait until the given condition is met or the spin time has elapsed.
+ *
+ * @param[in] cond      Condition to poll.
+ * @param[in] spin_time Maximum time to spin for.
+ *
+ * @return True if the condition was met, false if the spin time elapsed first.
+ */
+template <typename Cond>
+bool spin_until(Cond &&cond, std::chrono::microseconds spin_time)
+{
+    const auto   deadline = std::chrono::steady_clock::now() + spin_time;
+    unsigned int i        = 0;
+    while(!cond())
+    {
+        cpu_relax();
+        // Only poll the clock every few iterations as it is more expensive than the condition
+        if((++i & 0x3Fu) == 0 && std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+    }
+    return true;
+}
 } //namespace
 
+/** Dispatch state shared by all the workers in @ref CPPScheduler::WakeupMode::SPIN_THEN_PARK mode.
+ *
+ * A new job is published by bumping an epoch counter which the workers poll for a bounded time before parking on a condition variable.
+ * The epoch and the number of workers taking part in the job are packed into a single atomic word so that a worker can decide whether
+ * it takes part in a job without reading any other shared state.
+ * Completion is tracked by a single counter that every participating worker decrements when it runs out of workloads.
+ */
+class CPPScheduler::SpinDispatcher
+{
+public:
+    /** Constructor
+     *
+     * @param[in] spin_time Maximum time to spin for before parking.
+     */
+    explicit SpinDispatcher(std::chrono::microseconds spin_time)
+        : _spin_time(spin_time)
+    {
+    }
+    /** Publish a new job and arm the completion barrier.
+     *
+     * @param[in] workloads   Workloads to run. Pass nullptr to request the workers to exit.
+     * @param[in] feeder      Feeder shared by all the threads taking part in the job.
+     * @param[in] info        Threading info of the job (The thread_id is set by each worker).
+     * @param[in] num_workers Number of worker threads taking part in the job: the workers with an index lower than num_workers.
+     */
+    void publish(std::vector<IScheduler::Workload> *workloads, ThreadFeeder *feeder, const ThreadInfo &info, unsigned int num_workers)
+    {
+        ARM_COMPUTE_ERROR_ON(num_workers > _max_workers);
+        _workloads = workloads;
+        _feeder    = feeder;
+        _info      = info;
+        _pending.store(num_workers, std::memory_order_relaxed);
+        _epoch++;
+        _state.store((_epoch << _epoch_shift) | num_workers);
+        if(_num_parked.load() != 0)
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _job_cv.notify_all();
+        }
+    }
+    /** Wait for a job more recent than @p last_state to be published.
+     *
+     * @param[in] last_state State returned by the previous call (0 for the first call).
+     *
+     * @return The state of the new job.
+     */
+    uint64_t wait_for_job(uint64_t last_state)
+    {
+        uint64_t state = 0;
+        auto     has_new_job = [&]()
+        {
+            state = _state.load(std::memory_order_acquire);
+            return state != last_state;
+        };
+        if(!spin_until(has_new_job, _spin_time))
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _num_parked.fetch_add(1);
+            _job_cv.wait(lock, [&]()
+            {
+                state = _state.load();
+                return state != last_state;
+            });
+            _num_parked.fetch_sub(1);
+        }
+        return state;
+    }
+    /** Returns true if the worker with the given index takes part in the job described by @p state */
+    static bool is_participant(uint64_t state, unsigned int index)
+    {
+        return index < (state & _max_workers);
+    }
+    /** Signal the completion of a worker's share of the current job. */
+    void arrive()
+    {
+        if(_pending.fetch_sub(1) == 1 && _main_parked.load())
+        {
+            std::lock_guard<std::mutex> lock(_m);
+            _done_cv.notify_one();
+        }
+    }
+    /** Wait for all the workers taking part in the current job to complete. */
+    void wait_for_completion()
+    {
+        auto is_done = [&]()
+        {
+            return _pending.load(std::memory_order_acquire) == 0;
+        };
+        if(!spin_until(is_done, _spin_time))
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _main_parked.store(true);
+            _done_cv.wait(lock, [&]()
+            {
+                return _pending.load() == 0;
+            });
+            _main_parked.store(false);
+        }
+    }
+    /** Workloads of the current job (nullptr means the workers must exit) */
+    std::vector<IScheduler::Workload> *workloads() const
+    {
+        return _workloads;
+    }
+    /** Feeder of the current job */
+    ThreadFeeder *feeder() const
+    {
+        return _feeder;
+    }
+    /** Threading info of the current job */
+    const ThreadInfo &info() const
+    {
+        return _info;
+    }
+
+private:
+    static constexpr unsigned int _epoch_shift = 16;
+    static constexpr uint64_t     _max_workers = (1u << _epoch_shift) - 1;
+
+    const std::chrono::microseconds    _spin_time;
+    std::vector<IScheduler::Workload> *_workloads{ nullptr };
+    ThreadFeeder                      *_feeder{ nullptr };
+    ThreadInfo                         _info{};
+    uint64_t                           _epoch{ 0 };
+    std::atomic<uint64_t>              _state{ 0 };
+    std::atomic_uint                   _pending{ 0 };
+    std::atomic_uint                   _num_parked{ 0 };
+    std::atomic_bool                   _main_parked{ false };
+    std::mutex                         _m{};
+    std::condition_variable            _job_cv{};
+    std::condition_variable            _done_cv{};
+};
+
+constexpr unsigned int CPPScheduler::SpinDispatcher::_epoch_shift;
+constexpr uint64_t     CPPScheduler::SpinDispatcher::_max_workers;
+
 class CPPScheduler::Thread
 {
 public:
-    /** Start a new thread. */
-    Thread();
+    /** Start a new thread.
+     *
+     * @param[in] index      Index of the worker in the pool.
+     * @param[in] dispatcher (Optional) Shared dispatcher to get the work from. If nullptr the thread waits for start() to be called.
+     * @param[in] core_id    (Optional) Id of the core to bind the thread to, or -1 to let the operating system place the thread.
+     */
+    Thread(unsigned int index, SpinDispatcher *dispatcher = nullptr, int core_id = -1);
 
     Thread(const Thread &) = delete;
     Thread &operator=(const Thread &) = delete;
@@ -114,14 +396,23 @@ public:
      */
     void start(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
 
-    /** Wait for the current kernel execution to complete. */
+    /** Wait for the current kernel execution to complete.
+     *
+     * @note When the thread is fed by a @ref SpinDispatcher, the completion is tracked by the dispatcher and this only rethrows the exception raised by the worker, if any.
+     */
     void wait();
 
     /** Function ran by the worker thread. */
     void worker_thread();
 
 private:
+    /** Worker loop used when the thread is fed by a @ref SpinDispatcher. */
+    void spin_worker_thread();
+
     std::thread                        _thread{};
+    unsigned int                       _index;
+    SpinDispatcher                    *_dispatcher;
+    int                                _core_id;
     ThreadInfo                         _info{};
     std::vector<IScheduler::Workload> *_workloads{ nullptr };
     ThreadFeeder                      *_feeder{ nullptr };
@@ -132,7 +423,8 @@ private:
     std::exception_ptr                 _current_exception{ nullptr };
 };
 
-CPPScheduler::Thread::Thread()
+CPPScheduler::Thread::Thread(unsigned int index, SpinDispatcher *dispatcher, int core_id)
+    : _index(index), _dispatcher(dispatcher), _core_id(core_id)
 {
     _thread = std::thread(&Thread::worker_thread, this);
 }
@@ -142,8 +434,12 @@ CPPScheduler::Thread::~Thread()
     // Make sure worker thread has ended
     if(_thread.joinable())
     {
-        ThreadFeeder feeder;
-        start(nullptr, feeder, ThreadInfo());
+        // Threads fed by a dispatcher are all stopped at once by the scheduler
+        if(_dispatcher == nullptr)
+        {
+            ThreadFeeder feeder;
+            start(nullptr, feeder, ThreadInfo());
+        }
         _thread.join();
     }
 }
@@ -163,6 +459,7 @@ void CPPScheduler::Thread::start(std::vector<IScheduler::Workload> *workloads, T
 
 void CPPScheduler::Thread::wait()
 {
+    if(_dispatcher == nullptr)
     {
         std::unique_lock<std::mutex> lock(_m);
         _cv.wait(lock, [&] { return _job_complete; });
@@ -170,12 +467,65 @@ void CPPScheduler::Thread::wait()
 
     if(_current_exception)
     {
-        std::rethrow_exception(_current_exception);
+        std::exception_ptr e = _current_exception;
+        _current_exception   = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+void CPPScheduler::Thread::spin_worker_thread()
+{
+    uint64_t state = 0;
+    while(true)
+    {
+        state = _dispatcher->wait_for_job(state);
+
+        // Workers which are not taking part in the job must not read the job's data as it might be updated at any time
+        if(!SpinDispatcher::is_participant(state, _index))
+        {
+            continue;
+        }
+
+        // Time to exit
+        if(_dispatcher->workloads() == nullptr)
+        {
+            return;
+        }
+
+        ThreadInfo info = _dispatcher->info();
+        info.thread_id  = _index;
+        info.cpu_id     = _core_id;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            process_workloads(*_dispatcher->workloads(), *_dispatcher->feeder(), info);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _dispatcher->arrive();
     }
 }
 
 void CPPScheduler::Thread::worker_thread()
 {
+    if(_core_id >= 0 && !set_thread_affinity(_core_id))
+    {
+        // Report the thread as not bound so that kernels don't rely on it
+        _core_id = -1;
+    }
+
+    if(_dispatcher != nullptr)
+    {
+        spin_worker_thread();
+        return;
+    }
+
     while(true)
     {
         std::unique_lock<std::mutex> lock(_m);
@@ -194,6 +544,7 @@ void CPPScheduler::Thread::worker_thread()
         try
         {
 #endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            _info.cpu_id = _core_id;
             process_workloads(*_workloads, *_feeder, _info);
 
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
@@ -217,14 +568,72 @@ CPPScheduler &CPPScheduler::get()
 
 CPPScheduler::CPPScheduler()
     : _num_threads(num_threads_hint()),
-      _threads(_num_threads - 1)
+      _wakeup_mode(WakeupMode::BLOCKING),
+      _spin_time(0),
+      _affinity_policy(AffinityPolicy::NONE),
+      _affinity_cores(),
+      _thread_weights(),
+      _dispatcher(nullptr),
+      _threads()
+{
+    create_threads();
+}
+
+CPPScheduler::~CPPScheduler()
 {
+    if(_dispatcher != nullptr)
+    {
+        ThreadFeeder feeder;
+        _dispatcher->publish(nullptr, &feeder, ThreadInfo(), _threads.size());
+    }
+    _threads.clear();
+}
+
+void CPPScheduler::create_threads()
+{
+    // Stop the workers of the current pool
+    if(_dispatcher != nullptr)
+    {
+        ThreadFeeder feeder;
+        _dispatcher->publish(nullptr, &feeder, ThreadInfo(), _threads.size());
+    }
+    _threads.clear();
+    _thread_weights.clear();
+
+    // Work out the cores the workers are bound to
+    std::vector<unsigned int> cores;
+    switch(_affinity_policy)
+    {
+        case AffinityPolicy::NONE:
+            break;
+        case AffinityPolicy::LINEAR:
+            for(unsigned int i = 0; i < _cpu_info.get_cpu_num(); ++i)
+            {
+                cores.push_back(i);
+            }
+            break;
+        case AffinityPolicy::BIG_CORES:
+            cores = get_big_cores(_cpu_info);
+            break;
+        case AffinityPolicy::CUSTOM:
+            cores = _affinity_cores;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unknown affinity policy");
+    }
+
+    _dispatcher = (_wakeup_mode == WakeupMode::SPIN_THEN_PARK) ? support::cpp14::make_unique<SpinDispatcher>(_spin_time) : nullptr;
+    for(unsigned int i = 0; i < _num_threads - 1; ++i)
+    {
+        const int core_id = cores.empty() ? -1 : static_cast<int>(cores[i % cores.size()]);
+        _threads.emplace_back(i, _dispatcher.get(), core_id);
+    }
 }
 
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
-    _threads.resize(_num_threads - 1);
+    create_threads();
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -232,6 +641,75 @@ unsigned int CPPScheduler::num_threads() const
     return _num_threads;
 }
 
+void CPPScheduler::set_wakeup_mode(WakeupMode mode, std::chrono::microseconds spin_time)
+{
+    _wakeup_mode = mode;
+    _spin_time   = spin_time;
+    create_threads();
+}
+
+CPPScheduler::WakeupMode CPPScheduler::wakeup_mode() const
+{
+    return _wakeup_mode;
+}
+
+void CPPScheduler::set_affinity_policy(AffinityPolicy policy, const std::vector<unsigned int> &cores)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(policy == AffinityPolicy::CUSTOM && cores.empty(), "A list of cores must be provided with the custom affinity policy");
+    _affinity_policy = policy;
+    _affinity_cores  = cores;
+    create_threads();
+}
+
+CPPScheduler::AffinityPolicy CPPScheduler::affinity_policy() const
+{
+    return _affinity_policy;
+}
+
+void CPPScheduler::set_thread_weights(const std::vector<float> &weights)
+{
+    ARM_COMPUTE_ERROR_ON(!weights.empty() && weights.size() != _num_threads);
+    ARM_COMPUTE_ERROR_ON(std::any_of(weights.begin(), weights.end(), [](float w)
+    {
+        return w <= 0.f;
+    }));
+    _thread_weights = weights;
+}
+
+const std::vector<float> &CPPScheduler::thread_weights() const
+{
+    return _thread_weights;
+}
+
+void CPPScheduler::calibrate_thread_weights(WeightCalibration method)
+{
+    // Run one workload per thread: every thread starts with the workload matching its id and there is nothing left to steal afterwards
+    std::vector<float>                weights(_num_threads, 1.f);
+    std::vector<IScheduler::Workload> workloads(_num_threads);
+    for(auto &workload : workloads)
+    {
+        workload = [&weights, method](const ThreadInfo & info)
+        {
+            switch(method)
+            {
+                case WeightCalibration::CPU_MODEL:
+                {
+                    const CPUModel model = info.cpu_id >= 0 ? info.cpu_info->get_cpu_model(info.cpu_id) : info.cpu_info->get_cpu_model();
+                    weights[info.thread_id] = estimated_throughput(model);
+                    break;
+                }
+                case WeightCalibration::BENCHMARK:
+                    weights[info.thread_id] = benchmark_throughput();
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unknown calibration method");
+            }
+        };
+    }
+    run_workloads(workloads);
+    set_thread_weights(weights);
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -245,11 +723,23 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     info.cpu_info          = &_cpu_info;
     info.num_threads       = num_threads;
     unsigned int t         = 0;
-    auto         thread_it = _threads.begin();
-    for(; t < num_threads - 1; ++t, ++thread_it)
+    if(_dispatcher != nullptr)
     {
-        info.thread_id = t;
-        thread_it->start(&workloads, feeder, info);
+        // Wake up all the workers at once
+        t = num_threads - 1;
+        if(t > 0)
+        {
+            _dispatcher->publish(&workloads, &feeder, info, t);
+        }
+    }
+    else
+    {
+        auto thread_it = _threads.begin();
+        for(; t < num_threads - 1; ++t, ++thread_it)
+        {
+            info.thread_id = t;
+            thread_it->start(&workloads, feeder, info);
+        }
     }
 
     info.thread_id = t;
@@ -258,6 +748,10 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     try
     {
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        if(_dispatcher != nullptr)
+        {
+            _dispatcher->wait_for_completion();
+        }
         for(auto &thread : _threads)
         {
             thread.wait();
@@ -277,7 +771,7 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
     const Window      &max_window     = kernel->window();
-    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int num_iterations = num_split_iterations(max_window, hints);
     const unsigned int num_threads    = std::min(num_iterations, _num_threads);
 
     if(num_iterations == 0)
@@ -293,29 +787,50 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     }
     else
     {
-        unsigned int num_windows = 0;
+        unsigned int max_windows = 0;
         switch(hints.strategy())
         {
             case StrategyHint::STATIC:
-                num_windows = num_threads;
+                max_windows = num_threads;
                 break;
             case StrategyHint::DYNAMIC:
             {
                 // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
                 const unsigned int max_iterations = static_cast<unsigned int>(_num_threads) * 3;
-                num_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
+                max_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
                 break;
             }
             default:
                 ARM_COMPUTE_ERROR("Unknown strategy");
         }
+        const std::pair<unsigned int, unsigned int> grid        = split_grid(max_window, hints, max_windows);
+        const unsigned int                          num_windows = grid.first * grid.second;
+
+        // Balance a static split according to the throughput of the threads: workload t is always run by thread t in that case
+        std::vector<int> boundaries;
+        if(hints.strategy() == StrategyHint::STATIC && !_thread_weights.empty() && grid.second == 1 && num_windows == num_threads)
+        {
+            // The last thread is the calling one whichever the number of threads used
+            std::vector<float> weights(_thread_weights.begin(), _thread_weights.begin() + num_threads - 1);
+            weights.push_back(_thread_weights.back());
+            boundaries = weighted_split_boundaries(max_window[hints.split_dimension()], weights);
+        }
+
         std::vector<IScheduler::Workload> workloads(num_windows);
         for(unsigned int t = 0; t < num_windows; t++)
         {
             //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            workloads[t] = [t, &hints, &max_window, &grid, &boundaries, &kernel](const ThreadInfo & info)
             {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                Window win = max_window;
+                if(boundaries.empty())
+                {
+                    win = split_window(max_window, hints, grid, t);
+                }
+                else
+                {
+                    win.set(hints.split_dimension(), Window::Dimension(boundaries[t], boundaries[t + 1], max_window[hints.split_dimension()].step()));
+                }
                 win.validate();
                 kernel->run(win, info);
             };
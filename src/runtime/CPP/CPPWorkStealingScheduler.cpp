@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CPUUtils.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace arm_compute
+{
+/** Range of workload indices owned by a thread.
+ *
+ * The owner pops indices from the front of the range while the other threads steal from its back.
+ * Both ends are packed into a single atomic word so that both operations are lock-free.
+ * The queue is padded to a cache line to avoid false sharing between the queues of different threads.
+ */
+class CPPWorkStealingScheduler::WorkQueue
+{
+public:
+    /** Replace the content of the queue.
+     *
+     * @note Must only be called by the owner of the queue or when no other thread is using it.
+     *
+     * @param[in] begin Index of the first workload of the range.
+     * @param[in] end   Index following the last workload of the range.
+     */
+    void reset(unsigned int begin, unsigned int end)
+    {
+        _range.value.store(pack(begin, end), std::memory_order_release);
+    }
+    /** Pop the workload at the front of the queue.
+     *
+     * @param[out] index Index of the workload to execute if the queue is not empty.
+     *
+     * @return False if the queue is empty and index wasn't set.
+     */
+    bool pop(unsigned int &index)
+    {
+        uint64_t range = _range.value.load(std::memory_order_acquire);
+        while(true)
+        {
+            const unsigned int begin = range_begin(range);
+            const unsigned int end   = range_end(range);
+            if(begin >= end)
+            {
+                return false;
+            }
+            if(_range.value.compare_exchange_weak(range, pack(begin + 1, end), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                index = begin;
+                return true;
+            }
+        }
+    }
+    /** Steal half of the workloads left in the queue, taken from its back.
+     *
+     * @param[out] begin Index of the first stolen workload if the queue is not empty.
+     * @param[out] end   Index following the last stolen workload if the queue is not empty.
+     *
+     * @return False if the queue is empty and begin / end weren't set.
+     */
+    bool steal(unsigned int &begin, unsigned int &end)
+    {
+        uint64_t range = _range.value.load(std::memory_order_acquire);
+        while(true)
+        {
+            const unsigned int cur_begin = range_begin(range);
+            const unsigned int cur_end   = range_end(range);
+            if(cur_begin >= cur_end)
+            {
+                return false;
+            }
+            const unsigned int new_end = cur_end - (cur_end - cur_begin + 1) / 2;
+            if(_range.value.compare_exchange_weak(range, pack(cur_begin, new_end), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                begin = new_end;
+                end   = cur_end;
+                return true;
+            }
+        }
+    }
+
+private:
+    static uint64_t pack(unsigned int begin, unsigned int end)
+    {
+        return (static_cast<uint64_t>(begin) << 32) | end;
+    }
+    static unsigned int range_begin(uint64_t range)
+    {
+        return static_cast<unsigned int>(range >> 32);
+    }
+    static unsigned int range_end(uint64_t range)
+    {
+        return static_cast<unsigned int>(range & 0xFFFFFFFFu);
+    }
+
+    static constexpr size_t cache_line_size = 64;
+
+    /** Range padded to a cache line so that the ranges of two queues never share a cache line */
+    struct PaddedRange
+    {
+        std::atomic<uint64_t> value{ 0 };
+        char                  padding[cache_line_size - sizeof(std::atomic<uint64_t>)];
+    };
+
+    PaddedRange _range{};
+};
+
+namespace
+{
+/** Execute the workloads of the calling thread's queue then steal workloads from the other threads' queues until they're all empty.
+ *
+ * @param[in]     workloads The array of workloads
+ * @param[in,out] queues    The queues of all the threads taking part in the execution (info.num_threads queues).
+ * @param[in]     info      Threading and CPU info.
+ */
+template <typename Queue>
+void process_workloads(std::vector<IScheduler::Workload> &workloads, Queue *queues, const ThreadInfo &info)
+{
+    const unsigned int thread_id   = info.thread_id;
+    const unsigned int num_threads = info.num_threads;
+    Queue             &own_queue   = queues[thread_id];
+
+    unsigned int workload_index = 0;
+    while(true)
+    {
+        while(own_queue.pop(workload_index))
+        {
+            ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+            workloads[workload_index](info);
+        }
+
+        // Own queue is empty: look for a victim, starting with our neighbour so that thieves spread across the victims
+        bool         stolen = false;
+        unsigned int begin  = 0;
+        unsigned int end    = 0;
+        for(unsigned int i = 1; i < num_threads && !stolen; ++i)
+        {
+            stolen = queues[(thread_id + i) % num_threads].steal(begin, end);
+        }
+        if(!stolen)
+        {
+            return;
+        }
+
+        // Publish what we don't run straight away so that it can be stolen in turn
+        own_queue.reset(begin + 1, end);
+        ARM_COMPUTE_ERROR_ON(begin >= workloads.size());
+        workloads[begin](info);
+    }
+}
+} // namespace
+
+class CPPWorkStealingScheduler::Thread
+{
+public:
+    /** Start a new thread. */
+    Thread();
+
+    Thread(const Thread &) = delete;
+    Thread &operator=(const Thread &) = delete;
+    Thread(Thread &&)                 = delete;
+    Thread &operator=(Thread &&) = delete;
+
+    /** Destructor. Make the thread join. */
+    ~Thread();
+
+    /** Request the worker thread to start executing workloads.
+     *
+     * The thread will start by executing the workloads of queues[info.thread_id] and will then steal workloads from the other queues.
+     *
+     * @note This function will return as soon as the workloads have been sent to the worker thread.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start(std::vector<IScheduler::Workload> *workloads, WorkQueue *queues, const ThreadInfo &info);
+
+    /** Wait for the current kernel execution to complete. */
+    void wait();
+
+    /** Function ran by the worker thread. */
+    void worker_thread();
+
+private:
+    std::thread                        _thread{};
+    ThreadInfo                         _info{};
+    std::vector<IScheduler::Workload> *_workloads{ nullptr };
+    WorkQueue                         *_queues{ nullptr };
+    std::mutex                         _m{};
+    std::condition_variable            _cv{};
+    bool                               _wait_for_work{ false };
+    bool                               _job_complete{ true };
+    std::exception_ptr                 _current_exception{ nullptr };
+};
+
+CPPWorkStealingScheduler::Thread::Thread()
+{
+    _thread = std::thread(&Thread::worker_thread, this);
+}
+
+CPPWorkStealingScheduler::Thread::~Thread()
+{
+    // Make sure worker thread has ended
+    if(_thread.joinable())
+    {
+        start(nullptr, nullptr, ThreadInfo());
+        _thread.join();
+    }
+}
+
+void CPPWorkStealingScheduler::Thread::start(std::vector<IScheduler::Workload> *workloads, WorkQueue *queues, const ThreadInfo &info)
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _workloads     = workloads;
+        _queues        = queues;
+        _info          = info;
+        _wait_for_work = true;
+        _job_complete  = false;
+    }
+    _cv.notify_one();
+}
+
+void CPPWorkStealingScheduler::Thread::wait()
+{
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _job_complete; });
+    }
+
+    if(_current_exception)
+    {
+        std::rethrow_exception(_current_exception);
+    }
+}
+
+void CPPWorkStealingScheduler::Thread::worker_thread()
+{
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _wait_for_work; });
+        _wait_for_work = false;
+
+        _current_exception = nullptr;
+
+        // Time to exit
+        if(_workloads == nullptr)
+        {
+            return;
+        }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
+            process_workloads(*_workloads, _queues, _info);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _job_complete = true;
+        lock.unlock();
+        _cv.notify_one();
+    }
+}
+
+CPPWorkStealingScheduler &CPPWorkStealingScheduler::get()
+{
+    static CPPWorkStealingScheduler scheduler;
+    return scheduler;
+}
+
+CPPWorkStealingScheduler::CPPWorkStealingScheduler()
+    : _num_threads(num_threads_hint()),
+      _chunks_per_thread(8),
+      _queues(new WorkQueue[_num_threads]),
+      _threads(_num_threads - 1)
+{
+}
+
+CPPWorkStealingScheduler::~CPPWorkStealingScheduler() = default;
+
+void CPPWorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    _num_threads = num_threads == 0 ? num_threads_hint() : num_threads;
+    _queues.reset(new WorkQueue[_num_threads]);
+    _threads.resize(_num_threads - 1);
+}
+
+unsigned int CPPWorkStealingScheduler::num_threads() const
+{
+    return _num_threads;
+}
+
+void CPPWorkStealingScheduler::set_chunks_per_thread(unsigned int chunks_per_thread)
+{
+    ARM_COMPUTE_ERROR_ON(chunks_per_thread == 0);
+    _chunks_per_thread = chunks_per_thread;
+}
+
+unsigned int CPPWorkStealingScheduler::chunks_per_thread() const
+{
+    return _chunks_per_thread;
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void CPPWorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    const unsigned int num_workloads = workloads.size();
+    const unsigned int num_threads   = std::min(_num_threads, num_workloads);
+    if(num_threads < 1)
+    {
+        return;
+    }
+
+    // Initially hand each thread a contiguous share of the workloads
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        _queues[t].reset(t * num_workloads / num_threads, (t + 1) * num_workloads / num_threads);
+    }
+
+    ThreadInfo info;
+    info.cpu_info          = &_cpu_info;
+    info.num_threads       = num_threads;
+    unsigned int t         = 0;
+    auto         thread_it = _threads.begin();
+    for(; t < num_threads - 1; ++t, ++thread_it)
+    {
+        info.thread_id = t;
+        thread_it->start(&workloads, _queues.get(), info);
+    }
+
+    info.thread_id = t;
+    process_workloads(workloads, _queues.get(), info);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for(auto &thread : _threads)
+        {
+            thread.wait();
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void CPPWorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const Window      &max_window     = kernel->window();
+    const unsigned int num_iterations = num_split_iterations(max_window, hints);
+    const unsigned int num_threads    = std::min(num_iterations, _num_threads);
+
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
+    if(!kernel->is_parallelisable() || num_threads == 1)
+    {
+        ThreadInfo info;
+        info.cpu_info = &_cpu_info;
+        kernel->run(max_window, info);
+    }
+    else
+    {
+        const std::pair<unsigned int, unsigned int> grid        = split_grid(max_window, hints, std::min(num_iterations, num_threads * _chunks_per_thread));
+        const unsigned int                          num_windows = grid.first * grid.second;
+        std::vector<IScheduler::Workload>           workloads(num_windows);
+        for(unsigned int t = 0; t < num_windows; t++)
+        {
+            //Capture 't' by copy, all the other variables by reference:
+            workloads[t] = [t, &hints, &max_window, &grid, &kernel](const ThreadInfo & info)
+            {
+                Window win = split_window(max_window, hints, grid, t);
+                win.validate();
+                kernel->run(win, info);
+            };
+        }
+        run_workloads(workloads);
+    }
+}
+} // namespace arm_compute
@@ -457,4 +457,25 @@ unsigned int get_threads_hint()
     return num_threads_hint;
 }
 
+std::vector<unsigned int> get_big_cores(const CPUInfo &cpuinfo)
+{
+    std::vector<unsigned int> big_cores;
+    std::vector<unsigned int> all_cores;
+    for(unsigned int i = 0; i < cpuinfo.get_cpu_num(); ++i)
+    {
+        switch(cpuinfo.get_cpu_model(i))
+        {
+            case CPUModel::A53:
+            case CPUModel::A55r0:
+            case CPUModel::A55r1:
+                break;
+            default:
+                big_cores.push_back(i);
+                break;
+        }
+        all_cores.push_back(i);
+    }
+    return big_cores.empty() ? all_cores : big_cores;
+}
+
 } // namespace arm_compute
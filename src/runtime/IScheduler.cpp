@@ -24,10 +24,24 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/CPUUtils.h"
 
+#include <limits>
+
 namespace arm_compute
 {
+namespace
+{
+/** Number of iterations of the largest sub-window when splitting num_iterations into num_windows using @ref Window::split_window */
+unsigned int largest_split(unsigned int num_iterations, unsigned int num_windows)
+{
+    return num_iterations - (num_windows - 1) * (num_iterations / num_windows);
+}
+} // namespace
+
+constexpr unsigned int IScheduler::Hints::no_split_dimension;
+
 IScheduler::IScheduler()
     : _cpu_info()
 {
@@ -45,6 +59,57 @@ unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
+
+unsigned int IScheduler::num_split_iterations(const Window &window, const Hints &hints)
+{
+    unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+    if(hints.secondary_split_dimension() != Hints::no_split_dimension)
+    {
+        ARM_COMPUTE_ERROR_ON(hints.secondary_split_dimension() == hints.split_dimension());
+        num_iterations *= window.num_iterations(hints.secondary_split_dimension());
+    }
+    return num_iterations;
+}
+
+std::pair<unsigned int, unsigned int> IScheduler::split_grid(const Window &window, const Hints &hints, unsigned int max_windows)
+{
+    ARM_COMPUTE_ERROR_ON(max_windows == 0);
+
+    const unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+    if(hints.secondary_split_dimension() == Hints::no_split_dimension || num_iterations >= max_windows)
+    {
+        return std::make_pair(std::min(num_iterations, max_windows), 1u);
+    }
+
+    // Pick the grid with the smallest largest sub-window, favouring the split dimension in case of a tie
+    const unsigned int                    num_iterations_secondary = window.num_iterations(hints.secondary_split_dimension());
+    std::pair<unsigned int, unsigned int> grid(1u, 1u);
+    unsigned int                          best_cost = std::numeric_limits<unsigned int>::max();
+    for(unsigned int n0 = num_iterations; n0 > 0; --n0)
+    {
+        const unsigned int n1   = std::max(1u, std::min(num_iterations_secondary, max_windows / n0));
+        const unsigned int cost = largest_split(num_iterations, n0) * largest_split(num_iterations_secondary, n1);
+        if(cost < best_cost)
+        {
+            best_cost = cost;
+            grid      = std::make_pair(n0, n1);
+        }
+    }
+    return grid;
+}
+
+Window IScheduler::split_window(const Window &window, const Hints &hints, const std::pair<unsigned int, unsigned int> &grid, unsigned int id)
+{
+    ARM_COMPUTE_ERROR_ON(id >= grid.first * grid.second);
+
+    Window win = window.split_window(hints.split_dimension(), id % grid.first, grid.first);
+    if(grid.second > 1)
+    {
+        win = win.split_window(hints.secondary_split_dimension(), id / grid.first, grid.second);
+    }
+    return win;
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
@@ -38,7 +38,7 @@
 using namespace arm_compute;
 
 ISimpleLifetimeManager::ISimpleLifetimeManager()
-    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
+    : _active_group(nullptr), _timestamp(0), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
 {
 }
 
@@ -68,7 +68,8 @@ void ISimpleLifetimeManager::start_lifetime(void *obj)
     }
 
     // Insert object in groups and mark its finalized state to false
-    _active_elements.insert(std::make_pair(obj, obj));
+    Element &el       = _active_elements.insert(std::make_pair(obj, obj)).first->second;
+    el.lifetime_start = _timestamp++;
 }
 
 void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
@@ -80,11 +81,12 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     ARM_COMPUTE_ERROR_ON(active_object_it == std::end(_active_elements));
 
     // Update object fields and mark object as complete
-    Element &el  = active_object_it->second;
-    el.handle    = &obj_memory;
-    el.size      = size;
-    el.alignment = alignment;
-    el.status    = true;
+    Element &el     = active_object_it->second;
+    el.handle       = &obj_memory;
+    el.size         = size;
+    el.alignment    = alignment;
+    el.status       = true;
+    el.lifetime_end = _timestamp++;
 
     // Find object in the occupied lists
     auto occupied_blob_it = std::find_if(std::begin(_occupied_blobs), std::end(_occupied_blobs), [&obj](const Blob & b)
@@ -114,6 +116,7 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
         // Reset state
         _active_elements.clear();
         _active_group = nullptr;
+        _timestamp    = 0;
         _free_blobs.clear();
     }
 }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ITransformWeights.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+ITransformWeights::~ITransformWeights()
+{
+    if(_weights_manager != nullptr)
+    {
+        _weights_manager->unregister_transform(this);
+    }
+}
+
+ITransformWeights::ITransformWeights(ITransformWeights &&other) noexcept
+    : _num_refcount(other._num_refcount), _reshape_run(other._reshape_run), _weights_manager(nullptr)
+{
+}
+
+ITransformWeights &ITransformWeights::operator=(ITransformWeights &&other) noexcept
+{
+    if(this != &other)
+    {
+        _num_refcount = other._num_refcount;
+        _reshape_run  = other._reshape_run;
+    }
+    return *this;
+}
+
+std::string ITransformWeights::content_key(const ITensor &weights)
+{
+    return WeightsCache::compute_key(uid(), weights, get_weights()->info()->total_size());
+}
+
+void ITransformWeights::import_weights(const std::shared_ptr<IMemoryRegion> &memory)
+{
+    auto *transformed_weights = dynamic_cast<Tensor *>(get_weights());
+    ARM_COMPUTE_ERROR_ON(transformed_weights == nullptr);
+    transformed_weights->allocator()->import_shared_memory(memory).throw_if_error();
+    _reshape_run = true;
+}
+
+std::shared_ptr<IMemoryRegion> ITransformWeights::shared_weights()
+{
+    auto *transformed_weights = dynamic_cast<Tensor *>(get_weights());
+    return (transformed_weights != nullptr) ? transformed_weights->allocator()->shared_memory() : nullptr;
+}
+} // namespace arm_compute
@@ -66,4 +66,9 @@ void Memory::set_owned_region(std::unique_ptr<IMemoryRegion> region)
     _region_owned = std::move(region);
     _region       = _region_owned.get();
 }
+
+std::shared_ptr<IMemoryRegion> Memory::owned_region() const
+{
+    return _region_owned;
+}
 } // namespace arm_compute
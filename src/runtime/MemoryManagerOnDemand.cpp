@@ -48,6 +48,11 @@ IPoolManager *MemoryManagerOnDemand::pool_manager()
     return _pool_mgr.get();
 }
 
+size_t MemoryManagerOnDemand::footprint() const
+{
+    return _lifetime_mgr->pool_size() * _pool_mgr->num_pools();
+}
+
 void MemoryManagerOnDemand::populate(arm_compute::IAllocator &allocator, size_t num_pools)
 {
     ARM_COMPUTE_ERROR_ON(!_lifetime_mgr);
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MmapAllocator.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
+using namespace arm_compute;
+
+namespace
+{
+#ifndef BARE_METAL
+size_t round_up(size_t value, size_t multiple)
+{
+    return ((value + multiple - 1) / multiple) * multiple;
+}
+
+size_t page_size()
+{
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/** Size of the default huge pages as reported by the kernel, 2MB if it can't be read */
+size_t huge_page_size()
+{
+    static const size_t size = []()
+    {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string   key;
+        while(meminfo >> key)
+        {
+            if(key == "Hugepagesize:")
+            {
+                size_t size_kb = 0;
+                if(meminfo >> size_kb && size_kb != 0)
+                {
+                    return size_kb * 1024;
+                }
+                break;
+            }
+            meminfo.ignore(256, '\n');
+        }
+        return static_cast<size_t>(2 * 1024 * 1024);
+    }();
+    return size;
+}
+
+/** Map @p length bytes aligned to @p alignment, unmapping the over-allocated head and tail
+ *
+ * @return The aligned mapping, MAP_FAILED on failure
+ */
+void *map_aligned(size_t length, size_t alignment)
+{
+    const size_t page = page_size();
+    if(alignment <= page)
+    {
+        return mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    const size_t extended_length = length + alignment - page;
+    void        *ptr             = mmap(nullptr, extended_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(ptr == MAP_FAILED)
+    {
+        return ptr;
+    }
+
+    const uintptr_t base    = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t aligned = round_up(base, alignment);
+    if(aligned != base)
+    {
+        munmap(ptr, aligned - base);
+    }
+    const size_t tail = extended_length - (aligned - base) - length;
+    if(tail != 0)
+    {
+        munmap(reinterpret_cast<void *>(aligned + length), tail);
+    }
+    return reinterpret_cast<void *>(aligned);
+}
+
+/** Bind a mapping to a NUMA node
+ *
+ * @note The binding is a placement hint: the mapping is still usable if the node doesn't exist or the kernel lacks NUMA support.
+ */
+void bind_to_numa_node(void *ptr, size_t length, int numa_node)
+{
+#ifdef __NR_mbind
+    constexpr int    mpol_bind     = 2; // MPOL_BIND from <numaif.h>, not included to avoid depending on libnuma
+    constexpr size_t bits_per_word = sizeof(unsigned long) * 8;
+
+    std::vector<unsigned long> nodemask(numa_node / bits_per_word + 1, 0);
+    nodemask[numa_node / bits_per_word] = 1UL << (numa_node % bits_per_word);
+    syscall(__NR_mbind, ptr, length, mpol_bind, nodemask.data(), nodemask.size() * bits_per_word + 1, 0);
+#else  /* __NR_mbind */
+    ARM_COMPUTE_UNUSED(ptr, length, numa_node);
+#endif /* __NR_mbind */
+}
+#endif /* BARE_METAL */
+} // namespace
+
+MmapAllocator::MmapAllocator(HugePageMode huge_pages, int numa_node, size_t mmap_threshold)
+    : _huge_pages(huge_pages), _numa_node(numa_node), _mmap_threshold(mmap_threshold), _mtx(), _blocks()
+{
+}
+
+void *MmapAllocator::allocate_block(size_t size, size_t alignment, Block &block) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(alignment & (alignment - 1), "Alignment must be a power of two");
+
+#ifndef BARE_METAL
+    if(size >= _mmap_threshold)
+    {
+        void *ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        // Huge pages of the reserved pool are naturally aligned to their size
+        if(_huge_pages == HugePageMode::EXPLICIT && alignment <= huge_page_size())
+        {
+            block.length = round_up(size, huge_page_size());
+            ptr          = mmap(nullptr, block.length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        }
+#endif /* MAP_HUGETLB */
+
+        if(ptr == MAP_FAILED)
+        {
+            // Transparent huge pages can only back the huge page aligned ranges of a mapping
+            const bool use_thp = _huge_pages != HugePageMode::NONE && size >= huge_page_size();
+            block.length       = round_up(size, page_size());
+            ptr                = map_aligned(block.length, use_thp ? std::max(alignment, huge_page_size()) : alignment);
+#ifdef MADV_HUGEPAGE
+            if(use_thp && ptr != MAP_FAILED)
+            {
+                madvise(ptr, block.length, MADV_HUGEPAGE);
+            }
+#endif /* MADV_HUGEPAGE */
+        }
+
+        if(ptr != MAP_FAILED)
+        {
+            // Bind before the first touch so that the pages are faulted on the requested node
+            if(_numa_node >= 0)
+            {
+                bind_to_numa_node(ptr, block.length, _numa_node);
+            }
+            block.base      = ptr;
+            block.is_mapped = true;
+            return ptr;
+        }
+    }
+#endif /* BARE_METAL */
+
+    // Heap allocation, over-allocated and aligned by hand
+    alignment    = std::max(alignment, alignof(std::max_align_t));
+    size_t space = size + alignment;
+    void  *base  = std::malloc(space);
+    if(base == nullptr)
+    {
+        return nullptr;
+    }
+    void *ptr = base;
+    support::cpp11::align(alignment, size, ptr, space);
+
+    block.base      = base;
+    block.length    = size + alignment;
+    block.is_mapped = false;
+    return ptr;
+}
+
+void MmapAllocator::release_block(const Block &block)
+{
+#ifndef BARE_METAL
+    if(block.is_mapped)
+    {
+        munmap(block.base, block.length);
+        return;
+    }
+#endif /* BARE_METAL */
+    std::free(block.base);
+}
+
+void *MmapAllocator::allocate(size_t size, size_t alignment)
+{
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    Block block{};
+    void *ptr = allocate_block(size, alignment, block);
+    ARM_COMPUTE_ERROR_ON_MSG(ptr == nullptr, "Failed to allocate memory");
+    if(ptr == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _blocks.emplace(ptr, block);
+    return ptr;
+}
+
+void MmapAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    Block block{};
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto                        it = _blocks.find(ptr);
+        if(it == _blocks.end())
+        {
+            ARM_COMPUTE_ERROR("Pointer not allocated by this allocator");
+        }
+        block = it->second;
+        _blocks.erase(it);
+    }
+    release_block(block);
+}
+
+std::unique_ptr<IMemoryRegion> MmapAllocator::make_region(size_t size, size_t alignment)
+{
+    if(size == 0)
+    {
+        return support::cpp14::make_unique<MemoryRegion>(0);
+    }
+
+    Block block{};
+    void *ptr = allocate_block(size, alignment, block);
+    ARM_COMPUTE_ERROR_ON_MSG(ptr == nullptr, "Failed to allocate memory");
+
+    // Match the zero initialisation of the default memory regions, the mapped pages are already zeroed by the kernel
+    if(!block.is_mapped)
+    {
+        std::memset(ptr, 0, size);
+    }
+
+    // The region releases its block itself so that it can outlive the allocator
+    std::shared_ptr<uint8_t> mem(static_cast<uint8_t *>(ptr), [block](uint8_t *)
+    {
+        release_block(block);
+    });
+    return support::cpp14::make_unique<MemoryRegion>(std::move(mem), size);
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionTuner.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/ToolchainSupport.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace
+{
+/** Convolution methods timed by the tuner and their names in the tuner file */
+const std::pair<ConvolutionMethod, const char *> tuned_methods[] =
+{
+    { ConvolutionMethod::GEMM, "GEMM" },
+    { ConvolutionMethod::WINOGRAD, "WINOGRAD" },
+    { ConvolutionMethod::DIRECT, "DIRECT" },
+    { ConvolutionMethod::FFT, "FFT" },
+};
+
+/** Appends a shape to a configuration identifier
+ *
+ * @param[in, out] ss    Stream holding the configuration identifier
+ * @param[in]      shape Shape to append
+ */
+void append_shape(std::stringstream &ss, const TensorShape &shape)
+{
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        ss << (d == 0 ? "_" : "x") << shape[d];
+    }
+}
+
+/** Builds the unique identifier of a convolution configuration
+ *
+ * @param[in] input            Source tensor info.
+ * @param[in] weights          Weights tensor info.
+ * @param[in] output           Destination tensor info.
+ * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+ * @param[in] dilation         Dilation, in elements, across x and y.
+ * @param[in] act_info         Activation layer information in case of a fused activation.
+ * @param[in] enable_fast_math Enable fast math computation.
+ *
+ * @return The configuration identifier
+ */
+std::string get_config_id(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                          const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    std::stringstream ss;
+    ss << "conv_" << string_from_data_type(input->data_type()) << "_" << string_from_data_layout(input->data_layout());
+    append_shape(ss, input->tensor_shape());
+    append_shape(ss, weights->tensor_shape());
+    append_shape(ss, output->tensor_shape());
+    ss << "_s" << conv_info.stride().first << "x" << conv_info.stride().second;
+    ss << "_p" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom();
+    ss << "_d" << dilation.width << "x" << dilation.height;
+    ss << "_a" << (act_info.enabled() ? static_cast<int>(act_info.activation()) : -1);
+    ss << "_f" << (enable_fast_math ? 1 : 0);
+    ss << "_t" << NEScheduler::get().num_threads();
+    return ss.str();
+}
+
+/** Creates a zero-filled tensor matching a tensor info without its padding
+ *
+ * @param[in] info      Tensor info to match
+ * @param[in] data_type Data type of the tensor
+ *
+ * @return The unallocated tensor
+ */
+std::unique_ptr<Tensor> create_tensor(const ITensorInfo &info, DataType data_type)
+{
+    TensorInfo tensor_info(info.tensor_shape(), 1, data_type, info.quantization_info());
+    tensor_info.set_data_layout(info.data_layout());
+
+    auto tensor = support::cpp14::make_unique<Tensor>();
+    tensor->allocator()->init(tensor_info);
+    return tensor;
+}
+} // namespace
+
+NEConvolutionTuner::NEConvolutionTuner(bool tune_new_configurations, unsigned int num_iterations)
+    : _method_table(), _mtx(), _tune_new_configurations(tune_new_configurations), _num_iterations(num_iterations)
+{
+    ARM_COMPUTE_ERROR_ON(num_iterations == 0);
+}
+
+void NEConvolutionTuner::set_tune_new_configurations(bool tune_new_configurations)
+{
+    _tune_new_configurations = tune_new_configurations;
+}
+
+bool NEConvolutionTuner::tune_new_configurations() const
+{
+    return _tune_new_configurations;
+}
+
+bool NEConvolutionTuner::find_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                 const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, ConvolutionMethod &method) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    const std::string config_id = get_config_id(input, weights, output, conv_info, dilation, act_info, enable_fast_math);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        p = _method_table.find(config_id);
+    if(p == _method_table.end())
+    {
+        return false;
+    }
+    method = p->second;
+    return true;
+}
+
+void NEConvolutionTuner::tune_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                 const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // The output must be initialized to time the convolution methods
+    ConvolutionMethod method = ConvolutionMethod::GEMM;
+    if(!_tune_new_configurations || output->total_size() == 0
+       || find_convolution_method(input, weights, output, conv_info, dilation, act_info, enable_fast_math, method))
+    {
+        return;
+    }
+
+    // The lock isn't held while timing, if another thread tunes the same configuration the first method stored is kept
+    if(find_optimal_method(input, weights, output, conv_info, dilation, act_info, enable_fast_math, method))
+    {
+        add_method_to_table(get_config_id(input, weights, output, conv_info, dilation, act_info, enable_fast_math), method);
+    }
+}
+
+bool NEConvolutionTuner::find_optimal_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                             const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, ConvolutionMethod &method)
+{
+    const bool       is_quantized = is_data_type_quantized_asymmetric(input->data_type());
+    const DataType   bias_type    = is_quantized ? DataType::S32 : input->data_type();
+    const TensorInfo biases_info(TensorShape(weights->dimension(3)), 1, bias_type);
+
+    double best_time = std::numeric_limits<double>::max();
+    bool   found     = false;
+
+    for(const auto &tuned_method : tuned_methods)
+    {
+        const ConvolutionMethod candidate = tuned_method.first;
+
+        // Only the GEMM-based convolution supports dilation
+        if(dilation != Size2D(1U, 1U) && candidate != ConvolutionMethod::GEMM)
+        {
+            continue;
+        }
+
+        auto src = create_tensor(*input, input->data_type());
+        auto wei = create_tensor(*weights, weights->data_type());
+        auto bia = create_tensor(biases_info, bias_type);
+        auto dst = create_tensor(*output, output->data_type());
+
+        std::unique_ptr<IFunction> function;
+        switch(candidate)
+        {
+            case ConvolutionMethod::GEMM:
+                if(bool(NEGEMMConvolutionLayer::validate(src->info(), wei->info(), bia->info(), dst->info(), conv_info, WeightsInfo(), dilation, act_info)))
+                {
+                    auto f = support::cpp14::make_unique<NEGEMMConvolutionLayer>();
+                    f->configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, WeightsInfo(), dilation, act_info);
+                    function = std::move(f);
+                }
+                break;
+            case ConvolutionMethod::WINOGRAD:
+                if(bool(NEWinogradConvolutionLayer::validate(src->info(), wei->info(), bia->info(), dst->info(), conv_info, act_info, enable_fast_math)))
+                {
+                    auto f = support::cpp14::make_unique<NEWinogradConvolutionLayer>();
+                    f->configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, act_info, enable_fast_math);
+                    function = std::move(f);
+                }
+                break;
+            case ConvolutionMethod::DIRECT:
+                if(bool(NEDirectConvolutionLayer::validate(src->info(), wei->info(), bia->info(), dst->info(), conv_info, act_info)))
+                {
+                    auto f = support::cpp14::make_unique<NEDirectConvolutionLayer>();
+                    f->configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, act_info);
+                    function = std::move(f);
+                }
+                break;
+            case ConvolutionMethod::FFT:
+                if(bool(NEFFTConvolutionLayer::validate(src->info(), wei->info(), nullptr, dst->info(), conv_info, act_info)))
+                {
+                    auto f = support::cpp14::make_unique<NEFFTConvolutionLayer>();
+                    f->configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, act_info);
+                    function = std::move(f);
+                }
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported.");
+                break;
+        }
+
+        if(function == nullptr)
+        {
+            continue;
+        }
+
+        // Allocate and zero the tensors once the function has requested its padding
+        for(auto tensor : { src.get(), wei.get(), bia.get(), dst.get() })
+        {
+            tensor->allocator()->allocate();
+            std::memset(tensor->buffer(), 0, tensor->info()->total_size());
+        }
+
+        // Warm-up run, also preparing the weights
+        function->run();
+
+        double time = std::numeric_limits<double>::max();
+        for(unsigned int i = 0; i < _num_iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function->run();
+            const auto end = std::chrono::steady_clock::now();
+            time           = std::min(time, std::chrono::duration<double>(end - start).count());
+        }
+
+        if(time < best_time)
+        {
+            best_time = time;
+            method    = candidate;
+            found     = true;
+        }
+    }
+
+    return found;
+}
+
+void NEConvolutionTuner::add_method_to_table(const std::string &config_id, ConvolutionMethod method)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _method_table.emplace(config_id, method);
+}
+
+std::unordered_map<std::string, ConvolutionMethod> NEConvolutionTuner::method_table() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _method_table;
+}
+
+void NEConvolutionTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        config_id;
+        std::string        token;
+        if(std::getline(ss, config_id, ';').fail() || std::getline(ss, token, ';').fail())
+        {
+            ARM_COMPUTE_ERROR("Malformed row '%s' in %s (Should be of the form 'config_id;method')", ss.str().c_str(), filename.c_str());
+        }
+
+        bool found = false;
+        for(const auto &tuned_method : tuned_methods)
+        {
+            if(token == tuned_method.second)
+            {
+                add_method_to_table(config_id, tuned_method.first);
+                found = true;
+                break;
+            }
+        }
+        if(!found)
+        {
+            ARM_COMPUTE_ERROR("Unknown convolution method '%s' in %s", token.c_str(), filename.c_str());
+        }
+    }
+    fs.close();
+}
+
+void NEConvolutionTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    std::lock_guard<std::mutex> lock(_mtx);
+    for(auto const &config_data : _method_table)
+    {
+        for(const auto &tuned_method : tuned_methods)
+        {
+            if(config_data.second == tuned_method.first)
+            {
+                fs << config_data.first << ";" << tuned_method.second << std::endl;
+            }
+        }
+    }
+    fs.close();
+}
+} // namespace arm_compute
@@ -35,8 +35,14 @@
 
 namespace arm_compute
 {
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
+namespace
+{
+NEConvolutionTuner *convolution_tuner = nullptr;
+} // namespace
+
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager) //NOLINT
     : _memory_manager(std::move(memory_manager)),
+      _weights_manager(weights_manager),
       _function()
 {
 }
@@ -47,21 +53,28 @@ void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_UNUSED(num_groups);
+
+    // Time the convolution methods of new configurations here, so that validate() and get_convolution_method() only look the tuned method up
+    if(convolution_tuner != nullptr && !weights_info.are_reshaped())
+    {
+        convolution_tuner->tune_convolution_method(input->info(), weights->info(), output->info(), conv_info, dilation, act_info, enable_fast_math);
+    }
+
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
                                                             enable_fast_math));
 
-    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info))
+    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math))
     {
         case ConvolutionMethod::WINOGRAD:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager, _weights_manager);
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
             _function = std::move(f);
             break;
         }
         case ConvolutionMethod::GEMM:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager, _weights_manager);
             f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
             _function = std::move(f);
             break;
@@ -75,7 +88,7 @@ void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const
         }
         case ConvolutionMethod::FFT:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(_memory_manager, _weights_manager);
             f->configure(input, weights, biases, output, conv_info, act_info);
             _function = std::move(f);
             break;
@@ -91,7 +104,7 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
 {
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
 
-    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info))
+    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math))
     {
         case ConvolutionMethod::WINOGRAD:
             //Validate Winograd
@@ -104,6 +117,7 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
         case ConvolutionMethod::DIRECT:
             //Validate Gemm-based Convolution
             ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info));
+            break;
         case ConvolutionMethod::FFT:
             // Validate FFT-based convolution layer
             ARM_COMPUTE_RETURN_ON_ERROR(NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info));
@@ -121,12 +135,28 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
                                                              const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
+
+    // Use the tuned method if available, weights reshaped in advance can only be used by the GEMM-based convolution
+    ConvolutionMethod tuned_method = ConvolutionMethod::GEMM;
+    if(convolution_tuner != nullptr && !weights_info.are_reshaped()
+       && convolution_tuner->find_convolution_method(input, weights, output, conv_info, dilation, act_info, enable_fast_math, tuned_method))
+    {
+        return tuned_method;
+    }
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
     const size_t idx_c = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
 
+    // NHWC layers with few input channels, or strided 1x1 layers, would spend most of their time and memory in im2col:
+    // read the input in place instead
+    if(input->data_layout() == DataLayout::NHWC && dilation == Size2D(1U, 1U)
+       && ((input->dimension(idx_c) < 16) || (weights->dimension(idx_w) == 1 && weights->dimension(idx_h) == 1 && conv_info.stride() != std::make_pair(1U, 1U)))
+       && bool(NEGEMMDirectConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info)))
+    {
+        return ConvolutionMethod::DIRECT;
+    }
+
     /* Input spatial dims, kernel size, IFM/OFM, conv info*/
     using ConvolutionConfiguration = std::tuple<Size2D, Size2D, Size2D, PadStrideInfo>;
     using ConfigurationMethod      = std::pair<ConvolutionConfiguration, ConvolutionMethod>;
@@ -177,6 +207,11 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
     }
 }
 
+void NEConvolutionLayer::set_tuner(NEConvolutionTuner *tuner)
+{
+    convolution_tuner = tuner;
+}
+
 void NEConvolutionLayer::run()
 {
     prepare();
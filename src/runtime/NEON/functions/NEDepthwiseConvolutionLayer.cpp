@@ -38,6 +38,16 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace arm_compute
 {
+namespace
+{
+bool is_activation_fusable(const ActivationLayerInfo &act_info)
+{
+    const ActivationLayerInfo::ActivationFunction act = act_info.activation();
+    return act_info.enabled() && (act == ActivationLayerInfo::ActivationFunction::RELU || act == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+                                  || act == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
+}
+} // namespace
+
 NEDepthwiseConvolutionLayer3x3::NEDepthwiseConvolutionLayer3x3(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _dwc_kernel(), _dwc_optimized_func(memory_manager), _output_stage_kernel(), _border_handler(), _permute_input(), _permute_weights(), _permute_output(),
       _activationlayer_function(), _accumulator(), _permuted_input(), _permuted_weights(), _permuted_output(), _original_weights(nullptr), _has_bias(false), _is_quantized(false), _is_optimized(false),
@@ -358,14 +368,53 @@ void NEDepthwiseConvolutionLayer3x3::prepare()
 }
 
 NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer()
-    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _permute_input(),
-      _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(), _permuted_weights(),
-      _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_activationlayer_enabled(false), _original_weights(nullptr)
+    : _native_kernel(), _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(),
+      _permute_input(), _permute_weights(), _permute_output(), _activationlayer_function(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(),
+      _permuted_weights(), _permuted_output(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _is_native(false), _is_activationlayer_enabled(false), _original_weights(nullptr)
 {
 }
 
 void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
                                             unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Run the depthwise convolution directly if the native kernel supports the configuration
+    _is_native = bool(NEDepthwiseConvolutionLayerNativeKernel::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info,
+                                                                         depth_multiplier, ActivationLayerInfo(), dilation));
+    if(_is_native)
+    {
+        configure_native(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation);
+    }
+    else
+    {
+        configure_generic(input, weights, biases, output, conv_info, depth_multiplier, act_info, dilation);
+    }
+}
+
+void NEDepthwiseConvolutionLayer::configure_native(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                   unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
+{
+    _is_nhwc          = true;
+    _is_quantized     = false;
+    _is_prepared      = false;
+    _original_weights = weights;
+
+    // Fuse the activation in the kernel when supported
+    const bool is_fused_act = is_activation_fusable(act_info);
+    _native_kernel.configure(input, weights, biases, output, conv_info, depth_multiplier, is_fused_act ? act_info : ActivationLayerInfo(), dilation);
+
+    //Configure Activation Layer
+    _is_activationlayer_enabled = act_info.enabled() && !is_fused_act;
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+}
+
+void NEDepthwiseConvolutionLayer::configure_generic(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                    unsigned int depth_multiplier, const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     const unsigned int channel_idx = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
     ARM_COMPUTE_UNUSED(channel_idx);
@@ -512,6 +561,16 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() == DataLayout::UNKNOWN);
     ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
 
+    if(bool(NEDepthwiseConvolutionLayerNativeKernel::validate(input, weights, biases, output, conv_info, depth_multiplier, ActivationLayerInfo(), dilation)))
+    {
+        // Validate Activation Layer if it can't be fused
+        if(act_info.enabled() && !is_activation_fusable(act_info))
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+        }
+        return Status{};
+    }
+
     const unsigned int width_idx  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const unsigned int height_idx = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
 
@@ -607,23 +666,30 @@ void NEDepthwiseConvolutionLayer::run()
 {
     prepare();
 
-    if(_is_nhwc)
+    if(_is_native)
     {
-        _permute_input.run();
+        NEScheduler::get().schedule(&_native_kernel, Window::DimY);
     }
-
-    NEScheduler::get().schedule(&_im2col_kernel, Window::DimX);
-    NEScheduler::get().schedule(&_v2mm_input_fill_border, Window::DimX);
-    NEScheduler::get().schedule(&_v2mm_kernel, Window::DimX);
-    NEScheduler::get().schedule(&_vector_to_tensor_kernel, Window::DimX);
-    if(_is_quantized)
+    else
     {
-        NEScheduler::get().schedule(&_output_stage_kernel, Window::DimX);
-    }
+        if(_is_nhwc)
+        {
+            _permute_input.run();
+        }
 
-    if(_is_nhwc)
-    {
-        _permute_output.run();
+        NEScheduler::get().schedule(&_im2col_kernel, Window::DimX);
+        NEScheduler::get().schedule(&_v2mm_input_fill_border, Window::DimX);
+        NEScheduler::get().schedule(&_v2mm_kernel, Window::DimX);
+        NEScheduler::get().schedule(&_vector_to_tensor_kernel, Window::DimX);
+        if(_is_quantized)
+        {
+            NEScheduler::get().schedule(&_output_stage_kernel, Window::DimX);
+        }
+
+        if(_is_nhwc)
+        {
+            _permute_output.run();
+        }
     }
 
     if(_is_activationlayer_enabled)
@@ -638,16 +704,20 @@ void NEDepthwiseConvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
-        if(_is_nhwc)
+        // The native kernel reads the original weights
+        if(!_is_native)
         {
-            _permute_weights.run();
-        }
+            if(_is_nhwc)
+            {
+                _permute_weights.run();
+            }
 
-        // Run reshape and mark original weights as unused
-        _weights_reshaped.allocator()->allocate();
-        NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
-        NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
-        _original_weights->mark_as_unused();
+            // Run reshape and mark original weights as unused
+            _weights_reshaped.allocator()->allocate();
+            NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
+            NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
+            _original_weights->mark_as_unused();
+        }
 
         _is_prepared = true;
     }
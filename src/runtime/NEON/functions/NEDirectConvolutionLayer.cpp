@@ -34,8 +34,8 @@
 using namespace arm_compute;
 
 NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
-      _is_activationlayer_enabled(false), _dim_split(Window::DimZ)
+    : _memory_group(memory_manager), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _gemm_direct_function(memory_manager), _accumulator(),
+      _has_bias(false), _is_activationlayer_enabled(false), _use_gemm_direct(false), _dim_split(Window::DimZ)
 {
 }
 
@@ -43,6 +43,15 @@ void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights,
 {
     ARM_COMPUTE_ERROR_ON(input->info()->data_layout() == DataLayout::UNKNOWN);
 
+    // NHWC convolutions read the input rows in place through arm_gemm, without border handling
+    _use_gemm_direct = input->info()->data_layout() == DataLayout::NHWC
+                       && bool(NEGEMMDirectConvolutionLayer::validate(input->info(), weights->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), conv_info, act_info));
+    if(_use_gemm_direct)
+    {
+        _gemm_direct_function.configure(input, weights, bias, output, conv_info, act_info);
+        return;
+    }
+
     // Free accumulator
     if(_accumulator.buffer() != nullptr)
     {
@@ -76,6 +85,11 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
 
+    if(input->data_layout() == DataLayout::NHWC && bool(NEGEMMDirectConvolutionLayer::validate(input, weights, bias, output, conv_info, act_info)))
+    {
+        return Status{};
+    }
+
     DataType   data_type = output->data_type();
     TensorInfo accumulator(output->clone()->set_is_resizable(true).reset_padding().set_data_type(data_type));
 
@@ -103,6 +117,12 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 
 void NEDirectConvolutionLayer::run()
 {
+    if(_use_gemm_direct)
+    {
+        _gemm_direct_function.run();
+        return;
+    }
+
     NEScheduler::get().schedule(&_input_border_handler, Window::DimZ);
 
     MemoryGroupResourceScope scope_mg(_memory_group);
@@ -118,3 +138,11 @@ void NEDirectConvolutionLayer::run()
         _activationlayer_function.run();
     }
 }
+
+void NEDirectConvolutionLayer::prepare()
+{
+    if(_use_gemm_direct)
+    {
+        _gemm_direct_function.prepare();
+    }
+}
@@ -30,8 +30,22 @@
 
 namespace arm_compute
 {
+namespace
+{
+bool is_real_to_half_spectrum(const ITensorInfo *input, const ITensorInfo *output)
+{
+    return (input->num_channels() == 1) && (output->num_channels() == 2) && (output->total_size() != 0) && (input->dimension(0) != output->dimension(0));
+}
+
+bool is_half_spectrum_to_real(const ITensorInfo *input, const ITensorInfo *output)
+{
+    return (input->num_channels() == 2) && (output->num_channels() == 1) && (output->total_size() != 0) && (input->dimension(0) != output->dimension(0));
+}
+} // namespace
+
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _digit_reverse_kernel(), _fft_kernels(), _scale_kernel(), _digit_reversed_input(), _digit_reverse_indices(), _num_ffts(0), _axis(0), _run_scale(false)
+    : _memory_group(std::move(memory_manager)), _digit_reverse_kernel(), _fft_kernels(), _scale_kernel(), _real_split_kernel(), _digit_reversed_input(), _digit_reverse_indices(), _real_merged_input(),
+      _num_ffts(0), _axis(0), _run_scale(false), _run_real_split(false), _run_real_merge(false)
 {
 }
 
@@ -40,10 +54,14 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT1D::validate(input->info(), output->info(), config));
 
+    // Half spectrum transforms of real sequences run a complex FFT of half their length
+    _run_real_split = is_real_to_half_spectrum(input->info(), output->info());
+    _run_real_merge = is_half_spectrum_to_real(input->info(), output->info());
+
     // Decompose size to radix factors
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->info()->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
+    const unsigned int N                 = _run_real_split ? input->info()->dimension(0) / 2 : (_run_real_merge ? output->info()->dimension(0) / 2 : input->info()->tensor_shape()[config.axis]);
+    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages_with_prime_factors(N, supported_radix);
     ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
 
     // Flags
@@ -51,14 +69,30 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
 
     const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
 
+    // Merge the half spectrum into the spectrum of the real sequence packed as a complex one
+    const ITensor *digit_reverse_input = input;
+    if(_run_real_merge)
+    {
+        FFTRealSplitKernelInfo merge_config;
+        merge_config.inverse = true;
+        _memory_group.manage(&_real_merged_input);
+        _real_split_kernel.configure(input, &_real_merged_input, merge_config);
+        digit_reverse_input = &_real_merged_input;
+    }
+
     // Configure digit reverse
     FFTDigitReverseKernelInfo digit_reverse_config;
-    digit_reverse_config.axis      = config.axis;
-    digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    digit_reverse_config.axis           = config.axis;
+    digit_reverse_config.conjugate      = config.direction == FFTDirection::Inverse;
+    digit_reverse_config.is_packed_real = _run_real_split;
+    TensorInfo digit_reverse_indices_info(TensorShape(N), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
     _memory_group.manage(&_digit_reversed_input);
-    _digit_reverse_kernel.configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    _digit_reverse_kernel.configure(digit_reverse_input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    if(_run_real_merge)
+    {
+        _real_merged_input.allocator()->allocate();
+    }
 
     // Create and configure FFT kernels
     unsigned int Nx = 1;
@@ -75,17 +109,24 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.radix          = radix_for_stage;
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
-        _fft_kernels[i].configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr, fft_kernel_info);
+        _fft_kernels[i].configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r && !_run_real_split) ? output : nullptr, fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
 
+    // Split the spectrum of the packed real sequence into its half spectrum
+    if(_run_real_split)
+    {
+        _real_split_kernel.configure(&_digit_reversed_input, output, FFTRealSplitKernelInfo());
+    }
+
     // Configure scale kernel
     if(_run_scale)
     {
         FFTScaleKernelInfo scale_config;
-        scale_config.scale     = static_cast<float>(N);
-        scale_config.conjugate = config.direction == FFTDirection::Inverse;
+        scale_config.scale          = static_cast<float>(N);
+        scale_config.conjugate      = config.direction == FFTDirection::Inverse;
+        scale_config.is_packed_real = _run_real_merge;
         is_c2r ? _scale_kernel.configure(&_digit_reversed_input, output, scale_config) : _scale_kernel.configure(output, nullptr, scale_config);
     }
 
@@ -105,15 +146,33 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({ 0, 1 }).count(config.axis) == 0);
 
+    const bool is_real_split = is_real_to_half_spectrum(input, output);
+    const bool is_real_merge = is_half_spectrum_to_real(input, output);
+
     // Check if FFT is decomposable
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
+    const unsigned int N                 = is_real_split ? input->dimension(0) / 2 : (is_real_merge ? output->dimension(0) / 2 : input->tensor_shape()[config.axis]);
+    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages_with_prime_factors(N, supported_radix);
     ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
 
-    // Checks performed when output is configured
-    if((output != nullptr) && (output->total_size() != 0))
+    if(is_real_split || is_real_merge)
+    {
+        // Half spectrum [N/2 + 1] of a real sequence of even length N along the X axis
+        const ITensorInfo *real     = is_real_split ? input : output;
+        const ITensorInfo *spectrum = is_real_split ? output : input;
+
+        TensorShape spectrum_shape = real->tensor_shape();
+        spectrum_shape.set(0, real->dimension(0) / 2 + 1);
+
+        ARM_COMPUTE_RETURN_ERROR_ON(config.axis != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(is_real_split != (config.direction == FFTDirection::Forward));
+        ARM_COMPUTE_RETURN_ERROR_ON((real->dimension(0) % 2) != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(spectrum->tensor_shape(), spectrum_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+    else if((output != nullptr) && (output->total_size() != 0))
     {
+        // Checks performed when output is configured
         // All combinations are supported except real input with real output (i.e., both input channels set to 1)
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() == 1 && input->num_channels() == 1);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() > 2);
@@ -128,6 +187,11 @@ void NEFFT1D::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_run_real_merge)
+    {
+        NEScheduler::get().schedule(&_real_split_kernel, Window::DimY);
+    }
+
     NEScheduler::get().schedule(&_digit_reverse_kernel, (_axis == 0 ? Window::DimY : Window::DimZ));
 
     for(unsigned int i = 0; i < _num_ffts; ++i)
@@ -135,6 +199,11 @@ void NEFFT1D::run()
         NEScheduler::get().schedule(&_fft_kernels[i], (_axis == 0 ? Window::DimY : Window::DimX));
     }
 
+    if(_run_real_split)
+    {
+        NEScheduler::get().schedule(&_real_split_kernel, Window::DimY);
+    }
+
     // Run output scaling
     if(_run_scale)
     {
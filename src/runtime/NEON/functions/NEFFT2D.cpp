@@ -29,6 +29,18 @@
 
 namespace arm_compute
 {
+namespace
+{
+const ITensorInfo *half_spectrum_info(const ITensorInfo *input, const ITensorInfo *output)
+{
+    if((output->total_size() == 0) || (input->num_channels() == output->num_channels()) || (input->dimension(0) == output->dimension(0)))
+    {
+        return nullptr;
+    }
+    return (input->num_channels() == 2) ? input : output;
+}
+} // namespace
+
 NEFFT2D::NEFFT2D(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _first_pass_func(memory_manager), _second_pass_func(memory_manager), _first_pass_tensor()
 {
@@ -39,16 +51,25 @@ void NEFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT2D::validate(input->info(), output->info(), config));
 
+    // Half spectrum transforms of real tensors have the X axis transformed first from the real tensor and last to the real tensor
+    const ITensorInfo *spectrum         = half_spectrum_info(input->info(), output->info());
+    const bool         is_half_spectrum = spectrum != nullptr;
+    const bool         swap_axes        = is_half_spectrum && (spectrum == input->info());
+    if(is_half_spectrum)
+    {
+        _first_pass_tensor.allocator()->init(spectrum->clone()->set_is_resizable(true).reset_padding());
+    }
+
     // Setup first pass
     FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axes.first;
+    first_pass_config.axis      = swap_axes ? config.axes.second : config.axes.first;
     first_pass_config.direction = config.direction;
     _memory_group.manage(&_first_pass_tensor);
     _first_pass_func.configure(input, &_first_pass_tensor, first_pass_config);
 
     // Setup second pass
     FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axes.second;
+    second_pass_config.axis      = swap_axes ? config.axes.first : config.axes.second;
     second_pass_config.direction = config.direction;
     _second_pass_func.configure(&_first_pass_tensor, output, second_pass_config);
     _first_pass_tensor.allocator()->allocate();
@@ -58,23 +79,29 @@ Status NEFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, co
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
 
+    // Half spectrum transforms are only supported on the X and Y axes
+    const ITensorInfo *spectrum         = half_spectrum_info(input, output);
+    const bool         is_half_spectrum = spectrum != nullptr;
+    const bool         swap_axes        = is_half_spectrum && (spectrum == input);
+    ARM_COMPUTE_RETURN_ERROR_ON(is_half_spectrum && (config.axes.first != 0 || config.axes.second != 1));
+
     // Create intermediate tensor info
-    TensorInfo first_pass_tensor(input->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+    TensorInfo first_pass_tensor(is_half_spectrum ? spectrum->clone()->set_is_resizable(true).reset_padding() : input->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
 
     // Validate first pass
     FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axes.first;
+    first_pass_config.axis      = swap_axes ? config.axes.second : config.axes.first;
     first_pass_config.direction = config.direction;
     ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, first_pass_config));
 
     // Validate second pass
     FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axes.second;
+    second_pass_config.axis      = swap_axes ? config.axes.first : config.axes.second;
     second_pass_config.direction = config.direction;
     ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&first_pass_tensor, output, second_pass_config));
 
     // Checks performed when output is configured
-    if((output != nullptr) && (output->total_size() != 0))
+    if((output != nullptr) && (output->total_size() != 0) && !is_half_spectrum)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
@@ -33,16 +33,18 @@ namespace arm_compute
 {
 namespace
 {
-int pad_decomposable(int N)
+int pad_decomposable(int N, bool is_half_spectrum)
 {
     const auto supported_radix = NEFFTRadixStageKernel::supported_radix();
 
+    // Half spectrum transforms run a complex FFT of half the (even) length
     int  pad           = 0;
     bool is_decomposed = false;
     while(!is_decomposed)
     {
-        const auto decomposed_vector = arm_compute::helpers::fft::decompose_stages(N++, supported_radix);
-        is_decomposed                = !decomposed_vector.empty();
+        const int length = N + pad;
+        is_decomposed    = (!is_half_spectrum || (length % 2) == 0)
+                           && !arm_compute::helpers::fft::decompose_stages(is_half_spectrum ? length / 2 : length, supported_radix).empty();
         if(!is_decomposed)
         {
             ++pad;
@@ -52,17 +54,91 @@ int pad_decomposable(int N)
 }
 } // namespace
 
-NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+void NEFFTConvolutionLayerWeightsTransform::configure(const ITensor *weights, const Size2D &fft_size)
+{
+    ARM_COMPUTE_ERROR_ON((fft_size.x() % 2) != 0);
+
+    _weights       = weights;
+    _fft_size      = fft_size;
+    _needs_permute = weights->info()->data_layout() == DataLayout::NHWC;
+
+    // Permute weights from HWI -> IHW if needed
+    const ITensor *weights_to_use = weights;
+    if(_needs_permute)
+    {
+        _permute_func.configure(weights, &_permuted, PermutationVector(1U, 2U, 0U));
+        _permuted.info()->set_data_layout(DataLayout::NCHW);
+        weights_to_use = &_permuted;
+    }
+
+    // Flip weights
+    _flipped.allocator()->init(weights_to_use->info()->clone()->set_is_resizable(true).reset_padding());
+    _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
+    _flip_func.configure(weights_to_use, &_flipped, &_flip_axis);
+
+    // Pad weights
+    const Size2D      kernel_size(weights_to_use->info()->dimension(0), weights_to_use->info()->dimension(1));
+    const PaddingList padding_w = { { 0, fft_size.x() - kernel_size.x() }, { 0, fft_size.y() - kernel_size.y() } };
+    _pad_func.configure(&_flipped, &_padded, padding_w);
+
+    // Transform weights to their half spectrum
+    TensorShape spectrum_shape = _padded.info()->tensor_shape();
+    spectrum_shape.set(0, fft_size.x() / 2 + 1);
+    _output.allocator()->init(_padded.info()->clone()->set_is_resizable(true).reset_padding().set_num_channels(2).set_tensor_shape(spectrum_shape));
+    _transform_func = support::cpp14::make_unique<NEFFT2D>();
+    _transform_func->configure(&_padded, &_output, FFT2DInfo());
+
+    // Setup flip axis data
+    _flip_axis.allocator()->allocate();
+
+    auto axis_data = reinterpret_cast<uint32_t *>(_flip_axis.buffer());
+    axis_data[0]   = 0;
+    axis_data[1]   = 1;
+}
+
+void NEFFTConvolutionLayerWeightsTransform::run()
+{
+    ARM_COMPUTE_ERROR_ON(_transform_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(!_weights->is_used());
+
+    // Permute weights
+    if(_needs_permute)
+    {
+        _permuted.allocator()->allocate();
+        _permute_func.run();
+    }
+
+    // Flip weights
+    _flipped.allocator()->allocate();
+    _flip_func.run();
+    if(_needs_permute)
+    {
+        _permuted.allocator()->free();
+    }
+
+    // Pad weights
+    _padded.allocator()->allocate();
+    _pad_func.run();
+    _flipped.allocator()->free();
+
+    // Transform weights to frequency domain
+    _output.allocator()->allocate();
+    _transform_func->run();
+    _transform_func.reset();
+    _padded.allocator()->free();
+
+    _reshape_run = true;
+}
+
+NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
     : _memory_group(memory_manager),
-      _flip_weights_func(),
+      _weights_manager(weights_manager),
+      _weights_transform(),
       _permute_input_func(),
       _permute_output_func(),
-      _permute_weights_func(),
       _permute_bias_func(),
       _pad_input_func(),
-      _pad_weights_func(),
       _transform_input_func(memory_manager),
-      _transform_weights_func(),
       _itransform_output_func(memory_manager),
       _prod_func(),
       _reduce_func(),
@@ -70,15 +146,10 @@ NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> mem
       _bias_add_func(),
       _activation_layer_func(),
       _permuted_input(),
-      _permuted_weights(),
       _permuted_bias(),
       _permuted_output(),
       _padded_input(),
-      _padded_weights(),
-      _flip_axis(),
-      _flipped_weights(),
       _transformed_input(),
-      _transformed_weights(),
       _input_weights_product(),
       _output_product(),
       _output_reduced(),
@@ -87,9 +158,11 @@ NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> mem
       _bias_output(),
       _original_weights(nullptr),
       _original_bias(nullptr),
+      _transformed_weights(nullptr),
       _is_activationlayer_enabled(false),
       _needs_permute(false),
       _has_bias(false),
+      _is_weights_managed(false),
       _is_prepared(false)
 {
 }
@@ -110,12 +183,13 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size = Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid   = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
-                                      pad_decomposable(input_dims.y() + kernel_size.y() - 1));
+    const Size2D pad_valid   = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1, true),
+                                      pad_decomposable(input_dims.y() + kernel_size.y() - 1, false));
+    const Size2D fft_size    = Size2D(input_dims.x() + kernel_size.x() - 1 + pad_valid.x(), input_dims.y() + kernel_size.y() - 1 + pad_valid.y());
+
     // Tensors to use
-    ITensor       *input_to_use   = input;
-    const ITensor *weights_to_use = weights;
-    ITensor       *output_to_use  = _has_bias ? &_bias_output : output;
+    ITensor *input_to_use  = input;
+    ITensor *output_to_use = _has_bias ? &_bias_output : output;
 
     // Permute bias
     if(biases != nullptr)
@@ -133,26 +207,21 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
         _permute_input_func.configure(input, &_permuted_input, PermutationVector(1U, 2U, 0U));
         _permuted_input.info()->set_data_layout(DataLayout::NCHW);
 
-        // Configure the function to transform the weights tensor from HWI -> IHW
-        _permute_weights_func.configure(weights, &_permuted_weights, PermutationVector(1U, 2U, 0U));
-        _permuted_weights.info()->set_data_layout(DataLayout::NCHW);
-
-        input_to_use   = &_permuted_input;
-        weights_to_use = &_permuted_weights;
+        input_to_use = &_permuted_input;
     }
 
-    // Flip weights
-    _flipped_weights.allocator()->init(weights_to_use->info()->clone()->set_is_resizable(true).reset_padding());
-    _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
-    _flip_weights_func.configure(weights_to_use, &_flipped_weights, &_flip_axis);
-
-    // Pad weights
-    const PaddingList padding_w = { { 0, input_dims.x() + pad_valid.x() - 1 }, { 0, input_dims.y() + pad_valid.y() - 1 } };
-    _pad_weights_func.configure(&_flipped_weights, &_padded_weights, padding_w);
-
-    // Transform weights
-    _transform_weights_func = support::cpp14::make_unique<NEFFT2D>();
-    _transform_weights_func->configure(&_padded_weights, &_transformed_weights, FFT2DInfo());
+    // Transform weights to the frequency domain, once for all the functions sharing them
+    _weights_transform.configure(weights, fft_size);
+    _is_weights_managed = _weights_manager != nullptr;
+    if(_is_weights_managed)
+    {
+        _weights_manager->manage(weights);
+        _transformed_weights = _weights_manager->acquire(weights, &_weights_transform);
+    }
+    else
+    {
+        _transformed_weights = _weights_transform.get_weights();
+    }
 
     // Pad input
     const PaddingList padding_in = { { 0, kernel_size.x() + pad_valid.x() - 1 }, { 0, kernel_size.y() + pad_valid.y() - 1 } };
@@ -163,14 +232,17 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
         _permuted_input.allocator()->allocate();
     }
 
-    // Transform input
+    // Transform input to its half spectrum
+    TensorShape spectrum_shape = _padded_input.info()->tensor_shape();
+    spectrum_shape.set(0, fft_size.x() / 2 + 1);
+    _transformed_input.allocator()->init(_padded_input.info()->clone()->set_is_resizable(true).reset_padding().set_num_channels(2).set_tensor_shape(spectrum_shape));
     _memory_group.manage(&_transformed_input);
     _transform_input_func.configure(&_padded_input, &_transformed_input, FFT2DInfo());
     _padded_input.allocator()->allocate();
 
     // Perform product
     _memory_group.manage(&_output_product);
-    _prod_func.configure(&_transformed_input, &_transformed_weights, &_output_product);
+    _prod_func.configure(&_transformed_input, _transformed_weights, &_output_product);
     _transformed_input.allocator()->allocate();
 
     // Perform reduction
@@ -182,7 +254,9 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     _memory_group.manage(&_itransformed_output);
     FFT2DInfo itranform_info;
     itranform_info.direction = FFTDirection::Inverse;
-    _itransformed_output.allocator()->init(_output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding());
+    TensorShape itransformed_shape = _output_reduced.info()->tensor_shape();
+    itransformed_shape.set(0, fft_size.x());
+    _itransformed_output.allocator()->init(_output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding().set_tensor_shape(itransformed_shape));
     _itransform_output_func.configure(&_output_reduced, &_itransformed_output, itranform_info);
     _output_reduced.allocator()->allocate();
 
@@ -240,13 +314,6 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     {
         _activation_layer_func.configure(output, nullptr, act_info);
     }
-
-    // Setup flip axis data
-    _flip_axis.allocator()->allocate();
-
-    auto axis_data = reinterpret_cast<uint32_t *>(_flip_axis.buffer());
-    axis_data[0]   = 0;
-    axis_data[1]   = 1;
 }
 
 Status NEFFTConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
@@ -346,37 +413,16 @@ void NEFFTConvolutionLayer::prepare()
             _original_bias->mark_as_unused();
         }
 
-        const ITensor *cur_weights = _original_weights;
-
-        // Permute weights
-        if(_needs_permute)
+        // Transform weights to frequency domain
+        if(_is_weights_managed)
         {
-            ARM_COMPUTE_ERROR_ON(!cur_weights->is_used());
-
-            _permuted_weights.allocator()->allocate();
-            _permute_weights_func.run();
-            cur_weights->mark_as_unused();
-            cur_weights = &_permuted_weights;
+            _weights_manager->run(_original_weights, &_weights_transform);
         }
-
-        // Flip weights
-        _flipped_weights.allocator()->allocate();
-        _flip_weights_func.run();
-        cur_weights->mark_as_unused();
-
-        // Pad weights
-        _padded_weights.allocator()->allocate();
-        _pad_weights_func.run();
-        _flipped_weights.mark_as_unused();
-        _flipped_weights.allocator()->free();
-
-        // Transform weights to frequency domain
-        _transformed_weights.allocator()->allocate();
-        _transform_weights_func->run();
-        _transform_weights_func.reset();
-
-        _padded_weights.mark_as_unused();
-        _padded_weights.allocator()->free();
+        else
+        {
+            _weights_transform.run();
+        }
+        _original_weights->mark_as_unused();
 
         _is_prepared = true;
     }
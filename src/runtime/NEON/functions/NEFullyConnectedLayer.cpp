@@ -74,10 +74,11 @@ Status NEFullyConnectedLayerReshapeWeights::validate(const ITensorInfo *input, c
     return NETransposeKernel::validate(input, output);
 }
 
-NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _flatten_kernel(), _convert_weights(), _reshape_weights_function(), _mm_gemm(), _mm_gemmlowp(), _gemmlowp_output_stage(), _accumulate_biases_kernel(),
-      _flatten_output(), _gemmlowp_output(), _converted_weights_output(), _reshape_weights_output(), _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false),
-      _is_fc_after_conv(false), _accumulate_biases(false), _is_quantized(false), _is_prepared(false)
+NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(std::move(memory_manager)), _weights_manager(weights_manager), _flatten_kernel(), _convert_weights(), _reshape_weights_function(), _reshape_weights_managed_function(),
+      _mm_gemm(nullptr, weights_manager), _mm_gemmlowp(), _gemmlowp_output_stage(), _accumulate_biases_kernel(), _flatten_output(), _gemmlowp_output(), _converted_weights_output(),
+      _reshape_weights_output(), _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false), _is_reshape_managed(false), _is_fc_after_conv(false),
+      _accumulate_biases(false), _is_quantized(false), _is_prepared(false)
 {
 }
 
@@ -191,16 +192,34 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         _is_fc_after_conv = input->info()->num_dimensions() > 1;
     }
 
+    // Convert weights if needed
+    const bool convert_weights = _is_fc_after_conv && (input->info()->data_layout() != fc_info.weights_trained_layout);
+
+    // Share the weights with the other functions using them, unless they get converted
+    if(_weights_manager != nullptr && !_is_quantized && !convert_weights)
+    {
+        _weights_manager->manage(weights);
+    }
+
     // Reshape weights if needed
     if(!_are_weights_reshaped)
     {
-        // Reshape the weights
-        _reshape_weights_function.configure(weights, &_reshape_weights_output);
-        weights_to_use = &_reshape_weights_output;
+        _is_reshape_managed = _weights_manager != nullptr && _weights_manager->are_weights_managed(weights);
+        if(_is_reshape_managed)
+        {
+            // Reshape the weights once for all the functions using them
+            _reshape_weights_managed_function.configure(weights);
+            weights_to_use = _weights_manager->acquire(weights, &_reshape_weights_managed_function);
+        }
+        else
+        {
+            // Reshape the weights
+            _reshape_weights_function.configure(weights, &_reshape_weights_output);
+            weights_to_use = &_reshape_weights_output;
+        }
     }
 
-    // Convert weights if needed
-    if(_is_fc_after_conv && (input->info()->data_layout() != fc_info.weights_trained_layout))
+    if(convert_weights)
     {
         // Convert weights
         _convert_weights.configure(weights_to_use,
@@ -330,6 +349,11 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
     return Status{};
 }
 
+size_t NEFullyConnectedLayer::pretransposed_weights_size() const
+{
+    return _mm_gemm.pretransposed_weights_size();
+}
+
 void NEFullyConnectedLayer::run()
 {
     prepare();
@@ -370,7 +394,8 @@ void NEFullyConnectedLayer::prepare()
 {
     if(!_is_prepared)
     {
-        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+        // Managed weights might have already been consumed by another function sharing them
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used() && (_weights_manager == nullptr || !_weights_manager->are_weights_managed(_original_weights)));
 
         auto release_unused = [](Tensor * w)
         {
@@ -387,11 +412,20 @@ void NEFullyConnectedLayer::prepare()
         if(!_are_weights_reshaped)
         {
             // Run reshape weights kernel and mark weights as unused
-            _reshape_weights_output.allocator()->allocate();
-            _reshape_weights_function.run();
+            if(_is_reshape_managed)
+            {
+                const ITensor *reshaped_weights = _weights_manager->run(cur_weights, &_reshape_weights_managed_function);
+                cur_weights->mark_as_unused();
+                cur_weights = reshaped_weights;
+            }
+            else
+            {
+                _reshape_weights_output.allocator()->allocate();
+                _reshape_weights_function.run();
 
-            cur_weights->mark_as_unused();
-            cur_weights           = &_reshape_weights_output;
+                cur_weights->mark_as_unused();
+                cur_weights = &_reshape_weights_output;
+            }
             _are_weights_reshaped = true;
         }
 
@@ -42,9 +42,9 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace arm_compute
 {
-NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(memory_manager), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _asm_glue(memory_manager), _ma_kernel(), _tmp_a(), _tmp_b(), _original_b(nullptr),
-      _run_vector_matrix_multiplication(false), _run_addition(false), _reshape_b_only_on_first_run(false), _is_prepared(false)
+NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _asm_glue(memory_manager, weights_manager), _ma_kernel(), _tmp_a(), _tmp_b(), _original_b(nullptr),
+      _weights_manager(weights_manager), _run_vector_matrix_multiplication(false), _run_addition(false), _reshape_b_only_on_first_run(false), _is_prepared(false)
 {
 }
 
@@ -234,6 +234,16 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
     return Status{};
 }
 
+size_t NEGEMM::pretransposed_weights_size() const
+{
+    if(_asm_glue.is_configured())
+    {
+        return _asm_glue.pretransposed_weights_size();
+    }
+    // The transposed B matrix is only held by the function when reshaped once, otherwise it is managed by the memory group
+    return (_reshape_b_only_on_first_run && _tmp_b.buffer() != nullptr) ? _tmp_b.info()->total_size() : 0;
+}
+
 void NEGEMM::run()
 {
     prepare();
@@ -258,7 +268,15 @@ void NEGEMM::run()
             }
         }
 
-        NEScheduler::get().schedule(&_mm_kernel, _run_vector_matrix_multiplication ? Window::DimX : Window::DimY);
+        if(_run_vector_matrix_multiplication)
+        {
+            NEScheduler::get().schedule(&_mm_kernel, Window::DimX);
+        }
+        else
+        {
+            // Also split along the columns when there are too few blocks of rows to keep all the threads busy
+            NEScheduler::get().schedule(&_mm_kernel, IScheduler::Hints(Window::DimY).set_secondary_split_dimension(Window::DimX));
+        }
 
         // Run matrix addition kernel
         if(_run_addition)
@@ -274,7 +292,8 @@ void NEGEMM::prepare()
     {
         if(_asm_glue.is_configured())
         {
-            ARM_COMPUTE_ERROR_ON(!_original_b->is_used());
+            // Managed weights might have already been consumed by another function sharing them
+            ARM_COMPUTE_ERROR_ON(!_original_b->is_used() && (_weights_manager == nullptr || !_weights_manager->are_weights_managed(_original_b)));
 
             _asm_glue.prepare();
         }
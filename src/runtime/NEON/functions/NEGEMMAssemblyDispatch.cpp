@@ -28,6 +28,8 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NESimpleAssemblyFunction.h"
 #include "arm_compute/runtime/NEON/functions/assembly/NEGEMMInterleavedWrapper.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "support/ToolchainSupport.h"
 
 #include <arm_neon.h>
 
@@ -37,7 +39,7 @@ namespace
 {
 std::unique_ptr<IFunction> create_function_all_types(const arm_gemm::KernelDescription &gemm_kernel_info,
                                                      const ITensor *a, const ITensor *b, ITensor *d, float alpha, float beta, bool pretranspose_hint,
-                                                     std::shared_ptr<IMemoryManager> memory_manager)
+                                                     std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
 
 {
     //Note: It's safe to not check for FP16 support because this was already checked in NEGEMMAssemblyDispatch::configure()
@@ -49,7 +51,7 @@ std::unique_ptr<IFunction> create_function_all_types(const arm_gemm::KernelDescr
             {
                 return nullptr;
             }
-            auto function = support::cpp14::make_unique<NEGEMMInterleavedWrapper>(memory_manager);
+            auto function = support::cpp14::make_unique<NEGEMMInterleavedWrapper>(memory_manager, weights_manager);
             function->configure(a, b, d, alpha, beta, pretranspose_hint);
             return std::move(function);
         }
@@ -72,6 +74,106 @@ std::unique_ptr<IFunction> create_function_all_types(const arm_gemm::KernelDescr
     }
 }
 
+/** Returns the id of the pretransposed B matrix layout
+ *
+ * @note The layout depends on the blocking parameters arm_gemm derives from the CPU model and cache sizes.
+ *
+ * @param[in] kernel_name Name of the assembly Gemm kernel.
+ * @param[in] ci          CPU information used to configure the kernel.
+ *
+ * @return The id of the pretransposed B matrix layout
+ */
+std::string pretranspose_id(const std::string &kernel_name, const CPUInfo &ci)
+{
+    return "NEGEMMAssemblyDispatch_" + kernel_name + "_" + cpu_model_to_string(ci.get_cpu_model()) + "_L1_" + support::cpp11::to_string(ci.get_L1_cache_size()) + "_L2_"
+           + support::cpp11::to_string(ci.get_L2_cache_size());
+}
+
+/** Pretransposes the B matrix, or maps it from the weights cache if available
+ *
+ * @param[in]  gemm_kernel_asm Assembly Gemm kernel performing the pretranspose.
+ * @param[in]  b               Input tensor containing the Matrix B.
+ * @param[out] pretranspose    Pretransposed B matrix, allocated or imported by this function.
+ * @param[in]  transform_id    Id of the pretransposed B matrix layout, see @ref pretranspose_id.
+ * @param[in]  cache           Weights cache to use. Can be nullptr.
+ */
+template <typename TypeInput, typename TypeOutput>
+void run_pretranspose_b(arm_gemm::GemmCommon<TypeInput, TypeOutput> *gemm_kernel_asm, const ITensor *b, Tensor &pretranspose, const std::string &transform_id, WeightsCache *cache)
+{
+    const size_t      size      = pretranspose.info()->total_size();
+    const std::string cache_key = (cache != nullptr) ? WeightsCache::compute_key(transform_id, *b, size) : "";
+    void             *cached    = (cache != nullptr) ? cache->load(cache_key, size) : nullptr;
+    if(cached != nullptr && bool(pretranspose.allocator()->import_memory(cached)))
+    {
+        gemm_kernel_asm->set_pretransposed_B_data(pretranspose.buffer());
+        return;
+    }
+
+    pretranspose.allocator()->allocate();
+    ARM_COMPUTE_ERROR_ON(pretranspose.buffer() == nullptr);
+    const int  ldb            = b->info()->strides_in_bytes().y() / sizeof(TypeInput);
+    const auto in1_ptr        = reinterpret_cast<const TypeInput *>(b->buffer() + b->info()->offset_first_element_in_bytes());
+    const int  multi_stride_b = b->info()->strides_in_bytes().z() / sizeof(TypeInput);
+
+    gemm_kernel_asm->pretranspose_B_array(pretranspose.buffer(), in1_ptr, ldb, multi_stride_b);
+    if(cache != nullptr)
+    {
+        cache->store(cache_key, pretranspose.buffer(), size);
+    }
+}
+
+/** Weights transform running the arm_gemm pretranspose of the B matrix */
+template <typename TypeInput, typename TypeOutput>
+class FallbackTransform : public ITransformWeights
+{
+public:
+    /** Configure the transform
+     *
+     * @param[in] b               Input tensor containing the Matrix B.
+     * @param[in] gemm_kernel_asm Assembly Gemm kernel performing the pretranspose.
+     * @param[in] transform_id    Id of the pretransposed B matrix layout, see @ref pretranspose_id.
+     * @param[in] alignment       Pretransposed buffer alignment.
+     * @param[in] cache           Cache to load the pretransposed B matrix from or store it to. Can be nullptr.
+     */
+    void configure(const ITensor *b, arm_gemm::GemmCommon<TypeInput, TypeOutput> *gemm_kernel_asm, const std::string &transform_id, unsigned int alignment, WeightsCache *cache)
+    {
+        const size_t B_pretranspose_size = gemm_kernel_asm->get_B_pretransposed_array_size();
+        _output.allocator()->init(TensorInfo(TensorShape{ (B_pretranspose_size + alignment /* FIXME: remove alignment after COMPMID-1088 */) }, 1, DataType::S8), alignment);
+        _b               = b;
+        _gemm_kernel_asm = gemm_kernel_asm;
+        _transform_id    = transform_id;
+        _cache           = cache;
+        _uid             = transform_id + "_" + support::cpp11::to_string(B_pretranspose_size);
+    }
+
+    // Inherited methods overridden:
+    void run() override
+    {
+        run_pretranspose_b(_gemm_kernel_asm, _b, _output, _transform_id, _cache);
+        _reshape_run = true;
+    }
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+    std::string uid() override
+    {
+        return _uid;
+    }
+
+private:
+    const ITensor                                *_b{ nullptr };
+    arm_gemm::GemmCommon<TypeInput, TypeOutput> *_gemm_kernel_asm{ nullptr };
+    Tensor                                       _output{};
+    std::string                                  _transform_id{};
+    WeightsCache                                *_cache{ nullptr };
+    std::string                                  _uid{};
+};
+
 /** Fallback in case ACL doesn't have a function */
 template <typename TypeInput, typename TypeOutput>
 class Fallback : public NEGEMMAssemblyDispatch::IFallback
@@ -82,15 +184,17 @@ public:
      * @param[in]  a            Input tensor containing the Matrix A.
      * @param[in]  b            Input tensor containing the Matrix B.
      * @param[out] d            Output tensor to store the result of matrix multiplication.
-     * @param[in]  args         Matrix multiplication information.
-     * @param[in]  memory_group Memory group to be used by the function.
+     * @param[in]  args            Matrix multiplication information.
+     * @param[in]  memory_group    Memory group to be used by the function.
+     * @param[in]  weights_manager (Optional) Weights manager used to share the pretransposed B matrix.
      */
-    void configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group);
+    void configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group, IWeightsManager *weights_manager = nullptr);
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
-    bool is_configured() const override;
+    void   run() override;
+    void   prepare() override;
+    bool   is_configured() const override;
+    size_t pretransposed_weights_size() const override;
 
 private:
     /** Allocate a workspace tensor.
@@ -121,12 +225,20 @@ private:
     Tensor _workspace{};
     /** Pre-transpose tensor */
     Tensor _pretranspose{};
+    /** Id of the pretransposed B matrix layout */
+    std::string _pretranspose_id{};
+    /** Weights manager */
+    IWeightsManager *_weights_manager{ nullptr };
+    /** Cache of the pretransposed B matrix */
+    WeightsCache *_weights_cache{ nullptr };
+    /** Shared pre-transpose of B */
+    FallbackTransform<TypeInput, TypeOutput> _weights_transform{};
     /** Prepared flag */
     bool _is_prepared{ false };
 };
 
 template <typename TypeInput, typename TypeOutput>
-void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group)
+void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor *b, ITensor *d, arm_gemm::GemmArgs<TypeOutput> args, MemoryGroup &memory_group, IWeightsManager *weights_manager)
 {
     arm_gemm::GemmConfig              gemm_cfg;
     const arm_gemm::KernelDescription gemm_kernel_info = arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args);
@@ -168,13 +280,25 @@ void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor
     _a                = a;
     _b                = b;
     _d                = d;
+    _pretranspose_id  = pretranspose_id(gemm_kernel_info.name, *args._ci);
+    _weights_cache    = (weights_manager != nullptr) ? weights_manager->weights_cache() : nullptr;
     // Check for pre-transposed support
     if(_gemm_kernel_asm->B_pretranspose_required())
     {
         // Forcing 128-byte alignment (required by 32-bit kernels)
-        const unsigned int alignment           = 128;
-        const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
-        _pretranspose.allocator()->init(TensorInfo(TensorShape{ (B_pretranspose_size + alignment /* FIXME: remove alignment after COMPMID-1088 */) }, 1, DataType::S8), alignment);
+        const unsigned int alignment = 128;
+        if(weights_manager != nullptr && weights_manager->are_weights_managed(b))
+        {
+            // Share the pretransposed B matrix with the functions using the same weights
+            _weights_manager = weights_manager;
+            _weights_transform.configure(b, _gemm_kernel_asm.get(), _pretranspose_id, alignment, _weights_cache);
+            _weights_manager->acquire(b, &_weights_transform);
+        }
+        else
+        {
+            const size_t B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
+            _pretranspose.allocator()->init(TensorInfo(TensorShape{ (B_pretranspose_size + alignment /* FIXME: remove alignment after COMPMID-1088 */) }, 1, DataType::S8), alignment);
+        }
     }
 }
 
@@ -186,13 +310,16 @@ void Fallback<TypeInput, TypeOutput>::prepare()
         // Pretranspose B if required
         if(_gemm_kernel_asm->B_pretranspose_required())
         {
-            _pretranspose.allocator()->allocate();
-            ARM_COMPUTE_ERROR_ON(_pretranspose.buffer() == nullptr);
-            const int  ldb            = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
-            const auto in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
-
-            _gemm_kernel_asm->pretranspose_B_array(_pretranspose.buffer(), in1_ptr, ldb, multi_stride_b);
+            if(_weights_manager != nullptr)
+            {
+                // The pretranspose is only run by the first function requesting it
+                ITensor *pretranspose = _weights_manager->run(_b, &_weights_transform);
+                _gemm_kernel_asm->set_pretransposed_B_data(pretranspose->buffer());
+            }
+            else
+            {
+                run_pretranspose_b(_gemm_kernel_asm.get(), _b, _pretranspose, _pretranspose_id, _weights_cache);
+            }
             _b->mark_as_unused();
         }
 
@@ -215,6 +342,13 @@ bool Fallback<TypeInput, TypeOutput>::is_configured() const
     return _optimised_kernel != nullptr;
 }
 
+template <typename TypeInput, typename TypeOutput>
+size_t Fallback<TypeInput, TypeOutput>::pretransposed_weights_size() const
+{
+    // The pretransposed B matrix is held by the weights manager when shared
+    return (_weights_manager == nullptr && _pretranspose.buffer() != nullptr) ? _pretranspose.info()->total_size() : 0;
+}
+
 template <typename TypeInput, typename TypeOutput>
 void Fallback<TypeInput, TypeOutput>::run()
 {
@@ -271,7 +405,7 @@ void Fallback<TypeInput, TypeOutput>::run()
 
 template <typename TypeInput, typename TypeOutput>
 void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group, const ITensor *a, const ITensor *b,
-                                 ITensor *d, float alpha, float beta, bool pretranspose_hint, std::shared_ptr<IMemoryManager> memory_manager)
+                                 ITensor *d, float alpha, float beta, bool pretranspose_hint, std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
 {
     INEGEMMWrapperKernel::Params p           = INEGEMMWrapperKernel::extract_parameters(a, b, d);
     const CPUInfo               &ci          = NEScheduler::get().cpu_info();
@@ -280,22 +414,22 @@ void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::
     arm_gemm::GemmArgs<TypeOutput> args(&ci, p.M, p.N, p.K, p.batches, p.multis, false, false, alpha, beta, num_threads, pretranspose_hint);
 
     //Try to create an ACL function:
-    acl_function = create_function_all_types(arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args), a, b, d, alpha, beta, pretranspose_hint, std::move(memory_manager));
+    acl_function = create_function_all_types(arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args), a, b, d, alpha, beta, pretranspose_hint, std::move(memory_manager), weights_manager);
 
     //If we still don't have an ACL function:
     if(acl_function == nullptr)
     {
         //Fallback onto arm_gemm function if ACL doesn't support this method.
         auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
-        fallback->configure(a, b, d, args, memory_group);
+        fallback->configure(a, b, d, args, memory_group, weights_manager);
         arm_gemm = std::move(fallback);
     }
 }
 
 } //namespace
 
-NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager)
-    : _function(nullptr), _arm_gemm(nullptr), _memory_group(memory_manager), _memory_manager(memory_manager)
+NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _function(nullptr), _arm_gemm(nullptr), _memory_group(memory_manager), _memory_manager(memory_manager), _weights_manager(weights_manager)
 {
 }
 
@@ -334,20 +468,20 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, ITens
     switch(a->info()->data_type())
     {
         case DataType::F32:
-            create_function_or_arm_gemm<float, float>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            create_function_or_arm_gemm<float, float>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager, _weights_manager);
             break;
 #ifdef __aarch64__
         case DataType::U8:
         case DataType::QASYMM8:
-            create_function_or_arm_gemm<uint8_t, uint32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            create_function_or_arm_gemm<uint8_t, uint32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager, _weights_manager);
             break;
         case DataType::S8:
-            create_function_or_arm_gemm<int8_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            create_function_or_arm_gemm<int8_t, int32_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager, _weights_manager);
             break;
 #endif /* __aarch64__ */
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
-            create_function_or_arm_gemm<float16_t, float16_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager);
+            create_function_or_arm_gemm<float16_t, float16_t>(_function, _arm_gemm, _memory_group, a, b, d, alpha, beta, pretranspose_hint, _memory_manager, _weights_manager);
             break;
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         default:
@@ -373,6 +507,16 @@ bool NEGEMMAssemblyDispatch::is_configured() const
     return (_arm_gemm != nullptr && _arm_gemm->is_configured()) || _function != nullptr;
 }
 
+size_t NEGEMMAssemblyDispatch::pretransposed_weights_size() const
+{
+    if(_function != nullptr)
+    {
+        const auto *interleaved = dynamic_cast<const NEGEMMInterleavedWrapper *>(_function.get());
+        return (interleaved != nullptr) ? interleaved->pretransposed_weights_size() : 0;
+    }
+    return (_arm_gemm != nullptr) ? _arm_gemm->pretransposed_weights_size() : 0;
+}
+
 void NEGEMMAssemblyDispatch::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
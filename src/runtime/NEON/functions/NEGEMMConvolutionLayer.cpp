@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include <cmath>
@@ -38,6 +39,47 @@
 using namespace arm_compute;
 using namespace arm_compute::misc::shape_calculator;
 
+namespace
+{
+/** Runs the weights reshape, or maps its result from the weights cache if available
+ *
+ * @param[in]  func    Configured weights reshape function.
+ * @param[in]  weights Weights reshaped by @p func.
+ * @param[in]  biases  Biases appended by @p func. Can be nullptr.
+ * @param[out] output  Reshaped weights, allocated or imported by this function.
+ * @param[in]  cache   Weights cache to use. Can be nullptr.
+ */
+void run_reshape_weights(NEConvolutionLayerReshapeWeights &func, const ITensor *weights, const ITensor *biases, Tensor &output, WeightsCache *cache)
+{
+    const size_t size   = output.info()->total_size();
+    void        *cached = nullptr;
+    std::string  cache_key;
+    if(cache != nullptr)
+    {
+        cache_key = WeightsCache::compute_key("NEConvolutionLayerReshapeWeights", *weights, size);
+        if(biases != nullptr)
+        {
+            cache_key = WeightsCache::compute_key(cache_key, *biases, size);
+        }
+        cached = cache->load(cache_key, size);
+    }
+
+    if(cached != nullptr)
+    {
+        output.allocator()->import_memory(cached);
+    }
+    else
+    {
+        output.allocator()->allocate();
+        func.run();
+        if(cache != nullptr)
+        {
+            cache->store(cache_key, output.buffer(), size);
+        }
+    }
+}
+} // namespace
+
 NEConvolutionLayerReshapeWeights::NEConvolutionLayerReshapeWeights()
     : _weights_reshape_kernel()
 {
@@ -89,10 +131,24 @@ void NEConvolutionLayerReshapeWeights::run()
     NEScheduler::get().schedule(&_weights_reshape_kernel, 3);
 }
 
-NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _reshape_weights(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager), _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(),
-      _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false),
-      _skip_col2im(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
+void NEConvolutionLayerReshapeWeightsTransform::run()
+{
+    run_reshape_weights(_func, _input, _biases, _output, _cache);
+    _reshape_run = true;
+}
+
+std::string NEConvolutionLayerReshapeWeightsTransform::content_key(const ITensor &weights)
+{
+    // The appended biases are part of the reshaped weights
+    const std::string key = ITransformWeights::content_key(weights);
+    return (_biases != nullptr) ? WeightsCache::compute_key(key, *_biases, _output.info()->total_size()) : key;
+}
+
+NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager, weights_manager),
+      _mm_gemmlowp(memory_manager), _col2im_kernel(), _activationlayer_function(), _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _appended_biases(nullptr), _im2col_output(),
+      _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _append_bias(false), _skip_im2col(false), _skip_col2im(false), _is_quantized(false),
+      _is_activationlayer_enabled(false), _is_reshape_managed(false), _is_prepared(false)
 {
 }
 
@@ -309,7 +365,20 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
     // _weights_reshaped will be auto configured in the kernel.
     // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
-    _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped);
+    const ITensor *weights_to_use = &_weights_reshaped;
+    _appended_biases              = biases_to_use;
+    _is_reshape_managed           = _weights_manager != nullptr && !_is_quantized && !_is_prepared;
+    if(_is_reshape_managed)
+    {
+        // Reshape the weights once for all the functions using them
+        _weights_manager->manage(weights);
+        _reshape_weights_managed.configure(weights, biases_to_use, _weights_manager->weights_cache());
+        weights_to_use = _weights_manager->acquire(weights, &_reshape_weights_managed);
+    }
+    else
+    {
+        _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped);
+    }
 
     // Create tensor to store im2col reshaped inputs
     if(!_skip_im2col)
@@ -351,7 +420,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Configure GEMM
     // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
     const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
-    configure_mm(gemm_input_to_use, &_weights_reshaped, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth);
 
     if(!_skip_im2col)
     {
@@ -547,6 +616,11 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     return Status{};
 }
 
+size_t NEGEMMConvolutionLayer::pretransposed_weights_size() const
+{
+    return _mm_gemm.pretransposed_weights_size();
+}
+
 void NEGEMMConvolutionLayer::run()
 {
     prepare();
@@ -600,11 +674,18 @@ void NEGEMMConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+        // Managed weights might have already been consumed by another function sharing them
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used() && !_is_reshape_managed);
 
         // Run weights reshaping and mark original weights tensor as unused
-        _weights_reshaped.allocator()->allocate();
-        _reshape_weights.run();
+        if(_is_reshape_managed)
+        {
+            _weights_manager->run(_original_weights, &_reshape_weights_managed);
+        }
+        else
+        {
+            run_reshape_weights(_reshape_weights, _original_weights, _appended_biases, _weights_reshaped, (_weights_manager != nullptr) ? _weights_manager->weights_cache() : nullptr);
+        }
         _original_weights->mark_as_unused();
 
         // Prepare GEMM
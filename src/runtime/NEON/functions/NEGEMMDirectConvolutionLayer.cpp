@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMDirectConvolutionLayer.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
+#include "arm_compute/core/NEON/kernels/assembly/arm_gemm.hpp"
+#include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t storage_alignment = 64;
+
+/** Compute the range of output positions, along one dimension, whose kernel taps [tap, tap + num_taps) all read the input
+ *
+ * @param[in] input_size  Size of the input along the dimension.
+ * @param[in] output_size Size of the output along the dimension.
+ * @param[in] stride      Convolution stride along the dimension.
+ * @param[in] pad         Padding before the first input value along the dimension.
+ * @param[in] tap         First kernel tap.
+ * @param[in] num_taps    Number of consecutive kernel taps.
+ *
+ * @return The range [start, end) of output positions. The range is empty when end == start.
+ */
+std::pair<int, int> valid_output_range(int input_size, int output_size, int stride, int pad, int tap, int num_taps)
+{
+    // The output position o reads the input positions [o * stride - pad + tap, o * stride - pad + tap + num_taps)
+    const int first = std::max(pad - tap, 0);
+    const int last  = input_size - num_taps + pad - tap;
+    const int start = std::min(static_cast<int>(DIV_CEIL(first, stride)), output_size);
+    const int end   = (last < 0) ? 0 : std::min(last / stride + 1, output_size);
+    return std::make_pair(start, std::max(start, end));
+}
+
+template <typename T>
+std::unique_ptr<arm_gemm::IGemmCommon> create_row_gemm(unsigned int m, unsigned int n, unsigned int k, unsigned int rows, std::unique_ptr<INEKernel> &kernel, std::string &kernel_name)
+{
+    const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    // The weights are read as a transposed right-hand side matrix: each OFM has its kernel taps contiguous.
+    // The hybrid kernels are preferred as they read the rows of the left-hand side matrix in place, without interleaving them
+    const arm_gemm::GemmConfig hybrid_config(arm_gemm::GemmMethod::GEMM_HYBRID);
+    arm_gemm::GemmArgs<T>      args(&ci, m, n, k, rows, 1, false, true, static_cast<T>(1), static_cast<T>(1), num_threads, true);
+    if(arm_gemm::method_is_compatible<T, T>(arm_gemm::GemmMethod::GEMM_HYBRID, args))
+    {
+        args._cfg = &hybrid_config;
+    }
+
+    arm_gemm::UniqueGemmCommon<T, T> gemm = arm_gemm::gemm<T, T>(args);
+    ARM_COMPUTE_ERROR_ON_MSG(gemm == nullptr, "No arm_gemm implementation found");
+
+    kernel_name  = arm_gemm::get_gemm_method<T, T>(args).name;
+    auto wrapper = support::cpp14::make_unique<NEGEMMAssemblyWrapperKernel<T, T>>();
+    wrapper->configure(gemm.get(), kernel_name);
+    kernel = std::move(wrapper);
+    return std::unique_ptr<arm_gemm::IGemmCommon>(std::move(gemm));
+}
+
+std::unique_ptr<arm_gemm::IGemmCommon> create_row_gemm(DataType data_type, unsigned int m, unsigned int n, unsigned int k, unsigned int rows, std::unique_ptr<INEKernel> &kernel,
+                                                       std::string &kernel_name)
+{
+    switch(data_type)
+    {
+        case DataType::F32:
+            return create_row_gemm<float>(m, n, k, rows, kernel, kernel_name);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            return create_row_gemm<float16_t>(m, n, k, rows, kernel, kernel_name);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            return nullptr;
+    }
+}
+} // namespace
+
+NEGEMMDirectConvolutionLayer::NEGEMMDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _memset_kernel(), _output_stage_kernel(), _activationlayer_function(), _row_gemms(), _workspace(), _pretransposed_weights(), _input(nullptr),
+      _weights(nullptr), _output(nullptr), _conv_info(), _has_bias(false), _is_activationlayer_enabled(false), _is_prepared(false)
+{
+}
+
+void NEGEMMDirectConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto initialization if not yet initialized
+    const TensorShape output_shape = misc::shape_calculator::compute_deep_convolution_shape(*input->info(), *weights->info(), conv_info);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMDirectConvolutionLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, act_info));
+
+    _input       = input;
+    _weights     = weights;
+    _output      = output;
+    _conv_info   = conv_info;
+    _has_bias    = (biases != nullptr);
+    _is_prepared = false;
+
+    const DataType     data_type     = input->info()->data_type();
+    const unsigned int ifm           = input->info()->dimension(0);
+    const int          input_width   = input->info()->dimension(1);
+    const int          input_height  = input->info()->dimension(2);
+    const int          kernel_width  = weights->info()->dimension(1);
+    const int          kernel_height = weights->info()->dimension(2);
+    const unsigned int ofm           = weights->info()->dimension(3);
+    const int          output_width  = output->info()->dimension(1);
+    const int          output_height = output->info()->dimension(2);
+    const int          stride_x      = conv_info.stride().first;
+    const int          stride_y      = conv_info.stride().second;
+    const int          pad_left      = conv_info.pad_left();
+    const int          pad_top       = conv_info.pad_top();
+
+    // Build the table of GEMMs: each of them computes the contribution of num_taps consecutive kernel columns of a kernel row
+    // to the rectangle [cols.first, cols.second) x [rows.first, rows.second) of the output
+    size_t workspace_size     = 0;
+    size_t pretransposed_size = 0;
+    _row_gemms.clear();
+
+    // GEMMs reading the same weights with the same kernel share their pretransposed weights: they only differ by the output columns they compute
+    using PretransposedKey = std::tuple<int, int, int, std::string, size_t>;
+    std::map<PretransposedKey, size_t> pretransposed_offsets;
+
+    const auto add_row_gemm = [&](const std::pair<int, int> &cols, const std::pair<int, int> &rows, int kx, int ky, int num_taps)
+    {
+        if(cols.first >= cols.second || rows.first >= rows.second)
+        {
+            return;
+        }
+
+        RowGemm     row_gemm;
+        std::string kernel_name;
+        row_gemm.gemm          = create_row_gemm(data_type, cols.second - cols.first, ofm, num_taps * ifm, rows.second - rows.first, row_gemm.kernel, kernel_name);
+        row_gemm.input_start   = Coordinates(0, cols.first * stride_x - pad_left + kx, rows.first * stride_y - pad_top + ky);
+        row_gemm.output_start  = Coordinates(0, cols.first, rows.first);
+        row_gemm.weights_start = Coordinates(0, kx, ky);
+
+        if(row_gemm.gemm->B_pretranspose_required())
+        {
+            const size_t array_size = row_gemm.gemm->get_B_pretransposed_array_size();
+            const auto   inserted   = pretransposed_offsets.emplace(std::make_tuple(kx, ky, num_taps, kernel_name, array_size), pretransposed_size);
+
+            row_gemm.pretransposed_offset = inserted.first->second;
+            row_gemm.pretransposes_b      = inserted.second;
+            if(inserted.second)
+            {
+                pretransposed_size += ceil_to_multiple(array_size, storage_alignment);
+            }
+        }
+        workspace_size = std::max(workspace_size, row_gemm.gemm->get_working_size());
+
+        _row_gemms.emplace_back(std::move(row_gemm));
+    };
+
+    for(int ky = 0; ky < kernel_height; ++ky)
+    {
+        const std::pair<int, int> rows = valid_output_range(input_height, output_height, stride_y, pad_top, ky, 1);
+
+        // Output columns reading a whole kernel row: the kernel_width * IFM input values are contiguous
+        const std::pair<int, int> inner_cols = valid_output_range(input_width, output_width, stride_x, pad_left, 0, kernel_width);
+        add_row_gemm(inner_cols, rows, 0, ky, kernel_width);
+
+        // Output columns crossing the left or right padding: one GEMM per kernel column on its valid output columns
+        for(int kx = 0; kx < kernel_width; ++kx)
+        {
+            const std::pair<int, int> cols = valid_output_range(input_width, output_width, stride_x, pad_left, kx, 1);
+            add_row_gemm(std::make_pair(cols.first, std::min(cols.second, inner_cols.first)), rows, kx, ky, 1);
+            add_row_gemm(std::make_pair(std::max(cols.first, inner_cols.second), cols.second), rows, kx, ky, 1);
+        }
+    }
+
+    if(pretransposed_size != 0)
+    {
+        _pretransposed_weights.allocator()->init(TensorInfo(TensorShape(pretransposed_size), 1, DataType::U8), storage_alignment);
+    }
+
+    // The GEMMs run one after the other, hence they share the same workspace
+    if(workspace_size != 0)
+    {
+        _memory_group.manage(&_workspace);
+        _workspace.allocator()->init(TensorInfo(TensorShape(workspace_size), 1, DataType::U8), storage_alignment);
+        _workspace.allocator()->allocate();
+    }
+
+    // The GEMMs accumulate into the output, which is cleared first
+    _memset_kernel.configure(output, PixelValue());
+
+    if(_has_bias)
+    {
+        _output_stage_kernel.configure(output, biases);
+    }
+
+    _is_activationlayer_enabled = act_info.enabled();
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.configure(output, nullptr, act_info);
+    }
+}
+
+Status NEGEMMDirectConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                              const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NHWC, "Only NHWC is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->padding().left != 0 || input->padding().right != 0, "The IFM dimension of the input must not be padded");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->padding().left != 0 || weights->padding().right != 0, "The IFM dimension of the weights must not be padded");
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = misc::shape_calculator::compute_deep_convolution_shape(*input, *weights, conv_info);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    if(act_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void NEGEMMDirectConvolutionLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    ARM_COMPUTE_ERROR_ON_MSG(_input->info()->padding().left != 0 || _input->info()->padding().right != 0, "The IFM dimension of the input must not be padded");
+
+    const size_t       element_size   = _input->info()->element_size();
+    const Strides     &input_strides  = _input->info()->strides_in_bytes();
+    const Strides     &output_strides = _output->info()->strides_in_bytes();
+    const int          lda            = _conv_info.stride().first * input_strides[1] / element_size;
+    const int          batch_stride_a = _conv_info.stride().second * input_strides[2] / element_size;
+    const int          ldb            = _weights->info()->strides_in_bytes()[3] / element_size;
+    const int          ldc            = output_strides[1] / element_size;
+    const int          batch_stride_c = output_strides[2] / element_size;
+    const int          num_batches    = _input->info()->dimension(3);
+    const unsigned int num_threads    = NEScheduler::get().num_threads();
+
+    NEScheduler::get().schedule(&_memset_kernel, Window::DimY);
+
+    for(auto &row_gemm : _row_gemms)
+    {
+        arm_gemm::IGemmCommon *gemm = row_gemm.gemm.get();
+
+        // Set workspace if needed and reset number of threads as buffer manager gets re-created with max_threads
+        if(_workspace.buffer() != nullptr)
+        {
+            gemm->set_working_space(reinterpret_cast<void *>(_workspace.buffer()));
+            const unsigned int window_size = gemm->get_window_size();
+            if(window_size < num_threads)
+            {
+                gemm->set_nthreads(window_size);
+            }
+        }
+
+        const void *weights_ptr = gemm->B_is_pretransposed() ? nullptr : _weights->ptr_to_element(row_gemm.weights_start);
+
+        for(int batch = 0; batch < num_batches; ++batch)
+        {
+            Coordinates input_start  = row_gemm.input_start;
+            Coordinates output_start = row_gemm.output_start;
+            input_start.set(3, batch);
+            output_start.set(3, batch);
+
+            gemm->set_arrays_generic(_input->ptr_to_element(input_start), lda, batch_stride_a, 0, weights_ptr, ldb, 0, _output->ptr_to_element(output_start), ldc, batch_stride_c, 0);
+            NEScheduler::get().schedule(row_gemm.kernel.get(), Window::DimX);
+        }
+    }
+
+    if(_has_bias)
+    {
+        NEScheduler::get().schedule(&_output_stage_kernel, Window::DimY);
+    }
+
+    if(_is_activationlayer_enabled)
+    {
+        _activationlayer_function.run();
+    }
+}
+
+void NEGEMMDirectConvolutionLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        ARM_COMPUTE_ERROR_ON(!_weights->is_used());
+
+        if(_pretransposed_weights.info()->total_size() != 0)
+        {
+            _pretransposed_weights.allocator()->allocate();
+        }
+
+        const int ldb            = _weights->info()->strides_in_bytes()[3] / _weights->info()->element_size();
+        bool      weights_in_use = false;
+        for(auto &row_gemm : _row_gemms)
+        {
+            if(row_gemm.gemm->B_pretranspose_required())
+            {
+                uint8_t *pretransposed = _pretransposed_weights.buffer() + row_gemm.pretransposed_offset;
+                if(row_gemm.pretransposes_b)
+                {
+                    row_gemm.gemm->pretranspose_B_array_generic(pretransposed, _weights->ptr_to_element(row_gemm.weights_start), ldb, 0);
+                }
+                else
+                {
+                    row_gemm.gemm->set_pretransposed_B_data(pretransposed);
+                }
+            }
+            weights_in_use |= !row_gemm.gemm->B_is_pretransposed();
+        }
+
+        // The original weights are not needed anymore once all the GEMMs have their own copy
+        if(!weights_in_use)
+        {
+            _weights->mark_as_unused();
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -23,30 +23,20 @@
  */
 #include "arm_compute/runtime/NEON/functions/NELSTMLayer.h"
 
-#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
-#include "arm_compute/core/utils/misc/ShapeCalculator.h"
-#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 
-#include <cmath>
 #include <memory>
-#include <tuple>
 
 using namespace arm_compute;
-using namespace arm_compute::misc::shape_calculator;
 
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _fully_connected_input_gate(), _gemm_input_gate(), _transpose_input_gate(), _accum_input_gate1(), _accum_input_gate2(), _subtract_input_gate(),
-      _pixelwise_mul_input_gate(), _activation_input_gate(), _fully_connected_forget_gate(), _gemm_forget_gate(), _transpose_forget_gate(), _accum_forget_gate1(), _accum_forget_gate2(),
-      _pixelwise_mul_forget_gate(), _activation_forget_gate(), _fully_connected_cell_state(), _gemm_cell_state1(), _gemm_cell_state2(), _transpose_cell_state(), _accum_cell_state1(), _accum_cell_state2(),
-      _pixelwise_mul_cell_state1(), _activation_cell_state(), _cell_clip(), _pixelwise_mul_cell_state2(), _fully_connected_output(), _gemm_output(), _pixelwise_mul_output_state1(), _transpose_output(),
-      _accum_output1(), _accum_output2(), _activation_output(), _activation_output_state(), _pixelwise_mul_output_state2(), _fully_connected_output_state(), _gemm_output_state(), _accum_output_state(),
-      _projection_clip(), _copy_cell_state(), _copy_output(), _concat_scratch_buffer(), _concat_inputs_forget_gate(), _concat_weights_forget_gate(), _concat_weights_input_gate(), _concat_weights_output(),
-      _input_gate_out1(), _input_gate_out2(), _input_gate_out3(), _input_gate_out4(), _forget_gate_out1(), _forget_gate_out2(), _forget_gate_out3(), _forget_gate_out4(), _forget_gate_out5(),
-      _forget_gate_out6(), _cell_state_out1(), _cell_state_out2(), _cell_state_out3(), _cell_state_out4(), _cell_state_out5(), _output1(), _output2(), _output3(), _output4(), _cell_state_activation(),
-      _output_state1(), _ones(), _run_peephole_opt(false), _run_cifg_opt(false), _perform_cell_clipping(false), _has_projection_weights(false), _perform_projection_clipping(false), _is_prepared(false)
+    : _memory_group(std::move(memory_manager)), _concat_inputs(), _concat_weights_input_gate(), _concat_weights_cell_gate(), _concat_weights_forget_gate(), _concat_weights_output_gate(),
+      _concat_gates_weights(), _concat_gates_bias(), _fully_connected_gates(), _lstm_cell(), _fully_connected_output_state(), _projection_clip(), _copy_output(), _inputs_concat(), _input_gate_weights(),
+      _cell_gate_weights(), _forget_gate_weights(), _output_gate_weights(), _gates_weights(), _gates_bias(), _output_state1(), _original_weights(), _run_cifg_opt(false), _has_projection_weights(false),
+      _perform_projection_clipping(false), _is_prepared(false)
 {
 }
 
@@ -92,179 +82,54 @@ void NELSTMLayer::configure(const ITensor *input,
                                                      scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
                                                      lstm_params_info, activation_info, cell_threshold, projection_threshold));
 
-    const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
-
-    // Configure block that calculates the forget gate
-    // forget_gate = Activation(input * input_to_forget_weights + output_state_in * recurrent_to_forget_weights + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
-    // We optimize this as follows:
-    // forget_gate = Activation( (input,output_state_in) * (input_to_forget_weights,recurrent_to_forget_weights) + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
-    _forget_gate_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _forget_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _forget_gate_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
+    _run_cifg_opt = lstm_params.has_cifg_opt();
 
+    // Configure block that calculates all the gates at once
+    // gates = (input,output_state_in) * ((input_to_X_weights,recurrent_to_X_weights), ...) + (X_bias, ...), with X in [input, cell, forget, output]
+    // The input gate is skipped with CIFG. The pre-activation gates are written directly into the scratch buffer.
     std::vector<const ITensor *> inputs_vector;
     inputs_vector.emplace_back(input);
     inputs_vector.emplace_back(output_state_in);
 
-    _memory_group.manage(&_forget_gate_out2);
-    _concat_inputs_forget_gate.configure(inputs_vector, &_forget_gate_out2);
-
-    std::vector<const ITensor *> weights_vector;
-
-    weights_vector.emplace_back(input_to_forget_weights);
-    weights_vector.emplace_back(recurrent_to_forget_weights);
-
-    _concat_weights_forget_gate.configure(weights_vector, &_forget_gate_out6);
-
-    _memory_group.manage(&_forget_gate_out5);
-    _fully_connected_forget_gate.configure(&_forget_gate_out2, &_forget_gate_out6, forget_gate_bias, &_forget_gate_out5);
-    _memory_group.manage(&_forget_gate_out1);
-    _memory_group.manage(&_forget_gate_out3);
-    _forget_gate_out6.allocator()->allocate();
-
-    Tensor *forget_gate_out = &_forget_gate_out5;
-    if(lstm_params.has_peephole_opt())
-    {
-        _forget_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        _run_peephole_opt = true;
-        _memory_group.manage(&_forget_gate_out4);
-        _pixelwise_mul_forget_gate.configure(cell_state_in, lstm_params.cell_to_forget_weights(), &_forget_gate_out4, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_forget_gate2.configure(&_forget_gate_out5, &_forget_gate_out4, &_forget_gate_out3, ConvertPolicy::SATURATE);
-        _forget_gate_out4.allocator()->allocate();
-        _forget_gate_out5.allocator()->allocate();
-        forget_gate_out = &_forget_gate_out3;
-    }
-    else
-    {
-        _forget_gate_out3.allocator()->allocate();
-    }
-    _activation_forget_gate.configure(forget_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the input gate
-    // input_gate = Activation(input * input_to_input_weights + output_state * recurrent_to_input_weights + PixelWiseMul(cell_state, cell_to_input_weights) + input_gate_bias), without CIFG
-    // input_gate = 1 - forget_gate, with CIFG
-    // We optimize this as follows:
-    // input_gate = Activation((input,output_state) * (input_to_input_weights,recurrent_to_input_weights) + PixelWiseMul(cell_state, cell_to_input_weights) + input_gate_bias), without CIFG
-    _input_gate_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    Tensor *input_gate_out = &_input_gate_out1;
-    if(lstm_params.has_cifg_opt())
-    {
-        _memory_group.manage(&_input_gate_out1);
-        _ones.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _subtract_input_gate.configure(&_ones, forget_gate_out, &_input_gate_out1, ConvertPolicy::SATURATE);
-        _ones.allocator()->allocate();
-        _run_cifg_opt = true;
-    }
-    else
-    {
-        _input_gate_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-        _input_gate_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-        std::vector<const ITensor *> lstm_weights;
-        lstm_weights.emplace_back(lstm_params.input_to_input_weights());
-        lstm_weights.emplace_back(lstm_params.recurrent_to_input_weights());
-
-        _concat_weights_input_gate.configure(lstm_weights, &_input_gate_out2);
-
-        _memory_group.manage(&_input_gate_out1);
-        _memory_group.manage(&_input_gate_out4);
-
-        _fully_connected_input_gate.configure(&_forget_gate_out2, &_input_gate_out2, lstm_params.input_gate_bias(), &_input_gate_out3);
-        _input_gate_out2.allocator()->allocate();
-        input_gate_out = &_input_gate_out3;
-
-        if(_run_peephole_opt)
-        {
-            _memory_group.manage(&_input_gate_out4);
-            _pixelwise_mul_input_gate.configure(cell_state_in, lstm_params.cell_to_input_weights(), &_input_gate_out4, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-            _accum_input_gate2.configure(&_input_gate_out3, &_input_gate_out4, &_input_gate_out1, ConvertPolicy::SATURATE);
-            _input_gate_out3.allocator()->allocate();
-            _input_gate_out4.allocator()->allocate();
-            input_gate_out = &_input_gate_out1;
-        }
-        else
-        {
-            _input_gate_out1.allocator()->allocate();
-        }
-        _activation_input_gate.configure(input_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-    }
-
-    // Configure block that calculates the cell state
-    // cell_state = Clip((PixelwiseMul(input_gate, Activation(input * input_to_cell_weights + output_state_in * recurrent_to_cell_weights + cell_bias)) + PixelwiseMul(forget_gate, cell_state)), cell_threshold)
-    TensorShape cell_state1_shape = compute_transposed_shape(*recurrent_to_output_weights->info());
-    _cell_state_out1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out2.allocator()->init(TensorInfo(cell_state1_shape, 1, input->info()->data_type()));
-    _cell_state_out3.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _cell_state_out5.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    _memory_group.manage(&_cell_state_out1);
-    _fully_connected_cell_state.configure(input, input_to_cell_weights, cell_bias, &_cell_state_out1);
-    _memory_group.manage(&_cell_state_out2);
-    _transpose_cell_state.configure(recurrent_to_cell_weights, &_cell_state_out2);
-    _memory_group.manage(&_cell_state_out3);
-    _gemm_cell_state1.configure(output_state_in, &_cell_state_out2, nullptr, &_cell_state_out3, 1.f, 0.f);
-    _cell_state_out2.allocator()->allocate();
-    _memory_group.manage(&_cell_state_out4);
-    _accum_cell_state1.configure(&_cell_state_out1, &_cell_state_out3, &_cell_state_out4, ConvertPolicy::SATURATE);
-    _activation_cell_state.configure(&_cell_state_out4, nullptr, activation_info);
-    _memory_group.manage(&_cell_state_out5);
-    _pixelwise_mul_cell_state1.configure(&_cell_state_out4, input_gate_out, &_cell_state_out5, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _cell_state_out4.allocator()->allocate();
-    _pixelwise_mul_cell_state2.configure(forget_gate_out, cell_state_in, &_cell_state_out3, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _accum_cell_state2.configure(&_cell_state_out5, &_cell_state_out3, &_cell_state_out1, ConvertPolicy::SATURATE);
-    _cell_state_out3.allocator()->allocate();
-    _cell_state_out5.allocator()->allocate();
-    // Perform clipping
-    if(cell_threshold != 0.f)
-    {
-        _perform_cell_clipping = true;
-        _cell_clip.configure(&_cell_state_out1, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold, cell_threshold));
-    }
-
-    // Configure block that calculates the output
-    // output_state_out = Activation(input * input_to_output_weights + output_state_in * recurrent_to_output_weights + PixelWiseMul(cell_state, cell_to_output_weights) + output_gate_bias)
-    // We optimize this as follows:
-    // output_state_out = Activation( (input,output_state_in) * (input_to_output_weights, recurrent_to_output_weights) + PixelWiseMul(cell_state, cell_to_output_weights) + output_gate_bias)
-    _output1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output4.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-
-    std::vector<const ITensor *> in_out_weights;
-    in_out_weights.emplace_back(input_to_output_weights);
-    in_out_weights.emplace_back(recurrent_to_output_weights);
-
-    _concat_weights_output.configure(in_out_weights, &_output2);
-    _memory_group.manage(&_output1);
-    _memory_group.manage(&_output4);
-
-    _fully_connected_output.configure(&_forget_gate_out2, &_output2, output_gate_bias, &_output4);
-
-    _output2.allocator()->allocate();
-    _forget_gate_out2.allocator()->allocate();
+    _memory_group.manage(&_inputs_concat);
+    _concat_inputs.configure(inputs_vector, &_inputs_concat);
 
-    Tensor *output_gate_out = &_output4;
-    if(lstm_params.has_peephole_opt())
+    std::vector<ITensor *>       gates_weights;
+    std::vector<const ITensor *> gates_bias;
+    if(!_run_cifg_opt)
     {
-        _output3.allocator()->init(TensorInfo(_cell_state_out1.info()->tensor_shape(), 1, input->info()->data_type()));
-
-        _memory_group.manage(&_output3);
-        _pixelwise_mul_output_state1.configure(&_cell_state_out1, lstm_params.cell_to_output_weights(), &_output3, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-        _accum_output2.configure(&_output4, &_output3, &_output1, ConvertPolicy::SATURATE);
-        _output4.allocator()->allocate();
-        output_gate_out = &_output1;
-
-        // Allocate intermediate buffers
-        _output3.allocator()->allocate();
+        _concat_weights_input_gate.configure(std::vector<const ITensor *> { lstm_params.input_to_input_weights(), lstm_params.recurrent_to_input_weights() }, &_input_gate_weights);
+        gates_weights.emplace_back(&_input_gate_weights);
+        gates_bias.emplace_back(lstm_params.input_gate_bias());
+        _original_weights.insert(_original_weights.end(), { lstm_params.input_to_input_weights(), lstm_params.recurrent_to_input_weights(), lstm_params.input_gate_bias() });
     }
-    else
+    _concat_weights_cell_gate.configure(std::vector<const ITensor *> { input_to_cell_weights, recurrent_to_cell_weights }, &_cell_gate_weights);
+    _concat_weights_forget_gate.configure(std::vector<const ITensor *> { input_to_forget_weights, recurrent_to_forget_weights }, &_forget_gate_weights);
+    _concat_weights_output_gate.configure(std::vector<const ITensor *> { input_to_output_weights, recurrent_to_output_weights }, &_output_gate_weights);
+    gates_weights.insert(gates_weights.end(), { &_cell_gate_weights, &_forget_gate_weights, &_output_gate_weights });
+    gates_bias.insert(gates_bias.end(), { cell_bias, forget_gate_bias, output_gate_bias });
+    _original_weights.insert(_original_weights.end(), { input_to_cell_weights, recurrent_to_cell_weights, cell_bias,
+                                                        input_to_forget_weights, recurrent_to_forget_weights, forget_gate_bias,
+                                                        input_to_output_weights, recurrent_to_output_weights, output_gate_bias
+                                                      });
+
+    _concat_gates_weights.configure(gates_weights, &_gates_weights, Window::DimY);
+    _concat_gates_bias.configure(gates_bias, &_gates_bias);
+
+    _fully_connected_gates.configure(&_inputs_concat, &_gates_weights, &_gates_bias, scratch_buffer);
+    _inputs_concat.allocator()->allocate();
+    if(!_run_cifg_opt)
     {
-        _output1.allocator()->allocate();
+        _input_gate_weights.allocator()->allocate();
     }
-    _activation_output.configure(output_gate_out, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-
-    // Configure block that calculates the output state
-    /** lstm_res = PixelwiseMul(output, Activation(cell_state))
+    _cell_gate_weights.allocator()->allocate();
+    _forget_gate_weights.allocator()->allocate();
+    _output_gate_weights.allocator()->allocate();
+    _gates_weights.allocator()->allocate();
+    _gates_bias.allocator()->allocate();
+
+    // Configure block that applies the gate activations, the peephole connections and the cell state update
+    /** lstm_res = PixelwiseMul(output_gate, Activation(cell_state))
      *
      *                      -- Clip(lstm_res * projection_weights + projection_bias, projection_threshold) , if there is a projection
      *                     /
@@ -273,14 +138,15 @@ void NELSTMLayer::configure(const ITensor *input,
      *                      -- lstm_res , otherwise
      */
     ITensor *output_state_out_tmp = lstm_params.has_projection() ? &_output_state1 : output_state_out;
-    _cell_state_activation.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
-    _output_state1.allocator()->init(TensorInfo(cell_state_shape, 1, input->info()->data_type()));
+    if(lstm_params.has_projection())
+    {
+        _output_state1.allocator()->init(TensorInfo(cell_state_in->info()->tensor_shape(), 1, input->info()->data_type()));
+        _memory_group.manage(&_output_state1);
+    }
 
-    _memory_group.manage(&_cell_state_activation);
-    _activation_output_state.configure(&_cell_state_out1, &_cell_state_activation, activation_info);
-    _pixelwise_mul_output_state2.configure(&_cell_state_activation, output_gate_out, output_state_out_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
-    _cell_state_activation.allocator()->allocate();
-    output_gate_out->allocator()->allocate();
+    const ITensor *cell_to_input_weights = (lstm_params.has_peephole_opt() && !_run_cifg_opt) ? lstm_params.cell_to_input_weights() : nullptr;
+    _lstm_cell.configure(scratch_buffer, cell_state_in, cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                         cell_state_out, output_state_out_tmp, activation_info, cell_threshold);
 
     if(lstm_params.has_projection())
     {
@@ -295,24 +161,8 @@ void NELSTMLayer::configure(const ITensor *input,
         }
     }
 
-    // Copy cell state and output
-    _copy_cell_state.configure(&_cell_state_out1, cell_state_out);
+    // Copy output
     _copy_output.configure(output_state_out, output);
-
-    // Vector for holding the tensors to store in scratch buffer
-    std::vector<ITensor *> scratch_inputs;
-    if(!lstm_params.has_cifg_opt())
-    {
-        scratch_inputs.emplace_back(input_gate_out);
-    }
-    scratch_inputs.emplace_back(&_cell_state_out1);
-    scratch_inputs.emplace_back(forget_gate_out);
-    scratch_inputs.emplace_back(output_gate_out);
-    _concat_scratch_buffer.configure(scratch_inputs, scratch_buffer);
-    input_gate_out->allocator()->allocate();
-    _cell_state_out1.allocator()->allocate();
-    forget_gate_out->allocator()->allocate();
-    output_gate_out->allocator()->allocate();
 }
 
 Status NELSTMLayer::validate(const ITensorInfo *input,
@@ -356,11 +206,12 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
     ARM_COMPUTE_RETURN_ERROR_ON(output_state_out->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(cell_state_out->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 2);
-    ARM_COMPUTE_RETURN_ERROR_ON(cell_bias->dimension(0) * 4 != scratch_buffer->dimension(0)
-                                && cell_bias->dimension(0) * 3 != scratch_buffer->dimension(0));
 
     const unsigned int num_batches = input->dimension(1);
     const unsigned int num_cells   = input_to_output_weights->dimension(1);
+    const unsigned int num_inputs  = input->dimension(0) + output_state_in->dimension(0);
+    const unsigned int num_gates   = lstm_params.has_cifg_opt() ? 3 : 4;
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_bias->dimension(0) * num_gates != scratch_buffer->dimension(0));
 
     // Check peephole optimization
     if(lstm_params.has_peephole_opt())
@@ -370,33 +221,16 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_output_weights()->num_dimensions() > 1);
     }
 
-    TensorShape      units_out_transposed_shape = compute_transposed_shape(*recurrent_to_output_weights);
-    TensorShape      num_units_transposed_shape = compute_transposed_shape(*forget_gate_bias);
-    const TensorInfo units_out_transposed_info  = TensorInfo(units_out_transposed_shape, 1, input->data_type());
-    const TensorInfo num_units_transposed_info  = TensorInfo(num_units_transposed_shape, 1, input->data_type());
-
-    TensorInfo input_gate      = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo forget_gate     = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo output_gate_tmp = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-    TensorInfo cell_state_tmp  = TensorInfo(TensorShape(num_cells, num_batches), 1, input->data_type());
-
+    // Validate inputs concatenation
     std::vector<const ITensorInfo *> inputs_vector;
     inputs_vector.emplace_back(input);
     inputs_vector.emplace_back(output_state_in);
-    TensorInfo forget_gate_concat;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(inputs_vector, &forget_gate_concat));
-
-    // Validate forget gate
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_forget_weights, forget_gate_bias, &forget_gate));
-
-    if(lstm_params.has_peephole_opt())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(cell_state_in, lstm_params.cell_to_forget_weights(), &forget_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
-    }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&forget_gate, &forget_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
+    TensorInfo inputs_concat;
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(inputs_vector, &inputs_concat));
 
-    // Validate input gate
+    // Validate gates weights and biases concatenation
+    std::vector<std::vector<const ITensorInfo *>> weights_vectors;
+    std::vector<const ITensorInfo *>              gates_bias;
     if(!lstm_params.has_cifg_opt())
     {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
@@ -405,65 +239,46 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.recurrent_to_input_weights()->num_dimensions() > 2);
         ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.input_gate_bias()->num_dimensions() > 1);
-
-        std::vector<const ITensorInfo *> lstm_weights;
-        lstm_weights.emplace_back(lstm_params.input_to_input_weights());
-        lstm_weights.emplace_back(lstm_params.recurrent_to_input_weights());
-        TensorInfo lstm_gate_concat;
-        ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(lstm_weights, &lstm_gate_concat));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, lstm_params.input_to_input_weights(), lstm_params.input_gate_bias(), &input_gate));
-
         if(lstm_params.has_peephole_opt())
         {
             ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.cell_to_input_weights());
             ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.cell_to_input_weights()->num_dimensions() > 1);
-            ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(cell_state_in, lstm_params.cell_to_input_weights(), &input_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-            ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&input_gate, &input_gate, &input_gate, ConvertPolicy::SATURATE));
         }
-        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&input_gate, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
-    }
-    else
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticSubtractionKernel::validate(&forget_gate, &forget_gate, &forget_gate, ConvertPolicy::SATURATE));
-    }
 
-    // Validate cell state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_cell_weights, cell_bias, &cell_state_tmp));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_in, &units_out_transposed_info, nullptr, &cell_state_tmp, 1.f, 0.f, GEMMInfo()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, nullptr, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &input_gate, &cell_state_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &forget_gate, &cell_state_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&cell_state_tmp, &cell_state_tmp, &cell_state_tmp, ConvertPolicy::SATURATE));
-    if(cell_threshold != 0.f)
+        weights_vectors.push_back({ lstm_params.input_to_input_weights(), lstm_params.recurrent_to_input_weights() });
+        gates_bias.emplace_back(lstm_params.input_gate_bias());
+    }
+    weights_vectors.push_back({ input_to_cell_weights, recurrent_to_cell_weights });
+    weights_vectors.push_back({ input_to_forget_weights, recurrent_to_forget_weights });
+    weights_vectors.push_back({ input_to_output_weights, recurrent_to_output_weights });
+    gates_bias.insert(gates_bias.end(), { cell_bias, forget_gate_bias, output_gate_bias });
+
+    std::vector<TensorInfo>    gate_weights(weights_vectors.size(), TensorInfo(TensorShape(num_inputs, num_cells), 1, input->data_type()));
+    std::vector<ITensorInfo *> gate_weights_raw;
+    for(unsigned int i = 0; i < weights_vectors.size(); ++i)
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold,
-                                                                                                                    cell_threshold)));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(weights_vectors[i], &gate_weights[i]));
+        gate_weights_raw.emplace_back(&gate_weights[i]);
     }
+    const TensorInfo gates_weights(TensorShape(num_inputs, num_cells * num_gates), 1, input->data_type());
+    const TensorInfo gates_bias_concat(TensorShape(num_cells * num_gates), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(gate_weights_raw, &gates_weights, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(gates_bias, &gates_bias_concat));
 
-    // Validate output gate tmp
-    std::vector<const ITensorInfo *> in_out_weights;
-    in_out_weights.emplace_back(input_to_output_weights);
-    in_out_weights.emplace_back(recurrent_to_output_weights);
-    TensorInfo in_out_gate_concat;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(in_out_weights, &in_out_gate_concat));
+    // Validate gates computation
+    const TensorInfo inputs_concat_info(TensorShape(num_inputs, num_batches), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&inputs_concat_info, &gates_weights, &gates_bias_concat, scratch_buffer));
 
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, input_to_output_weights, output_gate_bias, &output_gate_tmp));
-
-    if(lstm_params.has_peephole_opt())
-    {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, lstm_params.cell_to_output_weights(), &output_gate_tmp, 1, ConvertPolicy::SATURATE,
-                                                                              RoundingPolicy::TO_ZERO));
-        ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(&output_gate_tmp, &output_gate_tmp, &output_gate_tmp, ConvertPolicy::SATURATE));
-    }
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&output_gate_tmp, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)));
+    // Validate cell
+    const TensorInfo   output_state_tmp(TensorShape(num_cells, num_batches), 1, input->data_type());
+    const ITensorInfo *cell_to_input_weights = (lstm_params.has_peephole_opt() && !lstm_params.has_cifg_opt()) ? lstm_params.cell_to_input_weights() : nullptr;
+    ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(scratch_buffer, cell_state_in, cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                                                           cell_state_out, lstm_params.has_projection() ? &output_state_tmp : output_state_out, activation_info, cell_threshold));
 
     // Validate output state
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&cell_state_tmp, &cell_state_tmp, activation_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplicationKernel::validate(&cell_state_tmp, &output_gate_tmp, &output_gate_tmp, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
     if(lstm_params.has_projection())
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_gate_tmp, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&output_state_tmp, lstm_params.projection_weights(), lstm_params.projection_bias(), output_state_out));
         if(projection_threshold != 0.f)
         {
             ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(output_state_out, output_state_out,
@@ -472,20 +287,8 @@ Status NELSTMLayer::validate(const ITensorInfo *input,
     }
 
     // Validate copy kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(&cell_state_tmp, cell_state_out));
     ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(output_state_out, output));
 
-    // Validate scratch concatenation
-    std::vector<ITensorInfo *> inputs_vector_info_raw;
-    if(!lstm_params.has_cifg_opt())
-    {
-        inputs_vector_info_raw.push_back(&input_gate);
-    }
-    inputs_vector_info_raw.push_back(&cell_state_tmp);
-    inputs_vector_info_raw.push_back(&forget_gate);
-    inputs_vector_info_raw.push_back(&output_gate_tmp);
-
-    ARM_COMPUTE_RETURN_ON_ERROR(NEWidthConcatenateLayer::validate(inputs_vector_info_raw, scratch_buffer));
     return Status{};
 }
 
@@ -495,64 +298,9 @@ void NELSTMLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    _concat_inputs_forget_gate.run();
-    _fully_connected_forget_gate.run();
-
-    if(_run_peephole_opt)
-    {
-        NEScheduler::get().schedule(&_pixelwise_mul_forget_gate, Window::DimY);
-        _accum_forget_gate2.run();
-    }
-    NEScheduler::get().schedule(&_activation_forget_gate, Window::DimY);
-
-    if(_run_cifg_opt)
-    {
-        if(_ones.info()->data_type() == DataType::F16)
-        {
-            std::fill_n(reinterpret_cast<half *>(_ones.buffer()), _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        else
-        {
-            std::fill_n(reinterpret_cast<float *>(_ones.buffer()), _ones.info()->total_size() / _ones.info()->element_size(), 1);
-        }
-        NEScheduler::get().schedule(&_subtract_input_gate, Window::DimY);
-    }
-    else
-    {
-        _fully_connected_input_gate.run();
-
-        if(_run_peephole_opt)
-        {
-            NEScheduler::get().schedule(&_pixelwise_mul_input_gate, Window::DimY);
-            _accum_input_gate2.run();
-        }
-        NEScheduler::get().schedule(&_activation_input_gate, Window::DimY);
-    }
-
-    _fully_connected_cell_state.run();
-    NEScheduler::get().schedule(&_transpose_cell_state, Window::DimY);
-    _gemm_cell_state1.run();
-    NEScheduler::get().schedule(&_accum_cell_state1, Window::DimY);
-    NEScheduler::get().schedule(&_activation_cell_state, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_cell_state1, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_cell_state2, Window::DimY);
-    NEScheduler::get().schedule(&_accum_cell_state2, Window::DimY);
-
-    if(_perform_cell_clipping)
-    {
-        NEScheduler::get().schedule(&_cell_clip, Window::DimY);
-    }
-
-    _fully_connected_output.run();
-    if(_run_peephole_opt)
-    {
-        NEScheduler::get().schedule(&_pixelwise_mul_output_state1, Window::DimY);
-        _accum_output2.run();
-    }
-    NEScheduler::get().schedule(&_activation_output, Window::DimY);
-
-    NEScheduler::get().schedule(&_activation_output_state, Window::DimY);
-    NEScheduler::get().schedule(&_pixelwise_mul_output_state2, Window::DimY);
+    _concat_inputs.run();
+    _fully_connected_gates.run();
+    NEScheduler::get().schedule(&_lstm_cell, Window::DimY);
 
     if(_has_projection_weights)
     {
@@ -563,22 +311,44 @@ void NELSTMLayer::run()
         }
     }
 
-    NEScheduler::get().schedule(&_copy_cell_state, Window::DimY);
     NEScheduler::get().schedule(&_copy_output, Window::DimY);
-
-    _concat_scratch_buffer.run();
 }
 
 void NELSTMLayer::prepare()
 {
     if(!_is_prepared)
     {
-        _concat_weights_forget_gate.run();
+        // Concatenate the weights and biases of all the gates
         if(!_run_cifg_opt)
         {
             _concat_weights_input_gate.run();
         }
-        _concat_weights_output.run();
+        _concat_weights_cell_gate.run();
+        _concat_weights_forget_gate.run();
+        _concat_weights_output_gate.run();
+        _concat_gates_weights.run();
+        _concat_gates_bias.run();
+
+        // Free the per gate weights and mark the original ones as unused
+        if(!_run_cifg_opt)
+        {
+            _input_gate_weights.allocator()->free();
+        }
+        _cell_gate_weights.allocator()->free();
+        _forget_gate_weights.allocator()->free();
+        _output_gate_weights.allocator()->free();
+        for(const ITensor *weights : _original_weights)
+        {
+            weights->mark_as_unused();
+        }
+
+        // Free the concatenated weights if they have been reshaped by the fully connected layer
+        _fully_connected_gates.prepare();
+        if(!_gates_weights.is_used())
+        {
+            _gates_weights.allocator()->free();
+        }
+
         _is_prepared = true;
     }
 }
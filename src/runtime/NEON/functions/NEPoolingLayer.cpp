@@ -81,7 +81,15 @@ void NEPoolingLayer::run()
             NEScheduler::get().schedule(&_border_handler, Window::DimY);
 
             // Run pooling layer
-            NEScheduler::get().schedule(&_pooling_layer_kernel, _is_global_pooling_layer ? Window::DimZ : Window::DimY);
+            if(_is_global_pooling_layer)
+            {
+                NEScheduler::get().schedule(&_pooling_layer_kernel, Window::DimZ);
+            }
+            else
+            {
+                // Also split along the channels when there are too few output rows to keep all the threads busy
+                NEScheduler::get().schedule(&_pooling_layer_kernel, IScheduler::Hints(Window::DimY).set_secondary_split_dimension(Window::DimZ));
+            }
             break;
         case DataLayout::NHWC:
             // Run pooling layer
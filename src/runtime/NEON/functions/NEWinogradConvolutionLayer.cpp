@@ -31,18 +31,23 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 namespace
 {
-inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
+// The static validation of the transform kernels does not depend on their data type, hence the F32 kernels are used to validate F16 too
+inline Status validate_kernel_3x3(const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
-    if(input_dims.width > 4 && input_dims.height > 4)
+    if(winograd_info.output_tile_size == Size2D(4U, 4U))
     {
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
         ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
@@ -65,9 +70,18 @@ inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *in
 inline Status validate_kernel_5x5(const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 2, 2, 5, 5>::validate(input, input0, winograd_info)));
-    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 2, 2, 5, 5>::validate(weights, input1, winograd_info)));
-    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float, 2, 2, 5, 5>::validate(batched_mm_output, biases, output, winograd_info)));
+    if(winograd_info.output_tile_size == Size2D(4U, 4U))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 4, 4, 5, 5>::validate(input, input0, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 4, 4, 5, 5>::validate(weights, input1, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float, 4, 4, 5, 5>::validate(batched_mm_output, biases, output, winograd_info)));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<float, 2, 2, 5, 5>::validate(input, input0, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<float, 2, 2, 5, 5>::validate(weights, input1, winograd_info)));
+        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<float, 2, 2, 5, 5>::validate(batched_mm_output, biases, output, winograd_info)));
+    }
     if(act_info.enabled())
     {
         NEActivationLayer::validate(output, nullptr, act_info);
@@ -174,19 +188,33 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
-    return INEWinogradLayerTransformWeightsKernel<float>::validate(input, weights);
+    if(input->data_type() == DataType::F16)
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        const size_t idx_width  = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::WIDTH);
+        const size_t idx_height = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::HEIGHT);
+        const Size2D kernel_size(weights->dimension(idx_width), weights->dimension(idx_height));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(kernel_size != Size2D(3U, 3U) && kernel_size != Size2D(5U, 5U), "Only 3x3 and 5x5 kernels are supported for F16");
+#else  // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        ARM_COMPUTE_RETURN_ERROR_MSG("F16 Winograd requires FP16 vector arithmetic support");
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    }
+    return INEWinogradLayerTransformWeightsKernel::validate(input, weights);
 }
 
-Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims)
+Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type, bool enable_fast_math)
 {
     Size2D output_tile = Size2D{};
     if(kernel_dims == Size2D(3U, 3U))
     {
-        output_tile = (input_dims.width <= 4 && input_dims.height <= 4) ? Size2D(2U, 2U) : Size2D(4U, 4U);
+        // F(4x4, 3x3) requires fast math in half precision, fall back to F(2x2, 3x3) otherwise
+        const bool use_small_tile = input_dims.width <= 4 || input_dims.height <= 4 || (data_type == DataType::F16 && !enable_fast_math);
+        output_tile               = use_small_tile ? Size2D(2U, 2U) : Size2D(4U, 4U);
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
-        output_tile = Size2D(2U, 2U);
+        // F(4x4, 5x5) is too inaccurate in half precision
+        output_tile = (data_type == DataType::F16 || input_dims.width <= 8 || input_dims.height <= 8) ? Size2D(2U, 2U) : Size2D(4U, 4U);
     }
     else if(kernel_dims == Size2D(1U, 3U))
     {
@@ -215,30 +243,60 @@ Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims)
     return output_tile;
 }
 
-bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_size)
+bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_size, DataType data_type)
 {
     // Check if we want to configure a Winograd configuration which requires fast math
     using WinogradConfiguration = std::pair<std::pair<int, int>, std::pair<int, int>>;
 
-    const std::vector<WinogradConfiguration> fast_math_winograd =
+    const std::vector<WinogradConfiguration> fast_math_winograd_f32 =
     {
         WinogradConfiguration(std::pair<int, int>(2, 2), std::pair<int, int>(5, 5)),
         WinogradConfiguration(std::pair<int, int>(4, 4), std::pair<int, int>(5, 5))
     };
 
+    const std::vector<WinogradConfiguration> fast_math_winograd_f16 =
+    {
+        WinogradConfiguration(std::pair<int, int>(4, 4), std::pair<int, int>(3, 3)),
+        WinogradConfiguration(std::pair<int, int>(2, 2), std::pair<int, int>(5, 5))
+    };
+
+    const std::vector<WinogradConfiguration> &fast_math_winograd = (data_type == DataType::F16) ? fast_math_winograd_f16 : fast_math_winograd_f32;
+
     auto p = std::make_pair(std::pair<int, int>(output_tile.width, output_tile.height),
                             std::pair<int, int>(kernel_size.width, kernel_size.height));
 
     return std::find(fast_math_winograd.begin(), fast_math_winograd.end(), p) != fast_math_winograd.end();
 }
 
+/** Create a single threaded GEMM multiplying the transformed input of a band by the transformed weights */
+std::unique_ptr<arm_gemm::IGemmCommon> create_band_gemm(DataType data_type, const CPUInfo &ci, unsigned int m, unsigned int n, unsigned int k, unsigned int n_gemms)
+{
+    switch(data_type)
+    {
+        case DataType::F32:
+            return arm_gemm::gemm<float, float>(ci, m, n, k, 1, n_gemms, false, false, 1.f, 0.f, 1, true);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            return arm_gemm::gemm<float16_t, float16_t>(ci, m, n, k, 1, n_gemms, false, false, 1.f, 0.f, 1, true);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            return nullptr;
+    }
+}
 } //namespace
 
-NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
+NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
       _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
-      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false)
+      _weights_hwio(), _streaming_kernel(nullptr), _band_gemms(), _band_workspace(), _pretransposed_weights(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false),
+      _is_streaming(false), _force_streaming(false)
+{
+}
+
+void NEWinogradConvolutionLayer::set_force_streaming(bool force_streaming)
 {
+    _force_streaming = force_streaming;
 }
 
 void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
@@ -253,14 +311,15 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
 
-    const Size2D input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
-    const Size2D kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const DataType data_type   = input->info()->data_type();
+    const Size2D   input_dims  = Size2D(input->info()->dimension(width_idx), input->info()->dimension(height_idx));
+    const Size2D   kernel_size = Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx));
+    const Size2D   output_tile = winograd_output_tile(input_dims, kernel_size, data_type, enable_fast_math);
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
     {
-        ARM_COMPUTE_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size), "This Winograd configuration requires enable_fast_math=true");
+        ARM_COMPUTE_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size, data_type), "This Winograd configuration requires enable_fast_math=true");
     }
 
     _weights     = weights;
@@ -268,16 +327,52 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     _output      = output;
     _is_prepared = false;
 
-    std::unique_ptr<INEWinogradLayerTransformInputKernel<float>>   transform_input_kernel;
-    std::unique_ptr<INEWinogradLayerTransformWeightsKernel<float>> transform_weights_kernel;
-    std::unique_ptr<INEWinogradLayerTransformOutputKernel<float>>  transform_output_kernel;
+    std::unique_ptr<INEWinogradLayerTransformInputKernel>   transform_input_kernel;
+    std::unique_ptr<INEWinogradLayerTransformWeightsKernel> transform_weights_kernel;
+    std::unique_ptr<INEWinogradLayerTransformOutputKernel>  transform_output_kernel;
 
     int n_gemms = 0;
     int N_BLOCK = 0; // Size of block used by GEMM.
 
-    if(kernel_size == Size2D(3, 3))
+    if(data_type == DataType::F16)
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        if(kernel_size == Size2D(3, 3) && output_tile == Size2D(4U, 4U))
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 4, 4, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else if(kernel_size == Size2D(3, 3))
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 2, 2, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else if(kernel_size == Size2D(5, 5))
+        {
+            using config             = NEWinogradLayerConfiguration<float16_t, float16_t, 2, 2, 5, 5>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        {
+            ARM_COMPUTE_ERROR("Not supported.");
+        }
+    }
+    else if(kernel_size == Size2D(3, 3))
     {
-        if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
+        if(output_tile == Size2D(4U, 4U))
         {
             using config             = NEWinogradLayerConfiguration<float, float, 4, 4, 3, 3>;
             transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
@@ -298,12 +393,24 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     }
     else if(kernel_size == Size2D(5, 5))
     {
-        using config             = NEWinogradLayerConfiguration<float, float, 2, 2, 5, 5>;
-        transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-        transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-        transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-        n_gemms                  = config::WinogradBase::N_GEMMS;
-        N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        if(output_tile == Size2D(4U, 4U))
+        {
+            using config             = NEWinogradLayerConfiguration<float, float, 4, 4, 5, 5>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else
+        {
+            using config             = NEWinogradLayerConfiguration<float, float, 2, 2, 5, 5>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
     }
     else if(kernel_size == Size2D(1, 3))
     {
@@ -372,7 +479,6 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int out_channels = output->info()->dimension(channel_idx);
 
     const Tensor4DShape in_shape(internal_get_input_shape(input));
-    const DataType      data_type      = input->info()->data_type();
     const size_t        data_type_size = input->info()->element_size();
     // Get the memory required to instantiate a new Winograd operator.
     constexpr size_t storage_alignment = 64;
@@ -409,35 +515,49 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int kernel_matrix_row_stride = roundup(out_channels, N_BLOCK);
     const int output_matrix_row_stride = kernel_matrix_row_stride;
 
-    TensorShape a_shape(k, m, 1, n_gemms);
-    Strides     a_strides(data_type_size);
-    a_strides.set(1, a_strides[0] * k);
-    //a_strides.set(2, data_type_size * input_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
-    a_strides.set(2, 0);
-    a_strides.set(3, data_type_size * input_matrix_stride);
+    // Stream bands of rows of tiles through the transforms and the GEMM when the transformed input and output do not fit in the L2 caches
+    // of the threads, as each stage would otherwise be bound by the memory bandwidth. Half of the L2 cache is left to the transformed weights.
+    const CPUInfo     &ci              = NEScheduler::get().cpu_info();
+    const unsigned int max_num_threads = NEScheduler::get().num_threads();
+    const size_t       l2_cache_size   = ci.get_L2_cache_size();
+    const int          band_rows       = std::min(tile_rows, NEWinogradLayerStreamingKernel::get_band_rows(tile_cols, n_gemms, k, output_matrix_row_stride, data_type_size, l2_cache_size / 2));
+    const unsigned int num_bands       = in_shape.n_batches * iceildiv(tile_rows, band_rows);
+    _is_streaming                      = kernel_size.width > 1 && kernel_size.height > 1
+                                         && (_force_streaming || (num_bands >= max_num_threads && input_storage_size + output_storage_size > max_num_threads * l2_cache_size));
 
     TensorShape b_shape(n, k, n_gemms);
     Strides     b_strides(data_type_size);
     b_strides.set(1, data_type_size * kernel_matrix_row_stride);
     b_strides.set(2, data_type_size * kernel_matrix_stride);
 
-    TensorShape d_shape(n, m, 1, n_gemms);
-    Strides     d_strides(data_type_size);
-    d_strides.set(1, data_type_size * output_matrix_row_stride);
-    //d_strides.set(2, data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
-    d_strides.set(2, 0);
-    d_strides.set(3, data_type_size * output_matrix_stride);
-
-    TensorInfo a_info{};
     TensorInfo b_info{};
-    TensorInfo d_info{};
-    a_info.init(a_shape, 1, data_type, a_strides, 0, input_storage_size);
     b_info.init(b_shape, 1, data_type, b_strides, 0, kernel_storage_size);
-    d_info.init(d_shape, 1, data_type, d_strides, 0, output_storage_size);
-
-    _input_transformed.allocator()->init(a_info, storage_alignment);
     _kernel_storage.allocator()->init(b_info, storage_alignment);
-    _output_transformed.allocator()->init(d_info, storage_alignment);
+
+    if(!_is_streaming)
+    {
+        TensorShape a_shape(k, m, 1, n_gemms);
+        Strides     a_strides(data_type_size);
+        a_strides.set(1, a_strides[0] * k);
+        //a_strides.set(2, data_type_size * input_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+        a_strides.set(2, 0);
+        a_strides.set(3, data_type_size * input_matrix_stride);
+
+        TensorShape d_shape(n, m, 1, n_gemms);
+        Strides     d_strides(data_type_size);
+        d_strides.set(1, data_type_size * output_matrix_row_stride);
+        //d_strides.set(2, data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+        d_strides.set(2, 0);
+        d_strides.set(3, data_type_size * output_matrix_stride);
+
+        TensorInfo a_info{};
+        TensorInfo d_info{};
+        a_info.init(a_shape, 1, data_type, a_strides, 0, input_storage_size);
+        d_info.init(d_shape, 1, data_type, d_strides, 0, output_storage_size);
+
+        _input_transformed.allocator()->init(a_info, storage_alignment);
+        _output_transformed.allocator()->init(d_info, storage_alignment);
+    }
 
     // configure and allocate dst tensor to be used to convert from winograd domain to spatial domain when calling to reshape_output()
     TensorInfo info(TensorShape(_output->info()->dimension(2), _output->info()->dimension(0),
@@ -445,10 +565,9 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
                     1, _output->info()->data_type());
     _output_nhwc.allocator()->init(info);
 
-    const ITensor     *input_to_use  = _input;
-    ITensor           *output_to_use = _output;
-    PermutationVector  weights_permutation_vector(3U, 0U, 1U, 2U);
-    const unsigned int max_num_threads = NEScheduler::get().num_threads();
+    const ITensor    *input_to_use  = _input;
+    ITensor          *output_to_use = _output;
+    PermutationVector weights_permutation_vector(3U, 0U, 1U, 2U);
 
     // Configure the kernel to transform the input tensor from NCHW -> NHWC
     if(data_layout == DataLayout::NCHW)
@@ -460,17 +579,24 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     }
 
     // Configure input transform kernel
-    _memory_group.manage(&_input_transformed);
+    if(!_is_streaming)
+    {
+        _memory_group.manage(&_input_transformed);
+    }
     _memory_group.manage(&_input_workspace);
     transform_input_kernel->configure(input_to_use, in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, in_shape.n_channels, use_padding_type,
-                                      &_input_transformed, input_matrix_stride, &_input_workspace);
+                                      _is_streaming ? nullptr : &_input_transformed, input_matrix_stride, &_input_workspace);
     const size_t input_workspace_size = transform_input_kernel->get_working_space_size(max_num_threads);
     TensorInfo   input_workspace_info(TensorShape(input_workspace_size), 1, _input->info()->data_type());
     _input_workspace.allocator()->init(input_workspace_info);
-    _input_workspace.allocator()->allocate();
-    if(data_layout == DataLayout::NCHW)
+    if(!_is_streaming)
     {
-        _input_nhwc.allocator()->allocate();
+        // The input transform runs before the GEMM: its workspace and the NHWC input are not needed afterwards
+        _input_workspace.allocator()->allocate();
+        if(data_layout == DataLayout::NCHW)
+        {
+            _input_nhwc.allocator()->allocate();
+        }
     }
 
     // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
@@ -478,9 +604,12 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
 
     // Configure GEMM function
-    _memory_group.manage(&_output_transformed);
-    _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
-    _input_transformed.allocator()->allocate();
+    if(!_is_streaming)
+    {
+        _memory_group.manage(&_output_transformed);
+        _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+        _input_transformed.allocator()->allocate();
+    }
 
     // Configure output transform function
     // The biases tensor has not been allocated at this point in time, the output transform will add the biases to the final result in the run() method
@@ -489,14 +618,48 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
         _memory_group.manage(&_output_nhwc);
         output_to_use = &_output_nhwc;
     }
-    transform_output_kernel->configure(biases, &_output_transformed,
+    transform_output_kernel->configure(biases, _is_streaming ? nullptr : &_output_transformed,
                                        output_matrix_stride, output_to_use,
                                        in_shape.n_batches, output_shape.n_rows, output_shape.n_cols, out_channels, &_output_workspace);
     const size_t output_workspace_size = transform_output_kernel->get_working_space_size(max_num_threads);
     TensorInfo   output_workspace_info(TensorShape(output_workspace_size), 1, _output->info()->data_type());
     _output_workspace.allocator()->init(output_workspace_info);
     _output_workspace.allocator()->allocate();
-    _output_transformed.allocator()->allocate();
+
+    if(_is_streaming)
+    {
+        // Each thread multiplies its bands with its own single threaded GEMM
+        std::vector<arm_gemm::IGemmCommon *> band_gemms;
+        _band_gemms.clear();
+        for(unsigned int t = 0; t < max_num_threads; ++t)
+        {
+            _band_gemms.emplace_back(create_band_gemm(data_type, ci, band_rows * tile_cols, n, k, n_gemms));
+            band_gemms.push_back(_band_gemms.back().get());
+        }
+        if(_band_gemms[0]->B_pretranspose_required())
+        {
+            _pretransposed_weights.allocator()->init(TensorInfo(TensorShape(_band_gemms[0]->get_B_pretransposed_array_size()), 1, DataType::U8), storage_alignment);
+        }
+
+        auto streaming_kernel = support::cpp14::make_unique<NEWinogradLayerStreamingKernel>();
+        streaming_kernel->configure(transform_input_kernel.get(), transform_output_kernel.get(), band_gemms, &_kernel_storage, &_band_workspace,
+                                    in_shape.n_batches, tile_rows, tile_cols, band_rows, n_gemms, k, output_matrix_row_stride);
+        _memory_group.manage(&_band_workspace);
+        _band_workspace.allocator()->init(TensorInfo(TensorShape(streaming_kernel->get_workspace_size()), 1, DataType::U8), storage_alignment);
+        _streaming_kernel = std::move(streaming_kernel);
+
+        // The input is read by the streaming kernel, together with the band buffers
+        _band_workspace.allocator()->allocate();
+        _input_workspace.allocator()->allocate();
+        if(data_layout == DataLayout::NCHW)
+        {
+            _input_nhwc.allocator()->allocate();
+        }
+    }
+    else
+    {
+        _output_transformed.allocator()->allocate();
+    }
 
     // Reorder the convoluted output to ACL's ordering NCHW
     if(data_layout == DataLayout::NCHW)
@@ -531,14 +694,38 @@ void NEWinogradConvolutionLayer::run()
         _permute_input.run();
     }
 
-    // Transform input tensor to the winograd domain
-    NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
+    if(_is_streaming)
+    {
+        // Transform, multiply and transform back bands of rows of tiles. The GEMMs and buffers of the bands are created for the number of
+        // threads at configuration time, so the bands are split in as many workloads at most, each using the GEMM of its index
+        const Window      &window        = _streaming_kernel->window();
+        const unsigned int num_workloads = std::min({ static_cast<unsigned int>(_band_gemms.size()), NEScheduler::get().num_threads(),
+                                                      static_cast<unsigned int>(window.num_iterations(Window::DimX))
+                                                    });
+        std::vector<IScheduler::Workload> workloads(num_workloads);
+        for(unsigned int t = 0; t < num_workloads; ++t)
+        {
+            workloads[t] = [this, &window, t, num_workloads](const ThreadInfo & info)
+            {
+                ThreadInfo band_info  = info;
+                band_info.thread_id   = t;
+                band_info.num_threads = num_workloads;
+                _streaming_kernel->run(window.split_window(Window::DimX, t, num_workloads), band_info);
+            };
+        }
+        NEScheduler::get().run_tagged_workloads(workloads, "NEWinogradLayerStreamingKernel");
+    }
+    else
+    {
+        // Transform input tensor to the winograd domain
+        NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
 
-    //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    _gemm_function.run();
+        //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
+        _gemm_function.run();
 
-    // Transform output tensor to the spatial domain
-    NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
+        // Transform output tensor to the spatial domain
+        NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
+    }
 
     if(data_layout == DataLayout::NCHW)
     {
@@ -565,12 +752,12 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->dimension(idx_width), input->dimension(idx_height));
     const Size2D kernel_size = Size2D(weights->dimension(idx_width), weights->dimension(idx_height));
-    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size);
+    const Size2D output_tile = winograd_output_tile(input_dims, kernel_size, input->data_type(), enable_fast_math);
 
     // Check if the Winograd configuration requires fast math
     if(!enable_fast_math)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size), "This Winograd configuration requires enable_fast_math=true");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(check_support_fast_math(output_tile, kernel_size, input->data_type()), "This Winograd configuration requires enable_fast_math=true");
     }
 
     const WinogradInfo winograd_info = WinogradInfo(output_tile,
@@ -599,7 +786,7 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_right() != conv_info.pad_left(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_bottom(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_left(), "Only SAME or VALID padding supported");
-        return validate_kernel_3x3(input_dims, input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
+        return validate_kernel_3x3(input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
     }
     else if(kernel_size == Size2D(5, 5))
     {
@@ -665,16 +852,56 @@ void NEWinogradConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        // Permute weights
-        _weights_hwio.allocator()->allocate();
-        _permute_weights.run();
-        _weights->mark_as_unused();
-
-        // Transform weights
-        _kernel_storage.allocator()->allocate();
-        NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+        // Map the transformed weights from the weights cache if available
+        WeightsCache *cache  = (_weights_manager != nullptr) ? _weights_manager->weights_cache() : nullptr;
+        const size_t  size   = _kernel_storage.info()->total_size();
+        void         *cached = nullptr;
+        std::string   cache_key;
+        if(cache != nullptr)
+        {
+            // The number of GEMMs identifies the output tile used
+            const std::string transform_id = std::string(_transform_weights_kernel->name()) + "_" + support::cpp11::to_string(_kernel_storage.info()->dimension(2));
+            cache_key                      = WeightsCache::compute_key(transform_id, *_weights, size);
+            cached                         = cache->load(cache_key, size);
+        }
+        if(cached != nullptr)
+        {
+            _kernel_storage.allocator()->import_memory(cached);
+            _weights->mark_as_unused();
+        }
+        else
+        {
+            // Permute weights
+            _weights_hwio.allocator()->allocate();
+            _permute_weights.run();
+            _weights->mark_as_unused();
+
+            // Transform weights
+            _kernel_storage.allocator()->allocate();
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+
+            _weights_hwio.allocator()->free();
+            if(cache != nullptr)
+            {
+                cache->store(cache_key, _kernel_storage.buffer(), size);
+            }
+        }
 
-        _weights_hwio.allocator()->free();
+        // Pretranspose the transformed weights once for the GEMMs of all the threads
+        if(_is_streaming && _band_gemms[0]->B_pretranspose_required())
+        {
+            const size_t element_size   = _kernel_storage.info()->element_size();
+            const int    ldb            = _kernel_storage.info()->strides_in_bytes()[1] / element_size;
+            const int    multi_stride_b = _kernel_storage.info()->strides_in_bytes()[2] / element_size;
+
+            _pretransposed_weights.allocator()->allocate();
+            _band_gemms[0]->pretranspose_B_array_generic(_pretransposed_weights.buffer(), _kernel_storage.buffer() + _kernel_storage.info()->offset_first_element_in_bytes(), ldb, multi_stride_b);
+            for(size_t i = 1; i < _band_gemms.size(); ++i)
+            {
+                _band_gemms[i]->set_pretransposed_B_data(_pretransposed_weights.buffer());
+            }
+            _kernel_storage.allocator()->free();
+        }
         _is_prepared = true;
     }
 }
@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/kernels/assembly/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/ToolchainSupport.h"
 
 #include "src/core/NEON/kernels/assembly/NEGEMMInterleavedStrategies.h"
 
@@ -174,9 +175,46 @@ public:
     }
 };
 
-NEGEMMInterleavedWrapper::NEGEMMInterleavedWrapper(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager))
+void NEGEMMInterleavedTransformB::configure(Tensor *transformed_b, INEKernel *prepare_b, const std::string &uid)
 {
+    ARM_COMPUTE_ERROR_ON_NULLPTR(transformed_b, prepare_b);
+    _transformed_b = transformed_b;
+    _prepare_b     = prepare_b;
+    _uid           = uid;
+}
+
+ITensor *NEGEMMInterleavedTransformB::get_weights()
+{
+    return _transformed_b;
+}
+
+std::string NEGEMMInterleavedTransformB::uid()
+{
+    return _uid;
+}
+
+void NEGEMMInterleavedTransformB::run()
+{
+    _transformed_b->allocator()->allocate();
+    NEScheduler::get().schedule(_prepare_b, Window::DimX);
+    _reshape_run = true;
+}
+
+void NEGEMMInterleavedTransformB::release()
+{
+    _transformed_b->allocator()->free();
+}
+
+NEGEMMInterleavedWrapper::NEGEMMInterleavedWrapper(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(std::move(memory_manager)), _weights_manager(weights_manager)
+{
+}
+
+size_t NEGEMMInterleavedWrapper::pretransposed_weights_size() const
+{
+    // The pretransposed B matrix is held by the weights manager when shared
+    const bool is_managed = _weights_manager != nullptr && _weights_manager->are_weights_managed(_b);
+    return (_pretranspose_b && !is_managed && _transformed_b.buffer() != nullptr) ? _transformed_b.info()->total_size() : 0;
 }
 
 void NEGEMMInterleavedWrapper::run()
@@ -193,8 +231,16 @@ void NEGEMMInterleavedWrapper::prepare()
     {
         if(_pretranspose_b)
         {
-            _transformed_b.allocator()->allocate();
-            NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+            if(_weights_manager != nullptr && _weights_manager->are_weights_managed(_b))
+            {
+                // The pretranspose is only run by the first function requesting it
+                _weights_manager->run(_b, &_weights_transform);
+            }
+            else
+            {
+                _transformed_b.allocator()->allocate();
+                NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+            }
             _b->mark_as_unused();
         }
         else
@@ -390,11 +436,20 @@ void NEGEMMInterleavedWrapper::configure(const ITensor *a, const ITensor *b, ITe
     _prepare_b = strategy->instantiate_prepareB(b, &_transformed_b, _params, ci);
     ARM_COMPUTE_ERROR_ON(_prepare_b == nullptr);
 
+    ITensor *transformed_b = &_transformed_b;
     if(_pretranspose_b)
     {
         _block_sizes = _prepare_b->block_sizes();
         _batch_window.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(_block_sizes.m_round, _block_sizes.strategy_out_height), _block_sizes.strategy_out_height));
         _batch_window.set(Window::DimY, Window::Dimension(0, _params.batches));
+
+        // Share the pretransposed B matrix with the functions using the same weights
+        if(_weights_manager != nullptr && _weights_manager->are_weights_managed(b))
+        {
+            _weights_transform.configure(&_transformed_b, _prepare_b.get(),
+                                         _tag + "_" + support::cpp11::to_string(_block_sizes.x_block) + "x" + support::cpp11::to_string(_block_sizes.k_block));
+            transformed_b = _weights_manager->acquire(b, &_weights_transform);
+        }
     }
 
     _block_walker.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(_params.N, _block_sizes.x_block), _block_sizes.x_block));
@@ -406,7 +461,7 @@ void NEGEMMInterleavedWrapper::configure(const ITensor *a, const ITensor *b, ITe
     _memory_group.manage(&_tmp_c);
 
     _transform_a     = strategy->instantiate_transformA(_a, &_transformed_a, _block_walker, _params);
-    _matrix_multiply = strategy->instantiate_matrix_multiply(&_transformed_a, &_transformed_b, &_tmp_c, c, _block_walker, _block_sizes, _params, alpha, beta, pretranspose_b, num_threads);
+    _matrix_multiply = strategy->instantiate_matrix_multiply(&_transformed_a, transformed_b, &_tmp_c, c, _block_walker, _block_sizes, _params, alpha, beta, pretranspose_b, num_threads);
     ARM_COMPUTE_ERROR_ON(_transform_a == nullptr);
     ARM_COMPUTE_ERROR_ON(_matrix_multiply == nullptr);
 
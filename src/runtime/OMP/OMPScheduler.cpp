@@ -62,9 +62,14 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
                              "Dynamic scheduling is not supported in OMPScheduler");
 
     const Window      &max_window     = kernel->window();
-    const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
+    const unsigned int num_iterations = num_split_iterations(max_window, hints);
     const unsigned int num_threads    = std::min(num_iterations, _num_threads);
 
+    if(num_iterations == 0)
+    {
+        return;
+    }
+
     if(!kernel->is_parallelisable() || num_threads == 1)
     {
         ThreadInfo info;
@@ -73,14 +78,15 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     }
     else
     {
-        const unsigned int                num_windows = num_threads;
-        std::vector<IScheduler::Workload> workloads(num_windows);
+        const std::pair<unsigned int, unsigned int> grid        = split_grid(max_window, hints, num_threads);
+        const unsigned int                          num_windows = grid.first * grid.second;
+        std::vector<IScheduler::Workload>           workloads(num_windows);
         for(unsigned int t = 0; t < num_windows; t++)
         {
             //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            workloads[t] = [t, &hints, &max_window, &grid, &kernel](const ThreadInfo & info)
             {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                Window win = split_window(max_window, hints, grid, t);
                 win.validate();
                 kernel->run(win, info);
             };
@@ -31,6 +31,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -43,10 +45,155 @@ size_t align_offset(size_t offset, size_t alignment)
     const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
     return (remainder != 0U) ? offset + (alignment - remainder) : offset;
 }
+
+/** Lifetime interval of a tensor to place in the blob */
+struct Interval
+{
+    IMemory *handle;    /**< Tensor's memory handle */
+    size_t   size;      /**< Tensor's size */
+    size_t   alignment; /**< Alignment requirement */
+    size_t   start;     /**< Timestamp of the start of the lifetime */
+    size_t   end;       /**< Timestamp of the end of the lifetime */
+    size_t   breadth;   /**< Largest total size of the tensors alive at one of the timestamps of the interval */
+    size_t   offset;    /**< Offset of the tensor in the blob */
+};
+
+bool are_alive_together(const Interval &a, const Interval &b)
+{
+    return (a.start <= b.end) && (b.start <= a.end);
+}
+
+/** Build the lifetime intervals of the tensors of a group
+ *
+ * @param[in] elements Tensors of the group.
+ *
+ * @return The lifetime intervals of the tensors
+ */
+template <typename Elements>
+std::vector<Interval> build_intervals(const Elements &elements)
+{
+    std::vector<Interval> intervals;
+    intervals.reserve(elements.size());
+    for(const auto &element : elements)
+    {
+        intervals.push_back(Interval{ element.second.handle, element.second.size, element.second.alignment, element.second.lifetime_start, element.second.lifetime_end, 0, 0 });
+    }
+    return intervals;
+}
+
+/** Compute the total size of the tensors alive at each timestamp
+ *
+ * @param[in] intervals      Lifetime intervals of the tensors.
+ * @param[in] num_timestamps Number of timestamps.
+ *
+ * @return The total size of the alive tensors for each timestamp
+ */
+std::vector<size_t> compute_breadths(const std::vector<Interval> &intervals, size_t num_timestamps)
+{
+    std::vector<size_t> breadths(num_timestamps, 0);
+    for(const auto &interval : intervals)
+    {
+        ARM_COMPUTE_ERROR_ON(interval.end >= num_timestamps);
+        for(size_t t = interval.start; t <= interval.end; ++t)
+        {
+            breadths[t] += interval.size;
+        }
+    }
+    return breadths;
+}
+
+/** Find the offset of the tightest gap that fits a tensor between the already placed tensors alive at the same time
+ *
+ * @param[in] interval Lifetime interval of the tensor to place.
+ * @param[in] placed   Lifetime intervals of the tensors already placed.
+ *
+ * @return The offset of the tensor, or the end of the last tensor alive at the same time if no gap is large enough
+ */
+size_t find_best_fit(const Interval &interval, const std::vector<const Interval *> &placed)
+{
+    std::vector<const Interval *> alive;
+    std::copy_if(std::begin(placed), std::end(placed), std::back_inserter(alive), [&](const Interval * p)
+    {
+        return are_alive_together(*p, interval);
+    });
+    std::sort(std::begin(alive), std::end(alive), [](const Interval * a, const Interval * b)
+    {
+        return a->offset < b->offset;
+    });
+
+    size_t best_offset = 0;
+    size_t best_gap    = std::numeric_limits<size_t>::max();
+    size_t gap_start   = 0;
+    for(const Interval *p : alive)
+    {
+        const size_t offset = align_offset(gap_start, interval.alignment);
+        if((offset + interval.size <= p->offset) && (p->offset - gap_start < best_gap))
+        {
+            best_offset = offset;
+            best_gap    = p->offset - gap_start;
+        }
+        gap_start = std::max(gap_start, p->offset + p->size);
+    }
+    return (best_gap != std::numeric_limits<size_t>::max()) ? best_offset : align_offset(gap_start, interval.alignment);
+}
+
+/** Assign to the tensors offsets that pack their lifetime intervals
+ *
+ * @param[in, out] intervals  Lifetime intervals of the tensors. Their offsets are updated.
+ * @param[in]      breadths   Total size of the alive tensors at each timestamp.
+ * @param[in]      by_breadth True to place first the tensors alive when the memory footprint is the largest, false to place first the largest tensors.
+ *
+ * @return The size of the memory needed by the tensors
+ */
+size_t plan_intervals(std::vector<Interval> &intervals, const std::vector<size_t> &breadths, bool by_breadth)
+{
+    // Place the largest tensors first
+    std::vector<Interval *> order;
+    order.reserve(intervals.size());
+    for(auto &interval : intervals)
+    {
+        interval.breadth = *std::max_element(std::begin(breadths) + interval.start, std::begin(breadths) + interval.end + 1);
+        order.push_back(&interval);
+    }
+    std::stable_sort(std::begin(order), std::end(order), [](const Interval * a, const Interval * b)
+    {
+        return a->size > b->size;
+    });
+
+    // Place first the tensors alive when the memory footprint is the largest, the largest ones first
+    if(by_breadth)
+    {
+        std::stable_sort(std::begin(order), std::end(order), [](const Interval * a, const Interval * b)
+        {
+            return a->breadth > b->breadth;
+        });
+    }
+
+    std::vector<const Interval *> placed;
+    placed.reserve(order.size());
+    size_t size = 0;
+    for(Interval *interval : order)
+    {
+        interval->offset = find_best_fit(*interval, placed);
+        placed.push_back(interval);
+        size = std::max(size, interval->offset + interval->size);
+    }
+    return size;
+}
 } // namespace
-OffsetLifetimeManager::OffsetLifetimeManager()
-    : _blob(0)
+OffsetLifetimeManager::OffsetLifetimeManager(OffsetPlanningStrategy strategy)
+    : _strategy(strategy), _blob(0), _peak_size(0)
+{
+}
+
+size_t OffsetLifetimeManager::planned_size() const
 {
+    return _blob.size;
+}
+
+size_t OffsetLifetimeManager::peak_size() const
+{
+    return _peak_size;
 }
 
 std::unique_ptr<IMemoryPool> OffsetLifetimeManager::create_pool(IAllocator *allocator)
@@ -60,36 +207,67 @@ MappingType OffsetLifetimeManager::mapping_type() const
     return MappingType::OFFSETS;
 }
 
+size_t OffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
 void OffsetLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
-    // Update blob size
-    size_t max_aggregated_size = 0;
+    // Compute the memory footprint at each point of the execution
+    std::vector<Interval>     intervals = build_intervals(_active_elements);
+    const std::vector<size_t> breadths  = compute_breadths(intervals, _timestamp);
+    if(!breadths.empty())
+    {
+        _peak_size = std::max(_peak_size, *std::max_element(std::begin(breadths), std::end(breadths)));
+    }
+
+    _blob.owners = std::max(_blob.owners, _free_blobs.size());
     std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
     {
-        max_aggregated_size += b.max_size;
         _blob.alignment = std::max(_blob.alignment, b.max_alignment);
     });
-    max_aggregated_size += _free_blobs.size() * _blob.alignment;
-    _blob.owners = std::max(_blob.owners, _free_blobs.size());
-    _blob.size   = std::max(_blob.size, max_aggregated_size);
 
-    // Calculate group mappings
     auto &group_mappings = _active_group->mappings();
-    size_t offset         = 0;
-    for(auto &free_blob : _free_blobs)
+    if(_strategy == OffsetPlanningStrategy::BLOBS)
     {
-        for(auto &bound_element_id : free_blob.bound_elements)
+        // Update blob size
+        size_t max_aggregated_size = 0;
+        std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
+        {
+            max_aggregated_size += b.max_size;
+        });
+        max_aggregated_size += _free_blobs.size() * _blob.alignment;
+        _blob.size = std::max(_blob.size, max_aggregated_size);
+
+        // Calculate group mappings
+        size_t offset = 0;
+        for(auto &free_blob : _free_blobs)
+        {
+            for(auto &bound_element_id : free_blob.bound_elements)
+            {
+                ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+                Element &bound_element               = _active_elements[bound_element_id];
+                group_mappings[bound_element.handle] = offset;
+            }
+            offset += free_blob.max_size;
+            offset = align_offset(offset, _blob.alignment);
+            ARM_COMPUTE_ERROR_ON(offset > _blob.size);
+        }
+    }
+    else
+    {
+        // Update blob size
+        _blob.size = std::max(_blob.size, plan_intervals(intervals, breadths, _strategy == OffsetPlanningStrategy::GREEDY_BY_BREADTH));
+
+        // Calculate group mappings
+        for(const auto &interval : intervals)
         {
-            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
-            Element &bound_element               = _active_elements[bound_element_id];
-            group_mappings[bound_element.handle] = offset;
+            group_mappings[interval.handle] = interval.offset;
         }
-        offset += free_blob.max_size;
-        offset = align_offset(offset, _blob.alignment);
-        ARM_COMPUTE_ERROR_ON(offset > _blob.size);
     }
 }
 } // namespace arm_compute
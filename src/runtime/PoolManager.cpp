@@ -27,65 +27,134 @@
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "support/ToolchainSupport.h"
 
-#include <list>
+#include <algorithm>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Index of the calling thread, starting from 1 */
+size_t thread_index()
+{
+    static std::atomic<size_t> num_threads{ 0 };
+    thread_local const size_t  index = ++num_threads;
+    return index;
+}
+} // namespace
+
 PoolManager::PoolManager()
-    : _free_pools(), _occupied_pools(), _sem(), _mtx()
+    : _slots(), _num_free(0), _num_waiters(0), _mtx(), _cv()
 {
 }
 
 IMemoryPool *PoolManager::lock_pool()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_slots.empty(), "Haven't setup any pools!");
 
-    _sem->wait();
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
-    _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
-    return _occupied_pools.front().get();
+    // Reserve one of the free pools, waiting for a pool to be unlocked if they are all occupied
+    int num_free = _num_free.load();
+    while(num_free <= 0 || !_num_free.compare_exchange_weak(num_free, num_free - 1))
+    {
+        if(num_free <= 0)
+        {
+            wait_for_free_pool();
+            num_free = _num_free.load();
+        }
+    }
+
+    // Prefer the pool locked last by this thread
+    const size_t owner     = thread_index();
+    const size_t num_slots = _slots.size();
+    for(auto &slot : _slots)
+    {
+        if(slot->last_owner.load(std::memory_order_relaxed) == owner)
+        {
+            bool expected = false;
+            if(slot->occupied.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                return slot->pool.get();
+            }
+            break;
+        }
+    }
+
+    // Otherwise take the first free pool, starting from a different pool on each thread to spread them across the pools.
+    // The reservation guarantees that a pool is free or will be freed by a thread which has finished looking for its own.
+    for(size_t i = 0;; ++i)
+    {
+        PoolSlot &slot     = *_slots[(owner + i) % num_slots];
+        bool      expected = false;
+        if(!slot.occupied.load(std::memory_order_relaxed) && slot.occupied.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            slot.last_owner.store(owner, std::memory_order_relaxed);
+            return slot.pool.get();
+        }
+    }
 }
 
 void PoolManager::unlock_pool(IMemoryPool *pool)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_slots.empty(), "Haven't setup any pools!");
 
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools), [pool](const std::unique_ptr<IMemoryPool> &pool_it)
+    auto it = std::find_if(std::begin(_slots), std::end(_slots), [pool](const std::unique_ptr<PoolSlot> &slot)
+    {
+        return slot->pool.get() == pool;
+    });
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_slots) || !(*it)->occupied.load(), "Pool to be unlocked couldn't be found!");
+    (*it)->occupied.store(false, std::memory_order_release);
+    _num_free.fetch_add(1);
+
+    // Only take the lock when a thread is waiting: it is then guaranteed to be either waiting or to see the unlocked pool
+    if(_num_waiters.load() > 0)
+    {
+        std::lock_guard<arm_compute::Mutex> lock(_mtx);
+        _cv.notify_one();
+    }
+}
+
+void PoolManager::wait_for_free_pool()
+{
+#ifndef NO_MULTI_THREADING
+    std::unique_lock<arm_compute::Mutex> lock(_mtx);
+    ++_num_waiters;
+    _cv.wait(lock, [this]()
     {
-        return pool_it.get() == pool;
+        return _num_free.load() > 0;
     });
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
-    _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
-    _sem->signal();
+    --_num_waiters;
+#else  /* NO_MULTI_THREADING */
+    ARM_COMPUTE_ERROR("All the pools are occupied");
+#endif /* NO_MULTI_THREADING */
 }
 
 void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_slots.size()), "All pools should be free in order to register a new one!");
 
     // Set pool
-    _free_pools.push_front(std::move(pool));
-
-    // Update semaphore
-    _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
+    auto slot  = support::cpp14::make_unique<PoolSlot>();
+    slot->pool = std::move(pool);
+    slot->occupied.store(false);
+    slot->last_owner.store(0);
+    _slots.push_back(std::move(slot));
+
+    // Update the number of free pools
+    _num_free.store(static_cast<int>(_slots.size()));
 }
 
 std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to release one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_slots.size()), "All pools should be free in order to release one!");
 
-    if(!_free_pools.empty())
+    if(!_slots.empty())
     {
-        std::unique_ptr<IMemoryPool> pool = std::move(_free_pools.front());
-        ARM_COMPUTE_ERROR_ON(_free_pools.front() != nullptr);
-        _free_pools.pop_front();
+        std::unique_ptr<IMemoryPool> pool = std::move(_slots.back()->pool);
+        _slots.pop_back();
 
-        // Update semaphore
-        _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
+        // Update the number of free pools
+        _num_free.store(static_cast<int>(_slots.size()));
 
         return pool;
     }
@@ -96,16 +165,16 @@ std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 void PoolManager::clear_pools()
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
-    _free_pools.clear();
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_slots.size()), "All pools should be free in order to clear the PoolManager!");
+    _slots.clear();
 
-    // Update semaphore
-    _sem = nullptr;
+    // Update the number of free pools
+    _num_free.store(0);
 }
 
 size_t PoolManager::num_pools() const
 {
     std::lock_guard<arm_compute::Mutex> lock(_mtx);
 
-    return _free_pools.size() + _occupied_pools.size();
-}
\ No newline at end of file
+    return _slots.size();
+}
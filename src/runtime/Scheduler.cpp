@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
 
 #include "arm_compute/runtime/SingleThreadScheduler.h"
@@ -66,6 +67,14 @@ bool Scheduler::is_available(Type t)
             return true;
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             return false;
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+        }
+        case Type::WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return true;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            return false;
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
         }
         case Type::OMP:
@@ -88,13 +97,40 @@ bool Scheduler::is_available(Type t)
     }
 }
 
+#ifndef BARE_METAL
+namespace
+{
+thread_local IScheduler *thread_local_scheduler = nullptr;
+} // namespace
+#endif /* BARE_METAL */
+
 Scheduler::Type Scheduler::get_type()
 {
     return _scheduler_type;
 }
 
+IScheduler *Scheduler::set_thread_local(IScheduler *scheduler)
+{
+#ifndef BARE_METAL
+    IScheduler *previous   = thread_local_scheduler;
+    thread_local_scheduler = scheduler;
+    return previous;
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(scheduler);
+    ARM_COMPUTE_ERROR_ON_MSG(scheduler != nullptr, "Thread local schedulers are not supported on bare metal.");
+    return nullptr;
+#endif /* BARE_METAL */
+}
+
 IScheduler &Scheduler::get()
 {
+#ifndef BARE_METAL
+    if(thread_local_scheduler != nullptr)
+    {
+        return *thread_local_scheduler;
+    }
+#endif /* BARE_METAL */
+
     switch(_scheduler_type)
     {
         case Type::ST:
@@ -107,6 +143,15 @@ IScheduler &Scheduler::get()
             return CPPScheduler::get();
 #else  /* ARM_COMPUTE_CPP_SCHEDULER */
             ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use C++11 scheduler.");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+            break;
+        }
+        case Type::WORK_STEALING:
+        {
+#if ARM_COMPUTE_CPP_SCHEDULER
+            return CPPWorkStealingScheduler::get();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+            ARM_COMPUTE_ERROR("Recompile with cppthreads=1 to use the work stealing scheduler.");
 #endif /* ARM_COMPUTE_CPP_SCHEDULER */
             break;
         }
@@ -161,6 +161,23 @@ Status TensorAllocator::import_memory(void *memory)
     return Status{};
 }
 
+Status TensorAllocator::import_shared_memory(std::shared_ptr<IMemoryRegion> memory)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(memory == nullptr || memory->buffer() == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(memory->size() < info().total_size());
+
+    _memory = Memory(memory);
+    info().set_is_resizable(false);
+
+    return Status{};
+}
+
+std::shared_ptr<IMemoryRegion> TensorAllocator::shared_memory() const
+{
+    return (_associated_memory_group == nullptr) ? _memory.owned_region() : nullptr;
+}
+
 void TensorAllocator::set_associated_memory_group(MemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
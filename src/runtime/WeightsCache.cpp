@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
+namespace arm_compute
+{
+namespace
+{
+/** Blob files start with a header padded to a page, so that the mapped blob is page aligned */
+constexpr size_t   min_header_size = 4096;
+constexpr char     blob_magic[]    = "ACLWCACH";
+constexpr uint64_t fnv_offset      = 14695981039346656037ULL;
+constexpr uint64_t fnv_prime       = 1099511628211ULL;
+
+/** Returns the size of the header of the blob files
+ *
+ * The header is stored in the file, blobs written on a system with a different page size are therefore not loaded.
+ *
+ * @return The page size of the system, at least @ref min_header_size
+ */
+size_t header_size()
+{
+#ifndef BARE_METAL
+    const long page_size = sysconf(_SC_PAGESIZE);
+    return std::max(min_header_size, page_size > 0 ? static_cast<size_t>(page_size) : size_t(0));
+#else  /* BARE_METAL */
+    return min_header_size;
+#endif /* BARE_METAL */
+}
+
+uint64_t hash_bytes(uint64_t hash, const uint8_t *data, size_t size)
+{
+    // Hash 8 bytes at a time, the key is not required to be cryptographically strong
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        hash = (hash ^ word) * fnv_prime;
+    }
+    for(; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * fnv_prime;
+    }
+    return hash;
+}
+
+uint64_t hash_string(uint64_t hash, const std::string &str)
+{
+    return hash_bytes(hash, reinterpret_cast<const uint8_t *>(str.data()), str.size());
+}
+} // namespace
+
+WeightsCache::WeightsCache(std::string directory)
+    : _directory(std::move(directory)), _mappings(), _mtx()
+{
+}
+
+WeightsCache::~WeightsCache()
+{
+#ifndef BARE_METAL
+    for(auto &mapping : _mappings)
+    {
+        munmap(mapping.second.first, mapping.second.second);
+    }
+#endif /* BARE_METAL */
+}
+
+std::string WeightsCache::compute_key(const std::string &transform_id, const ITensor &weights, size_t transformed_size)
+{
+    const ITensorInfo *info = weights.info();
+
+    std::stringstream config;
+    config << transform_id << "_" << static_cast<int>(info->data_type()) << "_" << static_cast<int>(info->data_layout()) << "_" << transformed_size;
+    for(size_t d = 0; d < info->num_dimensions(); ++d)
+    {
+        config << "_" << info->dimension(d);
+    }
+
+    uint64_t hash = hash_string(fnv_offset, config.str());
+
+    // Hash the values row by row to skip the padding
+    const size_t row_size = info->dimension(0) * info->element_size();
+    Window       win;
+    win.use_tensor_dimensions(info->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator it(&weights, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        hash = hash_bytes(hash, it.ptr(), row_size);
+    },
+    it);
+
+    std::stringstream key;
+    key << std::hex << hash;
+    return key.str();
+}
+
+void *WeightsCache::load(const std::string &key, size_t size)
+{
+#ifndef BARE_METAL
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    const size_t header  = header_size();
+    auto         mapping = _mappings.find(key);
+    if(mapping != _mappings.end())
+    {
+        return (mapping->second.second == header + size) ? static_cast<uint8_t *>(mapping->second.first) + header : nullptr;
+    }
+
+    const int fd = open(filename(key).c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat st;
+    void       *addr = MAP_FAILED;
+    if(fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == header + size)
+    {
+        // Private writable mapping: the consumers never modify the weights but must not be able to alter the cache
+        addr = mmap(nullptr, header + size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+
+    if(addr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    uint64_t blob_size        = 0;
+    uint64_t blob_header_size = 0;
+    std::memcpy(&blob_size, static_cast<uint8_t *>(addr) + sizeof(blob_magic), sizeof(blob_size));
+    std::memcpy(&blob_header_size, static_cast<uint8_t *>(addr) + sizeof(blob_magic) + sizeof(blob_size), sizeof(blob_header_size));
+    if(std::memcmp(addr, blob_magic, sizeof(blob_magic)) != 0 || blob_size != size || blob_header_size != header)
+    {
+        munmap(addr, header + size);
+        return nullptr;
+    }
+
+    _mappings[key] = std::make_pair(addr, header + size);
+    return static_cast<uint8_t *>(addr) + header;
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(key, size);
+    return nullptr;
+#endif /* BARE_METAL */
+}
+
+void WeightsCache::store(const std::string &key, const void *data, size_t size)
+{
+#ifndef BARE_METAL
+    ARM_COMPUTE_ERROR_ON(data == nullptr);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Write to a temporary file first so that concurrent processes never map a partially written blob
+    const std::string path     = filename(key);
+    const std::string tmp_path = path + ".tmp" + support::cpp11::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if(!file.good())
+        {
+            return;
+        }
+
+        const uint64_t    blob_size        = size;
+        const uint64_t    blob_header_size = header_size();
+        std::vector<char> header(blob_header_size, 0);
+        std::memcpy(header.data(), blob_magic, sizeof(blob_magic));
+        std::memcpy(header.data() + sizeof(blob_magic), &blob_size, sizeof(blob_size));
+        std::memcpy(header.data() + sizeof(blob_magic) + sizeof(blob_size), &blob_header_size, sizeof(blob_header_size));
+
+        file.write(header.data(), header.size());
+        file.write(static_cast<const char *>(data), size);
+        if(!file.good())
+        {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    if(std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+    }
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(key, data, size);
+#endif /* BARE_METAL */
+}
+
+std::string WeightsCache::filename(const std::string &key) const
+{
+    return _directory + "/" + key + ".bin";
+}
+} // namespace arm_compute
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace arm_compute
+{
+WeightsManager::WeightsManager()
+    : _managed_weights(), _managed_weights_parents(), _shared_weights(), _weights_cache(), _mtx()
+{
+}
+
+WeightsManager::~WeightsManager()
+{
+    // The transforms outliving the manager must not unregister from it
+    for(auto &managed_weights : _managed_weights)
+    {
+        for(auto *weights_transform : managed_weights.second)
+        {
+            weights_transform->set_weights_manager(nullptr);
+        }
+    }
+}
+
+void WeightsManager::set_weights_cache(std::shared_ptr<WeightsCache> cache)
+{
+    _weights_cache = std::move(cache);
+}
+
+WeightsCache *WeightsManager::weights_cache()
+{
+    return _weights_cache.get();
+}
+
+void WeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    manage_locked(weights, parent);
+}
+
+ITensor *WeightsManager::acquire(const ITensor *weights, ITransformWeights *weights_transform)
+{
+    ARM_COMPUTE_ERROR_ON(weights_transform == nullptr);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_managed_weights.find(weights) == std::end(_managed_weights), "Cannot acquire weights. Weights are not managed");
+
+    register_transform_locked(weights, weights_transform);
+    weights_transform->increase_refcount();
+
+    // Manage the transformed weights and store the link to the transform which produces them
+    ITensor *transformed_weights = weights_transform->get_weights();
+    manage_locked(transformed_weights, weights_transform);
+
+    return transformed_weights;
+}
+
+ITensor *WeightsManager::run(const ITensor *weights, ITransformWeights *weights_transform)
+{
+    ARM_COMPUTE_ERROR_ON(weights_transform == nullptr);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_managed_weights.find(weights) == std::end(_managed_weights), "Cannot run transform. Weights are not managed");
+
+    // Register the transform if it has not been acquired
+    register_transform_locked(weights, weights_transform);
+
+    // Run the transform only if no equivalent transform of the same weights content is still alive
+    if(!weights_transform->is_reshape_run())
+    {
+        const std::string              key    = weights_transform->content_key(*weights);
+        std::shared_ptr<IMemoryRegion> shared = _shared_weights[key].lock();
+        if(shared != nullptr)
+        {
+            weights_transform->import_weights(shared);
+        }
+        else
+        {
+            weights_transform->run();
+            _shared_weights[key] = weights_transform->shared_weights();
+        }
+        ARM_COMPUTE_ERROR_ON(!weights_transform->is_reshape_run());
+    }
+
+    // Release the intermediate weights once all the functions consuming them have been prepared
+    auto parent = _managed_weights_parents.find(weights);
+    if(parent != std::end(_managed_weights_parents) && parent->second->decrease_refcount() == 0)
+    {
+        parent->second->release();
+    }
+
+    return weights_transform->get_weights();
+}
+
+bool WeightsManager::are_weights_managed(const ITensor *weights)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _managed_weights.find(weights) != std::end(_managed_weights);
+}
+
+void WeightsManager::unregister_transform(ITransformWeights *weights_transform)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Forget the tensors produced by the transform, which are destroyed with it
+    for(auto parent = _managed_weights_parents.begin(); parent != _managed_weights_parents.end();)
+    {
+        if(parent->second == weights_transform)
+        {
+            _managed_weights.erase(parent->first);
+            parent = _managed_weights_parents.erase(parent);
+        }
+        else
+        {
+            ++parent;
+        }
+    }
+
+    // Remove the transform, and the weights which are no longer transformed, so that their addresses can be reused
+    for(auto managed_weights = _managed_weights.begin(); managed_weights != _managed_weights.end();)
+    {
+        auto &transforms = managed_weights->second;
+        auto  removed    = std::remove(transforms.begin(), transforms.end(), weights_transform);
+        if(removed == transforms.end())
+        {
+            ++managed_weights;
+            continue;
+        }
+        transforms.erase(removed, transforms.end());
+        if(transforms.empty() && _managed_weights_parents.find(managed_weights->first) == std::end(_managed_weights_parents))
+        {
+            managed_weights = _managed_weights.erase(managed_weights);
+        }
+        else
+        {
+            ++managed_weights;
+        }
+    }
+
+    // Drop the keys of the transformed weights no longer alive
+    for(auto shared_weights = _shared_weights.begin(); shared_weights != _shared_weights.end();)
+    {
+        shared_weights = shared_weights->second.expired() ? _shared_weights.erase(shared_weights) : std::next(shared_weights);
+    }
+}
+
+size_t WeightsManager::footprint()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Transformed weights sharing their memory are counted once, and the ones released once consumed by the next
+    // transform of a chain are not counted
+    std::map<const uint8_t *, size_t> transformed_weights;
+    for(auto &managed_weights : _managed_weights)
+    {
+        for(auto *weights_transform : managed_weights.second)
+        {
+            const ITensor *weights = weights_transform->get_weights();
+            if(weights != nullptr && !weights->info()->is_resizable() && weights->buffer() != nullptr)
+            {
+                transformed_weights[weights->buffer()] = weights->info()->total_size();
+            }
+        }
+    }
+
+    size_t total_size = 0;
+    for(auto &weights : transformed_weights)
+    {
+        total_size += weights.second;
+    }
+    return total_size;
+}
+
+void WeightsManager::manage_locked(const ITensor *weights, ITransformWeights *parent)
+{
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+
+    // Inserts an empty list of transforms if the weights are not yet managed
+    _managed_weights[weights];
+
+    if(parent != nullptr)
+    {
+        _managed_weights_parents[weights] = parent;
+    }
+}
+
+void WeightsManager::register_transform_locked(const ITensor *weights, ITransformWeights *weights_transform)
+{
+    auto &transforms = _managed_weights[weights];
+    if(std::find(transforms.begin(), transforms.end(), weights_transform) == transforms.end())
+    {
+        transforms.emplace_back(weights_transform);
+        weights_transform->set_weights_manager(this);
+    }
+}
+} // namespace arm_compute
@@ -169,6 +169,21 @@ public:
     }
 };
 
+/** LSTM configurations whose number of cells is not a multiple of the vector length, with and without CIFG and clipping */
+class SmallLSTMLayerOddCellsDataset final : public LSTMLayerDataset
+{
+public:
+    SmallLSTMLayerOddCellsDataset()
+    {
+        add_config(TensorShape(8U, 3U), TensorShape(8U, 13U), TensorShape(13U, 13U), TensorShape(13U), TensorShape(13U, 3U), TensorShape(13U, 3U), TensorShape(52U, 3U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f), 0.f, 0.f);
+        add_config(TensorShape(8U, 3U), TensorShape(8U, 13U), TensorShape(13U, 13U), TensorShape(13U), TensorShape(13U, 3U), TensorShape(13U, 3U), TensorShape(39U, 3U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC), 0.5f, 0.1f);
+        add_config(TensorShape(5U), TensorShape(5U, 21U), TensorShape(21U, 21U), TensorShape(21U), TensorShape(21U), TensorShape(21U), TensorShape(84U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f), 1.f, 0.f);
+    }
+};
+
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
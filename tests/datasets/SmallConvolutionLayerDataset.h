@@ -89,6 +89,9 @@ public:
     {
         add_config(TensorShape(8U, 8U, 2U), TensorShape(5U, 5U, 2U, 1U), TensorShape(1U), TensorShape(4U, 4U, 1U), PadStrideInfo(1, 1, 0, 0));
         add_config(TensorShape(8U, 8U, 2U), TensorShape(5U, 5U, 2U), TensorShape(1U), TensorShape(8U, 8U, 1U), PadStrideInfo(1, 1, 2, 2));
+        // Inputs larger than 8x8 use F(4x4, 5x5) when available
+        add_config(TensorShape(13U, 11U, 3U), TensorShape(5U, 5U, 3U, 2U), TensorShape(2U), TensorShape(9U, 7U, 2U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(14U, 10U, 2U), TensorShape(5U, 5U, 2U, 3U), TensorShape(3U), TensorShape(14U, 10U, 3U), PadStrideInfo(1, 1, 2, 2));
     }
 };
 
@@ -22,6 +22,10 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
@@ -81,38 +85,68 @@ TEST_SUITE(ConvolutionLayer)
 
 // *INDENT-OFF*
 // clang-format off
-DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
                                           framework::dataset::make("InputInfo", { TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(23U, 27U, 32U, 4U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(3U, 3U, 2U, 1U), 1, DataType::F32),
-                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32)
+                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(7U, 17U, 17U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(32U, 16U, 16U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(32U, 16U, 16U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(32U, 18U, 18U), 1, DataType::F32)
                                           }),
                                           framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(5U, 5U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(3U, 3U, 5U, 21U), 1, DataType::F32),
-                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16)
+                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16),
+                                                                                    TensorInfo(TensorShape(7U, 3U, 3U, 16U), 1, DataType::F32),
+                                                                                    TensorInfo(TensorShape(32U, 1U, 1U, 24U), 1, DataType::F32),
+                                                                                    TensorInfo(TensorShape(32U, 1U, 1U, 24U), 1, DataType::F32),
+                                                                                    TensorInfo(TensorShape(32U, 3U, 3U, 21U), 1, DataType::F32)
                                           })),
                                           framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(19U, 23U, 21U, 4U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(11U, 25U, 21U), 1, DataType::F32),
-                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32)
+                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(16U, 15U, 15U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(24U, 8U, 8U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(24U, 16U, 16U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(21U, 16U, 16U), 1, DataType::F32)
                                           })),
                                           framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(2, 1, 0, 0),
-                                                                                 PadStrideInfo(3, 2, 1, 0)
+                                                                                 PadStrideInfo(3, 2, 1, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0),
+                                                                                 PadStrideInfo(2, 2, 0, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0)
+                                          })),
+                                          framework::dataset::make("DataLayout", { DataLayout::NCHW,
+                                                                                   DataLayout::NCHW,
+                                                                                   DataLayout::NCHW,
+                                                                                   DataLayout::NCHW,
+                                                                                   DataLayout::NHWC,
+                                                                                   DataLayout::NHWC,
+                                                                                   DataLayout::NHWC,
+                                                                                   DataLayout::NHWC
                                           })),
                                           framework::dataset::make("FastMath", { true,
                                                                                  true,
                                                                                  false,
-                                                                                 false
+                                                                                 false,
+                                                                                 false,
+                                                                                 false,
+                                                                                 false,
+                                                                                 true
                                           })),
-                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM })),
-               input_info, weights_info, output_info, conv_info, fast_math, expected)
+                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM,
+                                                                                                                  ConvolutionMethod::DIRECT, ConvolutionMethod::DIRECT, ConvolutionMethod::GEMM, ConvolutionMethod::WINOGRAD })),
+               input_info, weights_info, output_info, conv_info, data_layout, fast_math, expected)
 {
-    ConvolutionMethod is_valid = NEConvolutionLayer::get_convolution_method(&input_info.clone()->set_is_resizable(true),
-                                                                            &weights_info.clone()->set_is_resizable(true),
-                                                                            &output_info.clone()->set_is_resizable(true), conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), fast_math);
+    ConvolutionMethod is_valid = NEConvolutionLayer::get_convolution_method(&input_info.clone()->set_is_resizable(true).set_data_layout(data_layout),
+                                                                            &weights_info.clone()->set_is_resizable(true).set_data_layout(data_layout),
+                                                                            &output_info.clone()->set_is_resizable(true).set_data_layout(data_layout), conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), fast_math);
     ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
 }
 // clang-format on
@@ -282,6 +316,58 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFixture<float>, frame
     // floating point arithmetic the Winograd results will not be exactly the same as direct convolution, especially for big shapes
     validate(Accessor(_target), _reference, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
 }
+
+TEST_CASE(Streaming, framework::DatasetMode::PRECOMMIT)
+{
+    const TensorShape   input_shape(48U, 40U, 16U);
+    const TensorShape   weights_shape(3U, 3U, 16U, 24U);
+    const TensorShape   bias_shape(24U);
+    const TensorShape   output_shape(48U, 40U, 24U);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    Tensor src     = create_tensor<Tensor>(input_shape, DataType::F32);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor bias    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(output_shape, DataType::F32);
+
+    // Stream the tiles even though the transformed tensors are small
+    NEWinogradConvolutionLayer conv;
+    conv.set_force_streaming(true);
+    conv.configure(&src, &weights, &bias, &dst, conv_info);
+
+    for(auto *tensor : { &src, &weights, &bias, &dst })
+    {
+        tensor->allocator()->allocate();
+    }
+
+    std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+    library->fill(Accessor(src), distribution, 0);
+    library->fill(Accessor(weights), distribution, 1);
+    library->fill(Accessor(bias), distribution, 2);
+
+    SimpleTensor<float> ref_src{ input_shape, DataType::F32 };
+    SimpleTensor<float> ref_weights{ weights_shape, DataType::F32 };
+    SimpleTensor<float> ref_bias{ bias_shape, DataType::F32 };
+    library->fill(ref_src, distribution, 0);
+    library->fill(ref_weights, distribution, 1);
+    library->fill(ref_bias, distribution, 2);
+    const SimpleTensor<float> ref_dst = reference::convolution_layer<float>(ref_src, ref_weights, ref_bias, output_shape, conv_info);
+
+    conv.run();
+    validate(Accessor(dst), ref_dst, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // The bands are never split between more threads than the function has been configured for
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(NEScheduler::get().num_threads() + 2);
+    library->fill_tensor_value(Accessor(dst), 0.f);
+
+    IScheduler *previous_scheduler = Scheduler::set_thread_local(&scheduler);
+    conv.run();
+    Scheduler::set_thread_local(previous_scheduler);
+    validate(Accessor(dst), ref_dst, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
 TEST_SUITE_END() // Conv3x3
 
 TEST_SUITE(Conv5x5)
@@ -321,6 +407,60 @@ FIXTURE_DATA_TEST_CASE(RunSmallNoBias, NEWinogradConvolutionLayerNoBiasFixture<f
 }
 
 TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+using NEWinogradConvolutionLayerFixture16 = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, half, float>;
+using NEWinogradConvolutionLayerNoFastMathFixture16 = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, half, float, true, false>;
+
+TEST_SUITE(FP16)
+TEST_SUITE(Conv3x3)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFixture16, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFixture16, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+// Without fast math, inputs larger than 4x4 fall back to F(2x2, 3x3)
+FIXTURE_DATA_TEST_CASE(RunSmallNoFastMath, NEWinogradConvolutionLayerNoFastMathFixture16, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // Conv3x3
+
+TEST_SUITE(Conv5x5)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFixture16, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer5x5Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F16 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // Conv5x5
+TEST_SUITE_END() // FP16
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 TEST_SUITE_END() // WinogradLayer
 
 TEST_SUITE(GEMMConvolutionLayer)
@@ -85,6 +85,15 @@ const auto data = combine(datasets::SmallDirectConvolutionShapes(),
                                                   combine(framework::dataset::make("PadY", { 1 }),
                                                           framework::dataset::make("KernelSize", 3))))));
 
+/** Direct convolution data set for NHWC: few input feature maps, large or strided kernels crossing the padding */
+const auto data_nhwc = combine(framework::dataset::make("InputShape", { TensorShape(27U, 13U, 3U), TensorShape(9U, 7U, 6U, 2U) }),
+                               combine(framework::dataset::make("StrideX", { 1, 2 }),
+                                       combine(framework::dataset::make("StrideY", { 1, 3 }),
+                                               combine(framework::dataset::make("PadX", { 0, 3 }),
+                                                       combine(framework::dataset::make("PadY", { 1 }),
+                                                               combine(framework::dataset::make("KernelSize", { 1, 7 }),
+                                                                       framework::dataset::make("NumKernels", { 5 })))))));
+
 const auto data_f32_nightly = combine(data_f32, framework::dataset::make("NumKernels", { 1, 4 }));
 const auto data_f16_nightly = combine(data_f16, framework::dataset::make("NumKernels", { 1, 4 }));
 
@@ -176,7 +185,7 @@ TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_precommit, framework::dataset::make("DataType",
                                                                                                                    DataType::F16)),
                                                                                                                    ActivationFunctionsDataset),
-                                                                                                                   framework::dataset::make("DataLayout", DataLayout::NCHW)))
+                                                                                                                   framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
 {
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
@@ -200,6 +209,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolutionLayerFixture<float>, framewo
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallNHWC, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_nhwc, framework::dataset::make("DataType",
+                                                                                                                        DataType::F32)),
+                                                                                                                        ActivationFunctionsDataset),
+                                                                                                                        framework::dataset::make("DataLayout", DataLayout::NHWC)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(data_f32_nightly, framework::dataset::make("DataType",
                                                                                                                   DataType::F32)),
                                                                                                                   ActivationFunctionsDataset),
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/NEON/functions/NEFFT2D.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WeightsManager.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/datasets/SmallConvolutionLayerDataset.h"
 #include "tests/framework/Asserts.h"
@@ -49,14 +50,15 @@ const auto shapes_1d  = framework::dataset::make("TensorShape", { TensorShape(2U
                                                                   TensorShape(9U, 2U, 3U), TensorShape(25U, 2U, 3U),
                                                                   TensorShape(49U, 2U, 3U), TensorShape(64U, 2U, 3U),
                                                                   TensorShape(16U, 2U, 3U), TensorShape(32U, 2U, 3U),
-                                                                  TensorShape(96U, 2U, 2U)
+                                                                  TensorShape(96U, 2U, 2U), TensorShape(11U, 2U, 3U),
+                                                                  TensorShape(13U, 2U, 3U), TensorShape(66U, 2U, 2U)
                                                                 });
 
 const auto shapes_2d = framework::dataset::make("TensorShape", { TensorShape(2U, 2U, 3U), TensorShape(3U, 6U, 3U),
                                                                  TensorShape(4U, 5U, 3U), TensorShape(5U, 7U, 3U),
                                                                  TensorShape(7U, 25U, 3U), TensorShape(8U, 2U, 3U),
                                                                  TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U),
-                                                                 TensorShape(192U, 128U, 2U)
+                                                                 TensorShape(192U, 128U, 2U), TensorShape(11U, 26U, 3U)
                                                                });
 
 const auto ActivationFunctionsSmallDataset = framework::dataset::make("ActivationInfo",
@@ -68,6 +70,46 @@ const auto ActivationFunctionsSmallDataset = framework::dataset::make("Activatio
 RelativeTolerance<float> tolerance_f32(0.1f);   /**< Relative tolerance value for FP32 */
 constexpr float          tolerance_num = 0.07f; /**< Tolerance number */
 
+/** Transforms a real tensor to its half spectrum and back, and validates both results
+ *
+ * @param[in] shape               Shape of the real tensor. Its width must be even.
+ * @param[in] reference_transform Reference transform of a real tensor to its half spectrum
+ */
+template <typename FFTType, typename FFTInfoType>
+void validate_half_spectrum(const TensorShape &shape, SimpleTensor<float> (*reference_transform)(const SimpleTensor<float> &))
+{
+    TensorShape spectrum_shape = shape;
+    spectrum_shape.set(0, shape[0] / 2 + 1);
+
+    Tensor src      = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor spectrum = create_tensor<Tensor>(spectrum_shape, DataType::F32, 2);
+    Tensor dst      = create_tensor<Tensor>(shape, DataType::F32);
+
+    FFTInfoType inverse_info;
+    inverse_info.direction = FFTDirection::Inverse;
+
+    FFTType forward;
+    FFTType inverse;
+    forward.configure(&src, &spectrum, FFTInfoType());
+    inverse.configure(&spectrum, &dst, inverse_info);
+
+    src.allocator()->allocate();
+    spectrum.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::uniform_real_distribution<> distribution(-5.0f, 5.0f);
+    library->fill(Accessor(src), distribution, 0);
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill(ref_src, distribution, 0);
+
+    // Validate the half spectrum, then the real tensor transformed back from it
+    forward.run();
+    validate(Accessor(spectrum), reference_transform(ref_src), tolerance_f32, tolerance_num);
+    inverse.run();
+    validate(Accessor(dst), ref_src, tolerance_f32, tolerance_num);
+}
+
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(FFT1D)
@@ -103,7 +145,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 3, DataType::F32), // Invalid channels
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
-                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Generic radix stage
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
@@ -114,7 +156,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         })),
         framework::dataset::make("Axis", { 0, 0, 0, 2, 0, 0 })),
-        framework::dataset::make("Expected", { false, false, false, false, false, true })),
+        framework::dataset::make("Expected", { false, false, false, false, true, true })),
         input_info, output_info, axis, expected)
 {
     FFT1DInfo desc;
@@ -135,6 +177,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT1DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+
+TEST_CASE(RunHalfSpectrum, framework::DatasetMode::ALL)
+{
+    for(const auto &shape : { TensorShape(64U, 2U, 3U), TensorShape(50U, 3U), TensorShape(18U, 5U) })
+    {
+        validate_half_spectrum<NEFFT1D, FFT1DInfo>(shape, &reference::rdft_1d<float>);
+    }
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
@@ -171,16 +221,22 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
         framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching data types
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 3, DataType::F32), // Invalid channels
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Generic radix stage
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32), // Half spectrum
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32), // Half spectrum to real
+                                                TensorInfo(TensorShape(31U, 25U, 2U), 1, DataType::F32), // Odd width half spectrum
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 25U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 25U, 2U), 2, DataType::F32),
         })),
-        framework::dataset::make("Expected", { false, false, false, false, true })),
+        framework::dataset::make("Expected", { false, false, false, true, true, true, true, false })),
                input_info, output_info, expected)
 {
     const Status s = NEFFT2D::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), FFT2DInfo());
@@ -199,6 +255,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT2DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+
+TEST_CASE(RunHalfSpectrum, framework::DatasetMode::ALL)
+{
+    for(const auto &shape : { TensorShape(32U, 16U, 2U), TensorShape(18U, 10U) })
+    {
+        validate_half_spectrum<NEFFT2D, FFT2DInfo>(shape, &reference::rdft_2d<float>);
+    }
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
@@ -218,6 +282,72 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFTConvolutionLayerFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+
+TEST_CASE(SharedWeights, framework::DatasetMode::ALL)
+{
+    const TensorShape   input_shape(64U, 32U, 5U);
+    const TensorShape   weights_shape(5U, 5U, 5U, 10U);
+    const TensorShape   bias_shape(10U);
+    const TensorShape   output_shape(64U, 32U, 10U);
+    const PadStrideInfo conv_info(1, 1, 2, 2);
+
+    std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+
+    Tensor weights        = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor bias           = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor src[2]         = { create_tensor<Tensor>(input_shape, DataType::F32), create_tensor<Tensor>(input_shape, DataType::F32) };
+    Tensor dst[2]         = { create_tensor<Tensor>(output_shape, DataType::F32), create_tensor<Tensor>(output_shape, DataType::F32) };
+    Tensor single_weights = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor single_bias    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor single_dst     = create_tensor<Tensor>(output_shape, DataType::F32);
+
+    // Two functions sharing the frequency domain weights, and a function transforming a copy of them on its own to measure their size
+    WeightsManager        weights_manager;
+    WeightsManager        single_weights_manager;
+    NEFFTConvolutionLayer conv0(nullptr, &weights_manager);
+    NEFFTConvolutionLayer conv1(nullptr, &weights_manager);
+    NEFFTConvolutionLayer single_conv(nullptr, &single_weights_manager);
+    conv0.configure(&src[0], &weights, &bias, &dst[0], conv_info);
+    conv1.configure(&src[1], &weights, &bias, &dst[1], conv_info);
+    single_conv.configure(&src[0], &single_weights, &single_bias, &single_dst, conv_info);
+
+    for(auto *tensor : { &weights, &bias, &src[0], &src[1], &dst[0], &dst[1], &single_weights, &single_bias, &single_dst })
+    {
+        tensor->allocator()->allocate();
+    }
+
+    library->fill(Accessor(weights), distribution, 1);
+    library->fill(Accessor(bias), distribution, 2);
+    library->fill(Accessor(single_weights), distribution, 1);
+    library->fill(Accessor(single_bias), distribution, 2);
+    library->fill(Accessor(src[0]), distribution, 0);
+    library->fill(Accessor(src[1]), distribution, 3);
+
+    conv0.run();
+    conv1.run();
+    single_conv.run();
+
+    // Both functions use the same transformed weights
+    ARM_COMPUTE_EXPECT(single_weights_manager.footprint() != 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(weights_manager.footprint() == single_weights_manager.footprint(), framework::LogLevel::ERRORS);
+
+    // Validate the output of all the functions
+    SimpleTensor<float> ref_weights{ weights_shape, DataType::F32 };
+    SimpleTensor<float> ref_bias{ bias_shape, DataType::F32 };
+    library->fill(ref_weights, distribution, 1);
+    library->fill(ref_bias, distribution, 2);
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        SimpleTensor<float> ref_src{ input_shape, DataType::F32 };
+        library->fill(ref_src, distribution, i == 0 ? 0 : 3);
+        const SimpleTensor<float> ref_dst = reference::convolution_layer<float>(ref_src, ref_weights, ref_bias, output_shape, conv_info);
+        validate(Accessor(dst[i]), ref_dst, tolerance_f32, tolerance_num);
+        if(i == 0)
+        {
+            validate(Accessor(single_dst), ref_dst, tolerance_f32, tolerance_num);
+        }
+    }
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFTConvolutionLayer
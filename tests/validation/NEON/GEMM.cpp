@@ -22,8 +22,10 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -40,6 +42,7 @@
 #include "tests/validation/fixtures/GEMMFixture.h"
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
+#include "tests/validation/reference/GEMM.h"
 
 namespace arm_compute
 {
@@ -67,6 +70,70 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 const auto data_interleave = framework::dataset::make("M", 8, 12) * framework::dataset::make("N", 8, 12);
 const auto data_transpose  = framework::dataset::make("M", 8, 14) * framework::dataset::make("N", 7, 14);
 
+/** Few rows and many columns so that the multi-threaded matrix multiplication splits the output along X */
+const auto data_matrix_multiply_split_x = framework::dataset::make("M", { 1, 4, 5 }) * framework::dataset::make("N", { 16, 37, 64 }) * framework::dataset::make("K", { 3, 19 });
+
+/** Run the matrix multiply kernel on reshaped matrices one sub-window along X at a time
+ *
+ * @param[in]  m          Number of rows of the output matrix
+ * @param[in]  n          Number of columns of the output matrix
+ * @param[in]  k          Number of columns of matrix A
+ * @param[in]  data_type  Data type of the matrices
+ * @param[in]  num_splits Number of sub-windows along X
+ * @param[out] dst        Output matrix
+ *
+ * @return The reference output matrix
+ */
+template <typename T>
+SimpleTensor<T> run_matrix_multiply_split_along_x(int m, int n, int k, DataType data_type, unsigned int num_splits, Tensor &dst)
+{
+    const unsigned int transpose_w = 16 / data_size_from_type(data_type);
+
+    Tensor a     = create_tensor<Tensor>(TensorShape(k, m), data_type);
+    Tensor b     = create_tensor<Tensor>(TensorShape(n, k), data_type);
+    Tensor tmp_a = create_tensor<Tensor>(TensorShape(k * 4, static_cast<int>(std::ceil(m / 4.0f))), data_type);
+    Tensor tmp_b = create_tensor<Tensor>(TensorShape(k * transpose_w, static_cast<int>(std::ceil(n / static_cast<float>(transpose_w)))), data_type);
+    dst          = create_tensor<Tensor>(TensorShape(n, m), data_type);
+
+    NEGEMMInterleave4x4Kernel  interleave;
+    NEGEMMTranspose1xWKernel   transpose;
+    NEGEMMMatrixMultiplyKernel mm;
+    interleave.configure(&a, &tmp_a);
+    transpose.configure(&b, &tmp_b);
+    mm.configure(&tmp_a, &tmp_b, &dst, 1.f, true, GEMMReshapeInfo(m, n, k));
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    tmp_a.allocator()->allocate();
+    tmp_b.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    ThreadInfo info;
+    info.cpu_info = &NEScheduler::get().cpu_info();
+    interleave.run(interleave.window(), info);
+    transpose.run(transpose.window(), info);
+
+    // Make sure the output is actually split along X
+    const Window &window = mm.window();
+    ARM_COMPUTE_EXPECT(window.num_iterations(Window::DimX) >= num_splits, framework::LogLevel::ERRORS);
+    for(unsigned int id = 0; id < num_splits; ++id)
+    {
+        mm.run(window.split_window(Window::DimX, id, num_splits), info);
+    }
+
+    SimpleTensor<T> ref_a{ a.info()->tensor_shape(), data_type };
+    SimpleTensor<T> ref_b{ b.info()->tensor_shape(), data_type };
+    SimpleTensor<T> ref_c{ dst.info()->tensor_shape(), data_type };
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+
+    return reference::gemm<T>(ref_a, ref_b, ref_c, 1.f, 0.f);
+}
+
 } // namespace
 
 TEST_SUITE(NEON)
@@ -99,6 +166,30 @@ TEST_SUITE_END() // FP32
 
 TEST_SUITE_END() // INTERLEAVE_4X4
 
+TEST_SUITE(MATRIX_MULTIPLY)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+DATA_TEST_CASE(SplitAlongX, framework::DatasetMode::ALL, data_matrix_multiply_split_x, m, n, k)
+{
+    Tensor                   target;
+    const SimpleTensor<half> reference = run_matrix_multiply_split_along_x<half>(m, n, k, DataType::F16, 2, target);
+
+    validate(Accessor(target), reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+DATA_TEST_CASE(SplitAlongX, framework::DatasetMode::ALL, data_matrix_multiply_split_x, m, n, k)
+{
+    Tensor                    target;
+    const SimpleTensor<float> reference = run_matrix_multiply_split_along_x<float>(m, n, k, DataType::F32, 2, target);
+
+    validate(Accessor(target), reference, tolerance_f);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // MATRIX_MULTIPLY
+
 //TODO(COMPMID-415): Validate valid region
 
 template <typename T>
@@ -41,6 +41,7 @@ namespace
 {
 RelativeTolerance<float> tolerance_f32(0.00001f);
 RelativeTolerance<half>  tolerance_f16(half(0.1));
+constexpr float          abs_tolerance_f32 = 0.00001f; /**< Absolute tolerance for the values close to 0 of the TANH and LOGISTIC cell activations */
 } // namespace
 
 TEST_SUITE(NEON)
@@ -162,6 +163,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMLayerFixture<float>, framework::DatasetMo
     validate(Accessor(_target), _reference, tolerance_f32);
     validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunOddCells, NELSTMLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallLSTMLayerOddCellsDataset(), framework::dataset::make("DataType",
+                                                                                                                          DataType::F32)),
+                                                                                                                  framework::dataset::make("ProjectionOpt", { true, false })),
+                                                                                                          framework::dataset::make("PeepholeOpt", { true, false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+    validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32, 0.f, abs_tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -174,6 +184,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NELSTMLayerFixture<half>, framework::DatasetMod
     validate(Accessor(_target), _reference, tolerance_f16);
     validate(Accessor(_target_scratch), _reference_scratch, tolerance_f16);
 }
+FIXTURE_DATA_TEST_CASE(RunOddCells, NELSTMLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallLSTMLayerOddCellsDataset(), framework::dataset::make("DataType",
+                                                                                                                         DataType::F16)),
+                                                                                                                 framework::dataset::make("ProjectionOpt", { true, false })),
+                                                                                                         framework::dataset::make("PeepholeOpt", { true, false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+    validate(Accessor(_target_scratch), _reference_scratch, tolerance_f16);
+}
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 TEST_SUITE_END() // LSTMLayer
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/NEON/NEConvolutionTuner.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ConvolutionTuner)
+
+TEST_CASE(MethodTable, framework::DatasetMode::ALL)
+{
+    const std::string   filename = "acl_neon_tuner_test.csv";
+    const TensorInfo    input(TensorShape(8U, 8U, 4U), 1, DataType::F32);
+    const TensorInfo    weights(TensorShape(3U, 3U, 4U, 4U), 1, DataType::F32);
+    const TensorInfo    output(TensorShape(6U, 6U, 4U), 1, DataType::F32);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+    ConvolutionMethod   method = ConvolutionMethod::GEMM;
+
+    // Nothing is tuned or found while tuning of new configurations is disabled
+    NEConvolutionTuner tuner(false, 1);
+    tuner.tune_convolution_method(&input, &weights, &output, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false);
+    ARM_COMPUTE_EXPECT(tuner.method_table().empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!tuner.find_convolution_method(&input, &weights, &output, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false, method), framework::LogLevel::ERRORS);
+
+    // Store the fastest method of the configuration
+    tuner.set_tune_new_configurations(true);
+    tuner.tune_convolution_method(&input, &weights, &output, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false);
+    const auto table = tuner.method_table();
+    ARM_COMPUTE_EXPECT(table.size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.find_convolution_method(&input, &weights, &output, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false, method), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.empty() && method == table.begin()->second, framework::LogLevel::ERRORS);
+
+    // Other configurations are not found
+    const TensorInfo other_output(TensorShape(8U, 8U, 4U), 1, DataType::F32);
+    ARM_COMPUTE_EXPECT(!tuner.find_convolution_method(&input, &weights, &other_output, PadStrideInfo(1, 1, 1, 1), Size2D(1U, 1U), ActivationLayerInfo(), false, method),
+                       framework::LogLevel::ERRORS);
+
+    // Load the table saved to file
+    tuner.save_to_file(filename);
+    NEConvolutionTuner loaded_tuner(false);
+    loaded_tuner.load_from_file(filename);
+    ARM_COMPUTE_EXPECT(loaded_tuner.method_table() == table, framework::LogLevel::ERRORS);
+
+    // Load a method written by hand
+    if(!table.empty())
+    {
+        {
+            std::ofstream fs(filename, std::ios::out);
+            fs << table.begin()->first << ";FFT" << std::endl;
+        }
+        NEConvolutionTuner edited_tuner(false);
+        edited_tuner.load_from_file(filename);
+        ARM_COMPUTE_EXPECT(edited_tuner.find_convolution_method(&input, &weights, &output, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false, method), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(method == ConvolutionMethod::FFT, framework::LogLevel::ERRORS);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BARE_METAL
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "utils/GraphUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Accessor copying the values of an output of a graph, and requesting to stop after the first execution */
+class OutputValuesAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values Values of the output
+     */
+    OutputValuesAccessor(std::vector<float> &values)
+        : _values(values)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        _values.clear();
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            _values.push_back(*reinterpret_cast<float *>(tensor.ptr_to_element(id)));
+        });
+        return false;
+    }
+
+private:
+    std::vector<float> &_values;
+};
+
+/** Builds a small NEON graph made of two branches of different lengths merged by a depth concatenation
+ *
+ * @param[in, out] g      Graph to build
+ * @param[out]     output Values of the output of the graph, filled on each execution
+ */
+void build_branching_graph(graph::Graph &g, std::vector<float> &output)
+{
+    using namespace arm_compute::graph;
+
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    const NodeID input = GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(16U, 16U, 8U), DataType::F32),
+                                                      graph_utils::get_random_accessor(-1.f, 1.f, 0));
+
+    // Long branch
+    NodeID left = GraphBuilder::add_convolution_node(g, { "left_conv0", Target::NEON }, { input, 0 }, Size2D(3U, 3U), 16U, conv_info, 1,
+                                                     graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+                                                     graph_utils::get_random_accessor(-1.f, 1.f, 1), graph_utils::get_random_accessor(-1.f, 1.f, 2));
+    left = GraphBuilder::add_activation_node(g, { "left_relu0", Target::NEON }, { left, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    left = GraphBuilder::add_convolution_node(g, { "left_conv1", Target::NEON }, { left, 0 }, Size2D(3U, 3U), 16U, conv_info, 1,
+                                              graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+                                              graph_utils::get_random_accessor(-1.f, 1.f, 3), graph_utils::get_random_accessor(-1.f, 1.f, 4));
+
+    // Short branch
+    const NodeID right = GraphBuilder::add_convolution_node(g, { "right_conv0", Target::NEON }, { input, 0 }, Size2D(1U, 1U), 8U, PadStrideInfo(), 1,
+                                                            graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+                                                            graph_utils::get_random_accessor(-1.f, 1.f, 5), graph_utils::get_random_accessor(-1.f, 1.f, 6));
+
+    const NodeID concat = GraphBuilder::add_concatenate_node(g, { "concat", Target::NEON }, { { left, 0 }, { right, 0 } },
+                                                             descriptors::ConcatLayerDescriptor(DataLayoutDimension::CHANNEL));
+    const NodeID merge = GraphBuilder::add_convolution_node(g, { "merge_conv", Target::NEON }, { concat, 0 }, Size2D(1U, 1U), 4U, PadStrideInfo(), 1,
+                                                            graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+                                                            graph_utils::get_random_accessor(-1.f, 1.f, 7), graph_utils::get_random_accessor(-1.f, 1.f, 8));
+
+    GraphBuilder::add_output_node(g, { "output", Target::NEON }, { merge, 0 }, support::cpp14::make_unique<OutputValuesAccessor>(output));
+}
+
+/** Builds, finalizes and executes once the graph of @ref build_branching_graph
+ *
+ * @param[in] config Graph configuration to use
+ *
+ * @return The values of the output of the graph
+ */
+std::vector<float> run_branching_graph(const graph::GraphConfig &config)
+{
+    std::vector<float> output;
+
+    graph::GraphContext ctx;
+    graph::GraphManager manager;
+    graph::Graph        g(0, "branching_graph");
+    build_branching_graph(g, output);
+
+    graph::PassManager pm = graph::create_default_pass_manager(graph::Target::NEON);
+    ctx.set_config(config);
+    manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+    manager.execute_graph(g);
+
+    return output;
+}
+
+/** Accessor filling an input of a graph with the index of the execution, for a given number of executions
+ *
+ * Records whether every call was made with the single threaded scheduler as scheduler of the calling thread.
+ */
+class FrameInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in]  num_frames      Number of executions to fill the input for
+     * @param[out] single_threaded Set to false if a call was not made with the single threaded scheduler
+     */
+    FrameInputAccessor(unsigned int num_frames, bool &single_threaded)
+        : _num_frames(num_frames), _frame(0), _single_threaded(single_threaded)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        _single_threaded = _single_threaded && (&Scheduler::get() == &SingleThreadScheduler::get());
+        if(_frame == _num_frames)
+        {
+            return false;
+        }
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = static_cast<float>(_frame);
+        });
+        ++_frame;
+        return true;
+    }
+
+private:
+    unsigned int _num_frames;
+    unsigned int _frame;
+    bool        &_single_threaded;
+};
+
+/** Accessor recording the first value of an output of a graph on every execution
+ *
+ * Records whether every call was made with the single threaded scheduler as scheduler of the calling thread.
+ */
+class FrameOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values          First value of the output on each execution
+     * @param[out] single_threaded Set to false if a call was not made with the single threaded scheduler
+     */
+    FrameOutputAccessor(std::vector<float> &values, bool &single_threaded)
+        : _values(values), _single_threaded(single_threaded)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        _single_threaded = _single_threaded && (&Scheduler::get() == &SingleThreadScheduler::get());
+        _values.push_back(*reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates())));
+        return true;
+    }
+
+private:
+    std::vector<float> &_values;
+    bool               &_single_threaded;
+};
+
+/** Builds, finalizes and executes a NEON graph computing 2 * x + 1 on a sequence of inputs filled with the index of the execution
+ *
+ * @param[in]  config          Graph configuration to use
+ * @param[in]  num_frames      Number of executions
+ * @param[out] single_threaded False if an accessor was not called with the single threaded scheduler
+ *
+ * @return The first value of the output on each execution
+ */
+std::vector<float> run_frames_graph(const graph::GraphConfig &config, unsigned int num_frames, bool &single_threaded)
+{
+    using namespace arm_compute::graph;
+
+    std::vector<float> output;
+    single_threaded = true;
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "frames_graph");
+
+    const NodeID input = GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(8U, 8U, 4U), DataType::F32),
+                                                      support::cpp14::make_unique<FrameInputAccessor>(num_frames, single_threaded));
+    const NodeID act = GraphBuilder::add_activation_node(g, { "linear", Target::NEON }, { input, 0 },
+                                                         ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f));
+    GraphBuilder::add_output_node(g, { "output", Target::NEON }, { act, 0 }, support::cpp14::make_unique<FrameOutputAccessor>(output, single_threaded));
+
+    // No pass, so that the activation is not computed in-place on the input
+    PassManager pm;
+    ctx.set_config(config);
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+
+    return output;
+}
+
+/** Finalizes, without any optimization pass, a NEON graph made of a chain of functions whose tensors all have the same size:
+ *  input -> relu -> add(constant) -> relu -> output
+ *
+ * @param[in, out] g       Graph to build
+ * @param[in, out] ctx     Graph context to finalize the graph with
+ * @param[in, out] manager Graph manager to finalize the graph with
+ * @param[in]      config  Graph configuration to use
+ */
+void finalize_chain_graph(graph::Graph &g, graph::GraphContext &ctx, graph::GraphManager &manager, const graph::GraphConfig &config)
+{
+    using namespace arm_compute::graph;
+
+    const TensorDescriptor desc(TensorShape(16U, 16U, 8U), DataType::F32);
+
+    const NodeID input    = GraphBuilder::add_input_node(g, { "input", Target::NEON }, desc);
+    const NodeID constant = GraphBuilder::add_const_node(g, { "constant", Target::NEON }, desc);
+    NodeID       node     = GraphBuilder::add_activation_node(g, { "relu0", Target::NEON }, { input, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    node                  = GraphBuilder::add_elementwise_node(g, { "add", Target::NEON }, { node, 0 }, { constant, 0 }, EltwiseOperation::Add);
+    node                  = GraphBuilder::add_activation_node(g, { "relu1", Target::NEON }, { node, 0 }, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    GraphBuilder::add_output_node(g, { "output", Target::NEON }, { node, 0 });
+
+    // No pass, so that no tensor is computed in-place
+    PassManager pm;
+    ctx.set_config(config);
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+}
+
+/** Checks that two sets of output values match
+ *
+ * @param[in] values    Values to check
+ * @param[in] reference Reference values
+ */
+void validate_output(const std::vector<float> &values, const std::vector<float> &reference)
+{
+    ARM_COMPUTE_EXPECT(values.size() == reference.size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!reference.empty(), framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(values.size(), reference.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(values[i] - reference[i]) <= 1e-4f * std::max(1.f, std::abs(reference[i])), framework::LogLevel::ERRORS);
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphManager)
+
+TEST_CASE(ParallelBranches, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    const auto         reference = run_branching_graph(config);
+
+    // Branches executed concurrently
+    config.num_parallel_branches = 2;
+    validate_output(run_branching_graph(config), reference);
+
+    // Branches executed concurrently, overlapping the accessors with the execution of the graph
+    config.use_pipelined_execution = true;
+    validate_output(run_branching_graph(config), reference);
+}
+
+TEST_CASE(PipelinedExecution, framework::DatasetMode::ALL)
+{
+    const unsigned int num_frames = 5;
+
+    std::vector<float> reference;
+    for(unsigned int i = 0; i < num_frames; ++i)
+    {
+        reference.push_back(2.f * static_cast<float>(i) + 1.f);
+    }
+
+    graph::GraphConfig config;
+    bool               single_threaded = true;
+    validate_output(run_frames_graph(config, num_frames, single_threaded), reference);
+
+    // Every execution is run once and its outputs consumed in order when overlapping the accessors with the execution of the graph
+    config.use_pipelined_execution = true;
+    validate_output(run_frames_graph(config, num_frames, single_threaded), reference);
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // The accessors don't share the scheduler running the graph
+    ARM_COMPUTE_EXPECT(single_threaded, framework::LogLevel::ERRORS);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+TEST_CASE(ExecuteGraphs, framework::DatasetMode::ALL)
+{
+    const auto reference = run_branching_graph(graph::GraphConfig());
+
+    std::vector<float>  outputs[2];
+    graph::GraphContext contexts[2];
+    graph::GraphManager manager;
+    graph::Graph        graph0(0, "branching_graph0");
+    graph::Graph        graph1(1, "branching_graph1");
+    graph::Graph       *graphs[2] = { &graph0, &graph1 };
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        build_branching_graph(*graphs[i], outputs[i]);
+        graph::PassManager pm = graph::create_default_pass_manager(graph::Target::NEON);
+        manager.finalize_graph(*graphs[i], contexts[i], pm, graph::Target::NEON);
+    }
+
+    // Both graphs executed concurrently, each by its own scheduler partition
+    manager.execute_graphs({ &graph0, &graph1 }, 2);
+    validate_output(outputs[0], reference);
+    validate_output(outputs[1], reference);
+
+    // Partitions are capped to the number of threads the functions have been configured for
+    outputs[0].clear();
+    outputs[1].clear();
+    manager.execute_graphs({ &graph0, &graph1 }, 4 * Scheduler::get().num_threads() + 2);
+    validate_output(outputs[0], reference);
+    validate_output(outputs[1], reference);
+}
+
+TEST_CASE(MemoryReport, framework::DatasetMode::ALL)
+{
+    const size_t tensor_size = 16 * 16 * 8 * sizeof(float);
+
+    // The intermediate tensors of relu0 and add are alive at the same time and share the transition memory
+    {
+        graph::GraphContext ctx;
+        graph::GraphManager manager;
+        graph::Graph        g(0, "chain_graph");
+        finalize_chain_graph(g, ctx, manager, graph::GraphConfig());
+
+        const graph::MemoryReport report = manager.memory_report(g);
+        ARM_COMPUTE_EXPECT(report.weights == tensor_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.transformed_weights == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.pretransposed_weights == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.activations == 2 * tensor_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.transitions == 2 * tensor_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.scratch == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.padding == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.total() == 5 * tensor_size, framework::LogLevel::ERRORS);
+
+        // Each node is attributed the tensors it produces
+        for(const auto &node : report.nodes)
+        {
+            const bool is_output = node.type == graph::NodeType::Output;
+            ARM_COMPUTE_EXPECT(node.weights == (node.type == graph::NodeType::Const ? tensor_size : 0), framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(node.activations == (node.type == graph::NodeType::Const || is_output ? 0 : tensor_size), framework::LogLevel::ERRORS);
+        }
+    }
+
+    // Without the transition memory manager every tensor is allocated individually
+    {
+        graph::GraphConfig config;
+        config.use_transition_memory_manager = false;
+
+        graph::GraphContext ctx;
+        graph::GraphManager manager;
+        graph::Graph        g(0, "chain_graph");
+        finalize_chain_graph(g, ctx, manager, config);
+
+        const graph::MemoryReport report = manager.memory_report(g);
+        ARM_COMPUTE_EXPECT(report.weights == tensor_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.activations == 4 * tensor_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.transitions == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.total() == 5 * tensor_size, framework::LogLevel::ERRORS);
+    }
+
+    // Without weights manager the pretransposed weights of a fully connected layer are held by its function
+    {
+        using namespace arm_compute::graph;
+
+        GraphContext ctx;
+        GraphManager manager;
+        Graph        g(0, "fc_graph");
+
+        const NodeID input = GraphBuilder::add_input_node(g, { "input", Target::NEON }, TensorDescriptor(TensorShape(37U, 8U), DataType::F32));
+        const NodeID fc    = GraphBuilder::add_fully_connected_layer(g, { "fc", Target::NEON }, { input, 0 }, 23U,
+                                                                     graph_utils::get_random_accessor(-1.f, 1.f, 0), graph_utils::get_random_accessor(-1.f, 1.f, 1));
+        GraphBuilder::add_output_node(g, { "output", Target::NEON }, { fc, 0 });
+
+        PassManager pm;
+        ctx.set_config(GraphConfig());
+        manager.finalize_graph(g, ctx, pm, Target::NEON);
+
+        const graph::MemoryReport report = manager.memory_report(g);
+        ARM_COMPUTE_EXPECT(report.transformed_weights == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.pretransposed_weights > 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(report.total() == report.weights + report.pretransposed_weights + report.activations + report.transitions + report.scratch, framework::LogLevel::ERRORS);
+
+        // The pretransposed weights are attributed to the fully connected layer
+        for(const auto &node : report.nodes)
+        {
+            const bool is_fc = node.type == NodeType::FullyConnectedLayer;
+            ARM_COMPUTE_EXPECT(node.pretransposed_weights == (is_fc ? report.pretransposed_weights : 0), framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* BARE_METAL */
@@ -21,11 +21,16 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/BlobMemoryPool.h"
+#include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/MmapAllocator.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
@@ -36,6 +41,16 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -90,6 +105,241 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(OffsetLifetimeManagerPlanning, framework::DatasetMode::ALL)
+{
+    const std::vector<std::pair<OffsetPlanningStrategy, size_t>> configs =
+    {
+        { OffsetPlanningStrategy::BLOBS, 250U },
+        { OffsetPlanningStrategy::GREEDY_BY_SIZE, 160U },
+        { OffsetPlanningStrategy::GREEDY_BY_BREADTH, 160U }
+    };
+
+    for(const auto &config : configs)
+    {
+        OffsetLifetimeManager lifetime_mgr(config.first);
+        MemoryGroup           group{};
+        Memory                persistent{}, before{}, small{}, large{};
+
+        // persistent is alive during the whole group, before dies before small and large are created
+        lifetime_mgr.register_group(&group);
+        lifetime_mgr.start_lifetime(&before);
+        lifetime_mgr.start_lifetime(&persistent);
+        lifetime_mgr.end_lifetime(&before, before, 100, 0);
+        lifetime_mgr.start_lifetime(&small);
+        lifetime_mgr.start_lifetime(&large);
+        lifetime_mgr.end_lifetime(&small, small, 10, 0);
+        lifetime_mgr.end_lifetime(&large, large, 100, 0);
+        lifetime_mgr.end_lifetime(&persistent, persistent, 50, 0);
+
+        ARM_COMPUTE_EXPECT(lifetime_mgr.are_all_finalized(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(lifetime_mgr.peak_size() == 160U, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(lifetime_mgr.planned_size() == config.second, framework::LogLevel::ERRORS);
+
+        // Tensors alive at the same time must not overlap
+        const MemoryMappings &mappings        = group.mappings();
+        const auto            are_overlapping = [&](IMemory * a, size_t a_size, IMemory * b, size_t b_size)
+        {
+            return (mappings.at(a) < mappings.at(b) + b_size) && (mappings.at(b) < mappings.at(a) + a_size);
+        };
+        ARM_COMPUTE_EXPECT(!are_overlapping(&persistent, 50, &before, 100), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!are_overlapping(&persistent, 50, &small, 10), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!are_overlapping(&persistent, 50, &large, 100), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!are_overlapping(&small, 10, &large, 100), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(MmapAllocatorAlignment, framework::DatasetMode::ALL)
+{
+    // A threshold of 4KB exercises both the heap and the memory mapped allocations
+    MmapAllocator allocator(HugePageMode::TRANSPARENT, -1, 4096);
+
+    for(size_t size : { 100U, 4096U, 3U * 1024U * 1024U })
+    {
+        for(size_t alignment : { 0U, 64U, 4096U, 65536U })
+        {
+            void *ptr = allocator.allocate(size, alignment);
+            ARM_COMPUTE_EXPECT(ptr != nullptr, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(alignment == 0 || arm_compute::utility::check_aligned(ptr, alignment), framework::LogLevel::ERRORS);
+            std::memset(ptr, 0xFF, size);
+            allocator.free(ptr);
+
+            auto region = allocator.make_region(size, alignment);
+            ARM_COMPUTE_EXPECT(region->buffer() != nullptr, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(region->size() == size, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(alignment == 0 || arm_compute::utility::check_aligned(region->buffer(), alignment), framework::LogLevel::ERRORS);
+
+            const auto *data = static_cast<const uint8_t *>(region->buffer());
+            ARM_COMPUTE_EXPECT(std::all_of(data, data + size, [](uint8_t v)
+            {
+                return v == 0;
+            }),
+            framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_CASE(MmapAllocatorMemoryManager, framework::DatasetMode::ALL)
+{
+    MmapAllocator allocator(HugePageMode::TRANSPARENT, -1, 0);
+    auto          lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    auto          pool_mgr     = std::make_shared<PoolManager>();
+    auto          mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    // Create tensors
+    Tensor src = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+    Tensor dst = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+
+    // Create and configure function
+    NENormalizationLayer norm_layer(mm);
+    norm_layer.configure(&src, &dst, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+
+    // The pool size is known once the groups are finalized
+    ARM_COMPUTE_EXPECT(lifetime_mgr->pool_size() == lifetime_mgr->planned_size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->pool_size() >= lifetime_mgr->peak_size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->pool_size() > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->footprint() == 0, framework::LogLevel::ERRORS);
+
+    // Allocate tensors
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // Finalize memory manager
+    mm->populate(allocator, 2 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->footprint() == 2 * lifetime_mgr->pool_size(), framework::LogLevel::ERRORS);
+
+    // Fill tensors
+    arm_compute::test::library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Compute function
+    norm_layer.run();
+
+    // Clear manager
+    mm->clear();
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->footprint() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PoolManagerLocking, framework::DatasetMode::ALL)
+{
+    Allocator   allocator{};
+    PoolManager pool_mgr{};
+    pool_mgr.register_pool(support::cpp14::make_unique<BlobMemoryPool>(&allocator, std::vector<BlobInfo>{ BlobInfo(1024U) }));
+    pool_mgr.register_pool(support::cpp14::make_unique<BlobMemoryPool>(&allocator, std::vector<BlobInfo>{ BlobInfo(1024U) }));
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+
+    // The pool locked last by the thread is handed back to it
+    IMemoryPool *first = pool_mgr.lock_pool();
+    pool_mgr.unlock_pool(first);
+    IMemoryPool *again = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(again == first, framework::LogLevel::ERRORS);
+
+    // An occupied pool is never handed out twice
+    IMemoryPool *second = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(second != nullptr && second != again, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(second);
+    pool_mgr.unlock_pool(again);
+
+    // Release the pools
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PoolManagerLockingMultiThreaded, framework::DatasetMode::ALL)
+{
+    constexpr size_t num_pools   = 3;
+    constexpr size_t num_threads = 8;
+    constexpr int    num_cycles  = 2000;
+
+    // Shared with the worker threads, which are detached if they deadlock
+    struct SharedState
+    {
+        Allocator                               allocator{};
+        PoolManager                             pool_mgr{};
+        std::vector<IMemoryPool *>              pools{};
+        std::array<std::atomic<int>, num_pools> holders{};
+        std::atomic<int>                        num_violations{ 0 };
+        std::atomic<size_t>                     num_done{ 0 };
+        std::atomic<bool>                       stop{ false };
+    };
+    auto state = std::make_shared<SharedState>();
+    for(size_t i = 0; i < num_pools; ++i)
+    {
+        auto pool = support::cpp14::make_unique<BlobMemoryPool>(&state->allocator, std::vector<BlobInfo>{ BlobInfo(1024U) });
+        state->pools.push_back(pool.get());
+        state->pool_mgr.register_pool(std::move(pool));
+    }
+
+    // Each thread repeatedly locks a pool, checks nobody else holds it and unlocks it
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([state]()
+        {
+            for(int c = 0; c < num_cycles && !state->stop; ++c)
+            {
+                IMemoryPool *pool = state->pool_mgr.lock_pool();
+                const auto   it   = std::find(state->pools.begin(), state->pools.end(), pool);
+                if(it == state->pools.end())
+                {
+                    ++state->num_violations;
+                    continue;
+                }
+                std::atomic<int> &holder = state->holders[std::distance(state->pools.begin(), it)];
+                if(holder.fetch_add(1) != 0)
+                {
+                    ++state->num_violations;
+                }
+                std::this_thread::yield();
+                holder.fetch_sub(1);
+                state->pool_mgr.unlock_pool(pool);
+            }
+            ++state->num_done;
+        });
+    }
+
+    // A deadlock shows up as threads which do not finish in time
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while(state->num_done < num_threads && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const bool deadlocked = state->num_done < num_threads;
+    for(auto &thread : threads)
+    {
+        if(deadlocked)
+        {
+            thread.detach();
+        }
+        else
+        {
+            thread.join();
+        }
+    }
+    if(deadlocked)
+    {
+        state->stop = true;
+    }
+    ARM_COMPUTE_ASSERT(!deadlocked);
+    ARM_COMPUTE_EXPECT(state->num_violations == 0, framework::LogLevel::ERRORS);
+
+    // All the pools are free again and handed out to distinct owners
+    std::vector<IMemoryPool *> locked;
+    for(size_t i = 0; i < num_pools; ++i)
+    {
+        locked.push_back(state->pool_mgr.lock_pool());
+    }
+    std::sort(locked.begin(), locked.end());
+    ARM_COMPUTE_EXPECT(std::unique(locked.begin(), locked.end()) == locked.end(), framework::LogLevel::ERRORS);
+    for(auto *pool : locked)
+    {
+        state->pool_mgr.unlock_pool(pool);
+    }
+    ARM_COMPUTE_EXPECT(state->pool_mgr.num_pools() == num_pools, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/CPP/CPPWorkStealingScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Runs a linear activation on a tensor of consecutive values with the given scheduler and checks every output value
+ *
+ * The tensor is large enough for the window to be split between all the threads of the scheduler.
+ *
+ * @param[in] scheduler Scheduler to run the activation with
+ */
+void validate_scheduler(IScheduler &scheduler)
+{
+    const TensorShape shape(67U, 61U, 5U);
+
+    Tensor src;
+    Tensor dst;
+    src.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+    dst.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+    NEActivationLayer act;
+    act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f));
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    auto *src_data = reinterpret_cast<float *>(src.buffer());
+    auto *dst_data = reinterpret_cast<float *>(dst.buffer());
+    for(size_t i = 0; i < shape.total_size(); ++i)
+    {
+        src_data[i] = static_cast<float>(i);
+        dst_data[i] = -1.f;
+    }
+
+    // Route the kernels run by the calling thread to the scheduler under test
+    IScheduler *previous_scheduler = Scheduler::set_thread_local(&scheduler);
+    ARM_COMPUTE_EXPECT(&Scheduler::get() == &scheduler, framework::LogLevel::ERRORS);
+    act.run();
+    act.run();
+    ARM_COMPUTE_EXPECT(Scheduler::set_thread_local(previous_scheduler) == &scheduler, framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < shape.total_size(); ++i)
+    {
+        num_mismatches += (dst_data[i] != 2.f * static_cast<float>(i) + 1.f) ? 1 : 0;
+    }
+    ARM_COMPUTE_EXPECT(num_mismatches == 0, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(Scheduler)
+
+TEST_CASE(WakeupModes, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+    validate_scheduler(scheduler);
+
+    scheduler.set_wakeup_mode(CPPScheduler::WakeupMode::SPIN_THEN_PARK);
+    ARM_COMPUTE_EXPECT(scheduler.wakeup_mode() == CPPScheduler::WakeupMode::SPIN_THEN_PARK, framework::LogLevel::ERRORS);
+    validate_scheduler(scheduler);
+
+    // Threads parked after spinning must still be woken up
+    scheduler.set_wakeup_mode(CPPScheduler::WakeupMode::SPIN_THEN_PARK, std::chrono::microseconds(0));
+    validate_scheduler(scheduler);
+}
+
+TEST_CASE(AffinityPolicies, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    scheduler.set_affinity_policy(CPPScheduler::AffinityPolicy::LINEAR);
+    ARM_COMPUTE_EXPECT(scheduler.affinity_policy() == CPPScheduler::AffinityPolicy::LINEAR, framework::LogLevel::ERRORS);
+    validate_scheduler(scheduler);
+
+    scheduler.set_affinity_policy(CPPScheduler::AffinityPolicy::BIG_CORES);
+    validate_scheduler(scheduler);
+
+    scheduler.set_affinity_policy(CPPScheduler::AffinityPolicy::CUSTOM, { 0 });
+    validate_scheduler(scheduler);
+}
+
+TEST_CASE(ThreadWeights, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+
+    // Uneven weights must still cover the whole window
+    scheduler.set_thread_weights({ 1.f, 3.f, 0.5f, 2.f });
+    ARM_COMPUTE_EXPECT(scheduler.thread_weights().size() == 4, framework::LogLevel::ERRORS);
+    validate_scheduler(scheduler);
+
+    scheduler.calibrate_thread_weights(CPPScheduler::WeightCalibration::BENCHMARK);
+    ARM_COMPUTE_EXPECT(scheduler.thread_weights().size() == 4, framework::LogLevel::ERRORS);
+    validate_scheduler(scheduler);
+
+    scheduler.set_thread_weights({});
+    ARM_COMPUTE_EXPECT(scheduler.thread_weights().empty(), framework::LogLevel::ERRORS);
+    validate_scheduler(scheduler);
+}
+
+TEST_CASE(WorkStealing, framework::DatasetMode::ALL)
+{
+    CPPWorkStealingScheduler &scheduler         = CPPWorkStealingScheduler::get();
+    const unsigned int        num_threads       = scheduler.num_threads();
+    const unsigned int        chunks_per_thread = scheduler.chunks_per_thread();
+
+    scheduler.set_num_threads(4);
+    validate_scheduler(scheduler);
+
+    scheduler.set_chunks_per_thread(1);
+    validate_scheduler(scheduler);
+
+    // More chunks than rows to split
+    scheduler.set_chunks_per_thread(64);
+    validate_scheduler(scheduler);
+
+    // Restore the configuration of the singleton
+    scheduler.set_num_threads(num_threads);
+    scheduler.set_chunks_per_thread(chunks_per_thread);
+}
+
+TEST_SUITE_END() // Scheduler
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WeightsManager.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Fully connected layer with its tensors, the weights being filled with a pattern shifted by an offset */
+struct FullyConnectedInstance
+{
+    /** Constructor
+     *
+     * @param[in] weights_manager Weights manager of the layer. Can be nullptr.
+     * @param[in] weights_offset  Offset added to the weights values
+     */
+    FullyConnectedInstance(IWeightsManager *weights_manager, float weights_offset)
+        : fc(nullptr, weights_manager)
+    {
+        src.allocator()->init(TensorInfo(TensorShape(37U, 3U), 1, DataType::F32));
+        weights.allocator()->init(TensorInfo(TensorShape(37U, 23U), 1, DataType::F32));
+        bias.allocator()->init(TensorInfo(TensorShape(23U), 1, DataType::F32));
+        dst.allocator()->init(TensorInfo(TensorShape(23U, 3U), 1, DataType::F32));
+
+        fc.configure(&src, &weights, &bias, &dst);
+
+        for(auto *tensor : { &src, &weights, &bias, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+        fill(src, 0.f);
+        fill(weights, weights_offset);
+        fill(bias, 1.f);
+    }
+    /** Checks that the output is identical to the output of another instance
+     *
+     * @param[in] other Instance to compare the output with
+     *
+     * @return True if the outputs are identical
+     */
+    bool same_output(const FullyConnectedInstance &other) const
+    {
+        const auto *data       = reinterpret_cast<const float *>(dst.buffer());
+        const auto *other_data = reinterpret_cast<const float *>(other.dst.buffer());
+        for(size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+        {
+            if(data[i] != other_data[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Tensor                src{};
+    Tensor                weights{};
+    Tensor                bias{};
+    Tensor                dst{};
+    NEFullyConnectedLayer fc;
+
+private:
+    static void fill(Tensor &tensor, float offset)
+    {
+        auto *data = reinterpret_cast<float *>(tensor.buffer());
+        for(size_t i = 0; i < tensor.info()->tensor_shape().total_size(); ++i)
+        {
+            data[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.25f + offset;
+        }
+    }
+};
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsManager)
+
+TEST_CASE(ShareByContent, framework::DatasetMode::ALL)
+{
+    // Reference computed without weights manager, and footprint of the transformed weights of a single layer
+    FullyConnectedInstance reference(nullptr, 0.5f);
+    reference.fc.run();
+
+    WeightsManager         single_wm;
+    FullyConnectedInstance single(&single_wm, 0.5f);
+    single.fc.run();
+    const size_t single_footprint = single_wm.footprint();
+    ARM_COMPUTE_EXPECT(single_footprint > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(single.same_output(reference), framework::LogLevel::ERRORS);
+
+    // Two instances with distinct weights tensors holding the same values share their transformed weights
+    WeightsManager wm;
+    auto           instance0 = support::cpp14::make_unique<FullyConnectedInstance>(&wm, 0.5f);
+    auto           instance1 = support::cpp14::make_unique<FullyConnectedInstance>(&wm, 0.5f);
+    instance0->fc.run();
+    instance1->fc.run();
+    ARM_COMPUTE_EXPECT(wm.footprint() == single_footprint, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(instance0->same_output(reference), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(instance1->same_output(reference), framework::LogLevel::ERRORS);
+
+    // Weights with other values are not shared
+    auto other = support::cpp14::make_unique<FullyConnectedInstance>(&wm, -1.f);
+    other->fc.run();
+    ARM_COMPUTE_EXPECT(wm.footprint() == 2 * single_footprint, framework::LogLevel::ERRORS);
+
+    // The shared memory outlives the instance which transformed the weights
+    const ITensor *weights0 = &instance0->weights;
+    instance0.reset();
+    ARM_COMPUTE_EXPECT(!wm.are_weights_managed(weights0), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(wm.footprint() == 2 * single_footprint, framework::LogLevel::ERRORS);
+    instance1->fc.run();
+    ARM_COMPUTE_EXPECT(instance1->same_output(reference), framework::LogLevel::ERRORS);
+
+    // Destroyed instances are no longer accounted for
+    instance1.reset();
+    other.reset();
+    ARM_COMPUTE_EXPECT(wm.footprint() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // WeightsManager
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BARE_METAL
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "utils/GraphUtils.h"
+#include "utils/Utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Write an unsigned integer in little endian */
+void write_le(std::ofstream &fs, uint64_t value, size_t size)
+{
+    for(size_t i = 0; i < size; ++i)
+    {
+        fs.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+/** Write a length prefixed string */
+void write_string(std::ofstream &fs, const std::string &str)
+{
+    write_le(fs, str.size(), 4);
+    fs.write(str.data(), str.size());
+}
+
+/** Pack a single F32 NPY file in a weights container, as scripts/npy_weights_packer.py does
+ *
+ * @param[in] npy_file  NPY file to pack
+ * @param[in] container Container to create
+ * @param[in] name      Name of the tensor in the container
+ * @param[in] shape     Shape of the tensor in numpy order
+ */
+void pack_npy_file(const std::string &npy_file, const std::string &container, const std::string &name, const std::vector<unsigned long> &shape)
+{
+    std::ifstream           in(npy_file, std::ios::in | std::ios::binary);
+    const std::vector<char> npy((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // Version 1 NPY files store the size of the header after the magic and the version
+    const size_t header_size = 10 + (static_cast<uint8_t>(npy[8]) | (static_cast<uint8_t>(npy[9]) << 8));
+    const size_t alignment   = 64;
+    const size_t index_size  = 8 + 4 + 4 + 4 + name.size() + 4 + 3 + 4 + 4 + 8 * shape.size() + 8 * 3 + 4;
+    const size_t data_offset = ((index_size + header_size + alignment - 1) / alignment) * alignment;
+    const size_t npy_offset  = data_offset - header_size;
+
+    std::ofstream out(container, std::ios::out | std::ios::binary);
+    out.write("ACLWPACK", 8);
+    write_le(out, 1, 4);
+    write_le(out, 1, 4);
+    write_string(out, name);
+    write_string(out, "<f4");
+    write_le(out, 0, 1);
+    write_le(out, 0, 1);
+    write_le(out, 0, 2);
+    write_le(out, shape.size(), 4);
+    for(unsigned long d : shape)
+    {
+        write_le(out, d, 8);
+    }
+    write_le(out, npy_offset, 8);
+    write_le(out, data_offset, 8);
+    write_le(out, npy.size() - header_size, 8);
+    write_le(out, alignment, 4);
+    out.write(std::string(npy_offset - index_size, '\0').data(), npy_offset - index_size);
+    out.write(npy.data(), npy.size());
+}
+
+/** Check that two F32 tensors hold the same values */
+bool same_values(Tensor &a, Tensor &b)
+{
+    bool   same = a.info()->tensor_shape().total_size() == b.info()->tensor_shape().total_size();
+    Window window;
+    window.use_tensor_dimensions(a.info()->tensor_shape());
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        same = same && *reinterpret_cast<float *>(a.ptr_to_element(id)) == *reinterpret_cast<float *>(b.ptr_to_element(id));
+    });
+    return same;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphUtils)
+
+TEST_CASE(PackedWeightsAccessor, framework::DatasetMode::ALL)
+{
+    const std::string                npy_file  = "graph_utils_test_weights.npy";
+    const std::string                container = "graph_utils_test_weights.pack";
+    const std::vector<unsigned long> shape{ 3, 5 }; // NOLINT
+
+    std::vector<float> values(15);
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0.5f * i - 3.f;
+    }
+    npy::SaveArrayAsNumpy(npy_file, false, shape.size(), shape.data(), values);
+    pack_npy_file(npy_file, container, "cnn_data/test_model/weights.npy", shape);
+
+    const TensorInfo info(TensorShape(5U, 3U), 1, DataType::F32);
+
+    // Reference loaded from the NPY file
+    Tensor ref;
+    ref.allocator()->init(info);
+    ref.allocator()->allocate();
+    graph_utils::NumPyBinLoader npy_loader(npy_file);
+    npy_loader.access_tensor(ref);
+
+    // Container given as data path, with the model directory appended like the graph examples do
+    Tensor aliased;
+    aliased.allocator()->init(info);
+    auto container_accessor = graph_utils::get_weights_accessor(container + "/cnn_data/test_model/", "weights.npy");
+    container_accessor->access_tensor(aliased);
+    ARM_COMPUTE_EXPECT(!aliased.info()->is_resizable(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(same_values(aliased, ref), framework::LogLevel::ERRORS);
+
+    // Container given as data path, with the full name of the tensor
+    Tensor copied;
+    copied.allocator()->init(info);
+    copied.allocator()->allocate();
+    auto full_name_accessor = graph_utils::get_weights_accessor(container, "/cnn_data/test_model/weights.npy");
+    full_name_accessor->access_tensor(copied);
+    ARM_COMPUTE_EXPECT(same_values(copied, ref), framework::LogLevel::ERRORS);
+
+    // Paths which are not in a container
+    std::string container_path;
+    std::string prefix;
+    ARM_COMPUTE_EXPECT(!utils::PackedWeightsFile::split_path(npy_file, container_path, prefix), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!utils::PackedWeightsFile::split_path("./missing_directory/cnn_data/", container_path, prefix), framework::LogLevel::ERRORS);
+
+    // Release the mappings before removing the files
+    aliased.allocator()->free();
+    container_accessor.reset();
+    std::remove(npy_file.c_str());
+    std::remove(container.c_str());
+}
+
+TEST_SUITE_END() // GraphUtils
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* BARE_METAL */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/SimpleTensor.h"
+#include "tests/datasets/SmallConvolutionLayerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/Parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+template <typename T>
+void fill(SimpleTensor<T> &tensor, int i)
+{
+    switch(tensor.data_type())
+    {
+        case DataType::QASYMM8:
+        {
+            std::uniform_int_distribution<uint8_t> distribution(0, 255);
+            library->fill(tensor, distribution, i);
+            break;
+        }
+        case DataType::S32:
+        {
+            std::uniform_int_distribution<int32_t> distribution(-100, 100);
+            library->fill(tensor, distribution, i);
+            break;
+        }
+        default:
+        {
+            std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+            library->fill(tensor, distribution, i);
+        }
+    }
+}
+
+/** Check that the blocked GEMM reference convolution matches the naive one bit for bit */
+template <typename T, typename TB>
+bool gemm_matches_naive(const TensorShape &src_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &dst_shape, const PadStrideInfo &info,
+                        const Size2D &dilation, DataType data_type, DataType bias_data_type)
+{
+    SimpleTensor<T>  src{ src_shape, data_type, 1, QuantizationInfo(2.f / 255.f, 10) };
+    SimpleTensor<T>  weights{ weights_shape, data_type, 1, QuantizationInfo(2.f / 255.f, 3) };
+    SimpleTensor<TB> bias{ bias_shape, bias_data_type };
+
+    fill(src, 0);
+    fill(weights, 1);
+    fill(bias, 2);
+
+    const SimpleTensor<T> gemm  = reference::convolution_layer<T>(src, weights, bias, dst_shape, info, dilation);
+    const SimpleTensor<T> naive = reference::convolution_layer_naive<T>(src, weights, bias, dst_shape, info, dilation);
+
+    return gemm.num_elements() == naive.num_elements() && std::memcmp(gemm.data(), naive.data(), gemm.num_elements() * sizeof(T)) == 0;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Reference)
+
+TEST_CASE(ParallelFor, framework::DatasetMode::ALL)
+{
+    const unsigned int default_num_threads = reference::num_threads();
+    reference::set_num_threads(4);
+
+    // Every work item is processed exactly once and nested calls run on the calling thread
+    std::vector<int> count(1000, 0);
+    reference::parallel_for(static_cast<int>(count.size()), [&](int start, int end)
+    {
+        for(int i = start; i < end; ++i)
+        {
+            reference::parallel_for(1, [&](int, int)
+            {
+                ++count[i];
+            });
+        }
+    });
+
+    reference::set_num_threads(default_num_threads);
+
+    ARM_COMPUTE_EXPECT(std::count(count.begin(), count.end(), 1) == static_cast<int>(count.size()), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE(ConvolutionLayer)
+
+DATA_TEST_CASE(GEMMMatchesNaiveFP32, framework::DatasetMode::ALL, datasets::SmallConvolutionLayerDataset(),
+               src_shape, weights_shape, bias_shape, dst_shape, info, dilation)
+{
+    ARM_COMPUTE_EXPECT((gemm_matches_naive<float, float>(src_shape, weights_shape, bias_shape, dst_shape, info, dilation, DataType::F32, DataType::F32)), framework::LogLevel::ERRORS);
+}
+
+DATA_TEST_CASE(GEMMMatchesNaiveQASYMM8, framework::DatasetMode::ALL, datasets::SmallConvolutionLayerDataset(),
+               src_shape, weights_shape, bias_shape, dst_shape, info, dilation)
+{
+    ARM_COMPUTE_EXPECT((gemm_matches_naive<uint8_t, int32_t>(src_shape, weights_shape, bias_shape, dst_shape, info, dilation, DataType::QASYMM8, DataType::S32)), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ConvolutionLayer
+TEST_SUITE_END() // Reference
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BARE_METAL
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Creates an allocated F32 tensor filled with consecutive values
+ *
+ * @param[in] shape Shape of the tensor
+ *
+ * @return The tensor
+ */
+std::unique_ptr<Tensor> create_weights(const TensorShape &shape)
+{
+    auto weights = support::cpp14::make_unique<Tensor>();
+    weights->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+    weights->allocator()->allocate();
+
+    auto *data = reinterpret_cast<float *>(weights->buffer());
+    for(size_t i = 0; i < shape.total_size(); ++i)
+    {
+        data[i] = static_cast<float>(i);
+    }
+    return weights;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsCache)
+
+TEST_CASE(StoreLoad, framework::DatasetMode::ALL)
+{
+    char directory[] = "acl_weights_cache_XXXXXX";
+    ARM_COMPUTE_ASSERT(mkdtemp(directory) != nullptr);
+
+    auto              weights = create_weights(TensorShape(7U, 5U, 3U));
+    const size_t      size    = 1000;
+    const std::string key     = WeightsCache::compute_key("transform", *weights, size);
+    std::vector<char> blob(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<char>(i * 7);
+    }
+
+    {
+        WeightsCache cache(directory);
+        ARM_COMPUTE_EXPECT(cache.load(key, size) == nullptr, framework::LogLevel::ERRORS);
+
+        cache.store(key, blob.data(), size);
+        void *loaded = cache.load(key, size);
+        ARM_COMPUTE_EXPECT(loaded != nullptr, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(loaded != nullptr && std::memcmp(loaded, blob.data(), size) == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(loaded) % sysconf(_SC_PAGESIZE) == 0, framework::LogLevel::ERRORS);
+
+        // Already mapped blob requested with another size
+        ARM_COMPUTE_EXPECT(cache.load(key, size + 4) == nullptr, framework::LogLevel::ERRORS);
+    }
+
+    {
+        // Blob stored by another instance, requested with another size
+        WeightsCache cache(directory);
+        ARM_COMPUTE_EXPECT(cache.load(key, size - 4) == nullptr, framework::LogLevel::ERRORS);
+        void *loaded = cache.load(key, size);
+        ARM_COMPUTE_EXPECT(loaded != nullptr && std::memcmp(loaded, blob.data(), size) == 0, framework::LogLevel::ERRORS);
+    }
+
+    std::remove((std::string(directory) + "/" + key + ".bin").c_str());
+    rmdir(directory);
+}
+
+TEST_CASE(Key, framework::DatasetMode::ALL)
+{
+    auto weights       = create_weights(TensorShape(7U, 5U, 3U));
+    auto other_weights = create_weights(TensorShape(7U, 5U, 3U));
+    auto reshaped      = create_weights(TensorShape(5U, 7U, 3U));
+
+    const std::string key = WeightsCache::compute_key("transform", *weights, 1000);
+    ARM_COMPUTE_EXPECT(WeightsCache::compute_key("transform", *other_weights, 1000) == key, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(WeightsCache::compute_key("other_transform", *weights, 1000) != key, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(WeightsCache::compute_key("transform", *weights, 1004) != key, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(WeightsCache::compute_key("transform", *reshaped, 1000) != key, framework::LogLevel::ERRORS);
+
+    // Change a single value
+    reinterpret_cast<float *>(other_weights->buffer())[50] += 1.f;
+    ARM_COMPUTE_EXPECT(WeightsCache::compute_key("transform", *other_weights, 1000) != key, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // WeightsCache
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* BARE_METAL */
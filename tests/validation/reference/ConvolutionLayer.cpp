@@ -25,14 +25,16 @@
 
 #include "tests/validation/Helpers.h"
 #include "tests/validation/reference/Convolution3d.h"
+#include "tests/validation/reference/Parallel.h"
 #include "tests/validation/reference/Permute.h"
 #include "tests/validation/reference/Utils.h"
 #include "tests/validation/reference/UtilsQuantizedAsymm.h"
 
-#include "tests/framework/Asserts.h"
-
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -43,6 +45,213 @@ namespace reference
 {
 namespace
 {
+/** Number of output feature maps computed at once by the GEMM based convolution */
+constexpr int tile_ofm = 4;
+/** Number of output pixels computed at once by the GEMM based convolution */
+constexpr int tile_x = 4;
+
+/** Accumulator type of the convolution */
+template <typename T>
+struct ConvolutionAccumulator
+{
+    using type = T;
+};
+
+template <>
+struct ConvolutionAccumulator<uint8_t>
+{
+    using type = int32_t;
+};
+
+/** Parameters of the output stage of a quantized convolution */
+struct OutputStage
+{
+    int output_multiplier{ 0 };
+    int output_shift{ 0 };
+    int output_offset{ 0 };
+};
+
+template <typename T>
+T to_accumulator(T value, int offset)
+{
+    ARM_COMPUTE_UNUSED(offset);
+    return value;
+}
+
+int32_t to_accumulator(uint8_t value, int offset)
+{
+    return static_cast<int32_t>(value) + offset;
+}
+
+template <typename T, typename TB>
+T finalize(T acc, TB bias, const OutputStage &stage)
+{
+    ARM_COMPUTE_UNUSED(stage);
+    return acc + bias;
+}
+
+uint8_t finalize(int32_t acc, int32_t bias, const OutputStage &stage)
+{
+    acc += bias;
+    acc = asymm_rounding_divide_by_pow2(asymm_int_mult(acc, stage.output_multiplier), stage.output_shift);
+    acc += stage.output_offset;
+    return static_cast<uint8_t>(utility::clamp<int32_t>(acc, 0, 255));
+}
+
+/** Convolution computed as a blocked matrix multiplication between the weights and the im2col patches of each output row
+ *
+ * The products are accumulated in the same order as in @ref convolution_layer_nchw so the results are identical.
+ */
+template <typename T, typename TB>
+SimpleTensor<T> convolution_layer_gemm_nchw(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, SimpleTensor<T> &dst, const PadStrideInfo &info,
+                                            const Size2D &dilation, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON((src.shape()[2] / num_groups) != weights.shape()[2]);
+
+    using TAcc = typename ConvolutionAccumulator<T>::type;
+
+    const int width_in       = src.shape().x();
+    const int height_in      = src.shape().y();
+    const int depth_in       = src.shape().z();
+    const int width_out      = dst.shape().x();
+    const int height_out     = dst.shape().y();
+    const int depth_out      = dst.shape().z();
+    const int width_weights  = weights.shape().x();
+    const int height_weights = weights.shape().y();
+    const int depth_weights  = weights.shape().z();
+    const int pad_left       = info.pad_left();
+    const int pad_top        = info.pad_top();
+    const int stride_xi      = info.stride().first;
+    const int stride_yi      = info.stride().second;
+    const int groups         = static_cast<int>(num_groups);
+    const int ifm_per_group  = depth_in / groups;
+    const int ofm_per_group  = depth_out / groups;
+    const int patch_size     = width_weights * height_weights * ifm_per_group;
+
+    auto output_wh = scaled_dimensions(width_in, height_in, width_weights, height_weights, info, dilation);
+
+    const int start_xi    = (dilation.x() * (width_weights - 1) + 1) / 2 - pad_left;
+    const int start_yi    = (dilation.y() * (height_weights - 1) + 1) / 2 - pad_top;
+    const int num_x       = output_wh.first;
+    const int num_y       = output_wh.second;
+    const int num_batches = src.shape().total_size() / (width_in * height_in * depth_in);
+
+    ARM_COMPUTE_ERROR_ON(num_x > width_out || num_y > height_out);
+
+    const int input_offset   = -src.quantization_info().offset;
+    const int weights_offset = -weights.quantization_info().offset;
+
+    OutputStage stage;
+    if(is_data_type_quantized_asymmetric(src.data_type()))
+    {
+        const float multiplier = src.quantization_info().scale * weights.quantization_info().scale / dst.quantization_info().scale;
+        arm_compute::quantization::calculate_quantized_multiplier_less_than_one(multiplier, &stage.output_multiplier, &stage.output_shift);
+        stage.output_offset = dst.quantization_info().offset;
+    }
+
+    // The NCHW weights already are a [ofm][ifm * height_weights * width_weights] matrix
+    std::vector<TAcc> weights_matrix(depth_out * width_weights * height_weights * depth_weights);
+    for(size_t i = 0; i < weights_matrix.size(); ++i)
+    {
+        weights_matrix[i] = to_accumulator(weights[i], weights_offset);
+    }
+
+    // Each work item computes one output row of one batch
+    parallel_for(num_batches * num_y, [&](int start, int end)
+    {
+        std::vector<TAcc> patches(num_x * patch_size);
+
+        for(int item = start; item < end; ++item)
+        {
+            const int r  = item / num_y;
+            const int yo = item % num_y;
+            const int yi = start_yi + yo * stride_yi;
+
+            for(int group = 0; group < groups; ++group)
+            {
+                const int offset_in = r * width_in * height_in * depth_in + group * ifm_per_group * width_in * height_in;
+
+                // Gather the patches of the output row, out-of-bound pixels do not contribute to the sum
+                for(int xo = 0; xo < num_x; ++xo)
+                {
+                    const int xi        = start_xi + xo * stride_xi;
+                    TAcc     *patch_ptr = patches.data() + xo * patch_size;
+
+                    for(int ifm = 0; ifm < ifm_per_group; ++ifm)
+                    {
+                        for(int ky = 0; ky < height_weights; ++ky)
+                        {
+                            const int y = yi + (ky - height_weights / 2) * dilation.y();
+
+                            for(int kx = 0; kx < width_weights; ++kx)
+                            {
+                                const int x = xi + (kx - width_weights / 2) * dilation.x();
+
+                                const bool valid = convolution_3d::detail::is_valid_pixel(x, 0, width_in) && convolution_3d::detail::is_valid_pixel(y, 0, height_in);
+                                *patch_ptr++     = valid ? to_accumulator(src[offset_in + x + y * width_in + ifm * width_in * height_in], input_offset) : TAcc(0);
+                            }
+                        }
+                    }
+                }
+
+                // Multiply the weights of the group by the patches one tile of outputs at a time
+                for(int ofm_start = 0; ofm_start < ofm_per_group; ofm_start += tile_ofm)
+                {
+                    const int num_ofm = std::min(tile_ofm, ofm_per_group - ofm_start);
+
+                    for(int xo_start = 0; xo_start < num_x; xo_start += tile_x)
+                    {
+                        const int num_xo = std::min(tile_x, num_x - xo_start);
+
+                        const TAcc *w_ptr[tile_ofm];
+                        const TAcc *p_ptr[tile_x];
+                        TAcc        acc[tile_ofm][tile_x];
+
+                        for(int i = 0; i < tile_ofm; ++i)
+                        {
+                            w_ptr[i] = weights_matrix.data() + (group * ofm_per_group + ofm_start + std::min(i, num_ofm - 1)) * patch_size;
+                        }
+                        for(int j = 0; j < tile_x; ++j)
+                        {
+                            p_ptr[j] = patches.data() + (xo_start + std::min(j, num_xo - 1)) * patch_size;
+                        }
+                        for(int i = 0; i < tile_ofm; ++i)
+                        {
+                            for(int j = 0; j < tile_x; ++j)
+                            {
+                                acc[i][j] = TAcc(0);
+                            }
+                        }
+
+                        for(int k = 0; k < patch_size; ++k)
+                        {
+                            for(int i = 0; i < tile_ofm; ++i)
+                            {
+                                for(int j = 0; j < tile_x; ++j)
+                                {
+                                    acc[i][j] += p_ptr[j][k] * w_ptr[i][k];
+                                }
+                            }
+                        }
+
+                        for(int i = 0; i < num_ofm; ++i)
+                        {
+                            const int ofm        = group * ofm_per_group + ofm_start + i;
+                            const int offset_out = yo * width_out + ofm * width_out * height_out + r * width_out * height_out * depth_out;
+
+                            for(int j = 0; j < num_xo; ++j)
+                            {
+                                dst[offset_out + xo_start + j] = finalize(acc[i][j], bias[ofm], stage);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    return dst;
+}
 } // namespace
 
 template <typename T, typename TB>
@@ -71,13 +280,18 @@ SimpleTensor<T> convolution_layer_nchw(const SimpleTensor<T> &src, const SimpleT
     const int start_xi    = (dilation.x() * (width_weights - 1) + 1) / 2 - pad_left;
     const int start_yi    = (dilation.y() * (height_weights - 1) + 1) / 2 - pad_top;
     const int end_xi      = output_wh.first * stride_xi;
-    const int end_yi      = output_wh.second * stride_yi;
     const int num_batches = src.shape().total_size() / (width_in * height_in * depth_in);
 
-    for(int r = 0; r < num_batches; ++r)
+    const int num_y       = output_wh.second;
+
+    // Each work item computes one output row of one batch
+    parallel_for(num_batches * num_y, [&](int start, int end)
     {
-        for(int yi = start_yi; yi < start_yi + end_yi; yi += stride_yi)
+        for(int item = start; item < end; ++item)
         {
+            const int r  = item / num_y;
+            const int yi = start_yi + (item % num_y) * stride_yi;
+
             for(int xi = start_xi; xi < start_xi + end_xi; xi += stride_xi)
             {
                 for(int group = 0; group < static_cast<int>(num_groups); ++group)
@@ -92,8 +306,8 @@ SimpleTensor<T> convolution_layer_nchw(const SimpleTensor<T> &src, const SimpleT
                         const int offset_w   = (ofm + group * (depth_out / num_groups)) * width_weights * height_weights * depth_weights;
                         const int offset_b   = (ofm + group * (depth_out / num_groups));
 
-                        ARM_COMPUTE_ASSERT(xo < width_out);
-                        ARM_COMPUTE_ASSERT(yo < height_out);
+                        ARM_COMPUTE_ERROR_ON(xo >= width_out);
+                        ARM_COMPUTE_ERROR_ON(yo >= height_out);
 
                         // Compute 3D convolution
                         convolution_3d::detail::convolution3d(src, weights, bias, dst,
@@ -105,13 +319,14 @@ SimpleTensor<T> convolution_layer_nchw(const SimpleTensor<T> &src, const SimpleT
                 }
             }
         }
-    }
+    });
 
     return dst;
 }
+
 template <typename T, typename TB>
-SimpleTensor<T> convolution_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, const TensorShape &output_shape, const PadStrideInfo &info,
-                                  const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info)
+SimpleTensor<T> convolution_layer_impl(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, const TensorShape &output_shape, const PadStrideInfo &info,
+                                       const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info, bool use_gemm)
 {
     // if no explicit quantization has been set you the same as src
     if(out_quant_info == QuantizationInfo())
@@ -121,26 +336,48 @@ SimpleTensor<T> convolution_layer(const SimpleTensor<T> &src, const SimpleTensor
     // Create reference
     SimpleTensor<T> dst{ output_shape, src.data_type(), 1, out_quant_info };
 
+    const auto convolution_func = use_gemm ? &convolution_layer_gemm_nchw<T, TB> : &convolution_layer_nchw<T, TB>;
+
     if(src.data_layout() == DataLayout::NHWC)
     {
         SimpleTensor<T> src_nchw     = reference::permute<T>(src, PermutationVector(1U, 2U, 0U));
         SimpleTensor<T> weights_nchw = reference::permute<T>(weights, PermutationVector(1U, 2U, 0U));
         SimpleTensor<T> dst_nchw     = reference::permute<T>(dst, PermutationVector(1U, 2U, 0U));
 
-        return reference::permute<T>(convolution_layer_nchw(src_nchw, weights_nchw, bias, dst_nchw, info, dilation, num_groups), PermutationVector(2U, 0U, 1U));
+        return reference::permute<T>(convolution_func(src_nchw, weights_nchw, bias, dst_nchw, info, dilation, num_groups), PermutationVector(2U, 0U, 1U));
     }
     else
     {
-        return convolution_layer_nchw(src, weights, bias, dst, info, dilation, num_groups);
+        return convolution_func(src, weights, bias, dst, info, dilation, num_groups);
     }
 }
 
+template <typename T, typename TB>
+SimpleTensor<T> convolution_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, const TensorShape &output_shape, const PadStrideInfo &info,
+                                  const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info)
+{
+    return convolution_layer_impl(src, weights, bias, output_shape, info, dilation, num_groups, out_quant_info, true);
+}
+
+template <typename T, typename TB>
+SimpleTensor<T> convolution_layer_naive(const SimpleTensor<T> &src, const SimpleTensor<T> &weights, const SimpleTensor<TB> &bias, const TensorShape &output_shape, const PadStrideInfo &info,
+                                        const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info)
+{
+    return convolution_layer_impl(src, weights, bias, output_shape, info, dilation, num_groups, out_quant_info, false);
+}
+
 template SimpleTensor<float> convolution_layer(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &bias, const TensorShape &output_shape,
                                                const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
 template SimpleTensor<half> convolution_layer(const SimpleTensor<half> &src, const SimpleTensor<half> &weights, const SimpleTensor<half> &bias, const TensorShape &output_shape,
                                               const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
 template SimpleTensor<uint8_t> convolution_layer(const SimpleTensor<uint8_t> &src, const SimpleTensor<uint8_t> &weights, const SimpleTensor<int32_t> &bias, const TensorShape &output_shape,
                                                  const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
+template SimpleTensor<float> convolution_layer_naive(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &bias, const TensorShape &output_shape,
+                                                     const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
+template SimpleTensor<half> convolution_layer_naive(const SimpleTensor<half> &src, const SimpleTensor<half> &weights, const SimpleTensor<half> &bias, const TensorShape &output_shape,
+                                                    const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
+template SimpleTensor<uint8_t> convolution_layer_naive(const SimpleTensor<uint8_t> &src, const SimpleTensor<uint8_t> &weights, const SimpleTensor<int32_t> &bias, const TensorShape &output_shape,
+                                                       const PadStrideInfo &info, const Size2D &dilation, unsigned int num_groups, QuantizationInfo out_quant_info);
 } // namespace reference
 } // namespace validation
 } // namespace test
@@ -27,6 +27,7 @@
 #include "Utils.h"
 
 #include "tests/validation/Helpers.h"
+#include "tests/validation/reference/Parallel.h"
 #include "tests/validation/reference/Utils.h"
 #include "tests/validation/reference/UtilsQuantizedAsymm.h"
 
@@ -86,40 +87,46 @@ SimpleTensor<T> depthwise_convolution(const SimpleTensor<T> &src, const SimpleTe
 
     const T border_value(0);
 
-    int out_pos = 0;
-    for(int r = 0; r < num_batches; ++r)
+    const int num_x      = maximum_x < 0 ? 0 : maximum_x / conv_info.stride().first + 1;
+    const int num_y      = maximum_y < 0 ? 0 : maximum_y / conv_info.stride().second + 1;
+    const int num_planes = num_batches * input_depth * depth_multiplier;
+
+    // Each work item computes one output plane
+    parallel_for(num_planes, [&](int start, int end)
     {
-        for(int z = 0; z < input_depth; ++z)
+        for(int plane = start; plane < end; ++plane)
         {
-            for(unsigned int m = 0; m < depth_multiplier; ++m)
-            {
-                const int out_z = z * depth_multiplier + m;
+            const int m     = plane % depth_multiplier;
+            const int z     = (plane / depth_multiplier) % input_depth;
+            const int r     = plane / (depth_multiplier * input_depth);
+            const int out_z = z * depth_multiplier + m;
 
-                for(int y = minimum_y; y <= minimum_y + maximum_y; y += conv_info.stride().second)
+            int out_pos = plane * num_x * num_y;
+
+            for(int y = minimum_y; y <= minimum_y + maximum_y; y += conv_info.stride().second)
+            {
+                for(int x = minimum_x; x <= minimum_x + maximum_x; x += conv_info.stride().first)
                 {
-                    for(int x = minimum_x; x <= minimum_x + maximum_x; x += conv_info.stride().first)
-                    {
-                        Coordinates coords(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z), static_cast<int>(r));
-                        size_t      filter_offset = filter_plane * out_z;
+                    Coordinates coords(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z), static_cast<int>(r));
+                    size_t      filter_offset = filter_plane * out_z;
 
-                        T val(0);
-                        for(int j = y - patch_half_height_floor; j < y + patch_half_height_ceil; j += dilation.y())
+                    T val(0);
+                    for(int j = y - patch_half_height_floor; j < y + patch_half_height_ceil; j += dilation.y())
+                    {
+                        for(int i = x - patch_half_width_floor; i < x + patch_half_width_ceil; i += dilation.x())
                         {
-                            for(int i = x - patch_half_width_floor; i < x + patch_half_width_ceil; i += dilation.x())
-                            {
-                                coords.set(0, i);
-                                coords.set(1, j);
-                                val += *(weights.data() + filter_offset) * tensor_elem_at(src, coords, BorderMode::CONSTANT, border_value);
-                                ++filter_offset;
-                            }
+                            coords.set(0, i);
+                            coords.set(1, j);
+                            val += *(weights.data() + filter_offset) * tensor_elem_at(src, coords, BorderMode::CONSTANT, border_value);
+                            ++filter_offset;
                         }
-
-                        dst[out_pos++] = saturate_cast<T>(val + *static_cast<const TB *>(biases(Coordinates(out_z))));
                     }
+
+                    dst[out_pos++] = saturate_cast<T>(val + *static_cast<const TB *>(biases(Coordinates(out_z))));
                 }
             }
         }
-    }
+    });
 
     return dst;
 }
@@ -176,49 +183,55 @@ SimpleTensor<uint8_t> depthwise_convolution(const SimpleTensor<uint8_t> &src, co
     const int maximum_x = input_width + pad_left + pad_right - static_cast<int>(patch_width);
     const int maximum_y = input_height + pad_top + pad_bottom - static_cast<int>(patch_height);
 
-    int out_pos = 0;
-    for(int r = 0; r < num_batches; ++r)
+    const int num_x      = maximum_x < 0 ? 0 : maximum_x / conv_info.stride().first + 1;
+    const int num_y      = maximum_y < 0 ? 0 : maximum_y / conv_info.stride().second + 1;
+    const int num_planes = num_batches * input_depth * depth_multiplier;
+
+    // Each work item computes one output plane
+    parallel_for(num_planes, [&](int start, int end)
     {
-        for(int z = 0; z < input_depth; ++z)
+        for(int plane = start; plane < end; ++plane)
         {
-            for(unsigned int m = 0; m < depth_multiplier; ++m)
-            {
-                const int     out_z    = z * depth_multiplier + m;
-                const int32_t bias_val = *static_cast<const int32_t *>(biases(Coordinates(out_z)));
+            const int     m        = plane % depth_multiplier;
+            const int     z        = (plane / depth_multiplier) % input_depth;
+            const int     r        = plane / (depth_multiplier * input_depth);
+            const int     out_z    = z * depth_multiplier + m;
+            const int32_t bias_val = *static_cast<const int32_t *>(biases(Coordinates(out_z)));
+
+            int out_pos = plane * num_x * num_y;
 
-                for(int y = minimum_y; y <= minimum_y + maximum_y; y += conv_info.stride().second)
+            for(int y = minimum_y; y <= minimum_y + maximum_y; y += conv_info.stride().second)
+            {
+                for(int x = minimum_x; x <= minimum_x + maximum_x; x += conv_info.stride().first)
                 {
-                    for(int x = minimum_x; x <= minimum_x + maximum_x; x += conv_info.stride().first)
-                    {
-                        Coordinates coords(x, y, z, r);
-                        int         filter_offset = filter_plane * out_z;
+                    Coordinates coords(x, y, z, r);
+                    int         filter_offset = filter_plane * out_z;
 
-                        int32_t val = 0;
-                        for(int j = y - patch_half_height_floor; j < y + patch_half_height_ceil; j += dilation.y())
+                    int32_t val = 0;
+                    for(int j = y - patch_half_height_floor; j < y + patch_half_height_ceil; j += dilation.y())
+                    {
+                        for(int i = x - patch_half_width_floor; i < x + patch_half_width_ceil; i += dilation.x())
                         {
-                            for(int i = x - patch_half_width_floor; i < x + patch_half_width_ceil; i += dilation.x())
-                            {
-                                coords.set(0, i);
-                                coords.set(1, j);
-                                const auto    in_val = tensor_elem_at<uint8_t>(src, coords, BorderMode::CONSTANT, -input_offset);
-                                const uint8_t w_val  = *(weights.data() + filter_offset);
-                                val += (in_val + input_offset) * (w_val + weights_offset);
-                                ++filter_offset;
-                            }
+                            coords.set(0, i);
+                            coords.set(1, j);
+                            const auto    in_val = tensor_elem_at<uint8_t>(src, coords, BorderMode::CONSTANT, -input_offset);
+                            const uint8_t w_val  = *(weights.data() + filter_offset);
+                            val += (in_val + input_offset) * (w_val + weights_offset);
+                            ++filter_offset;
                         }
-                        val += bias_val;
-                        val = asymm_rounding_divide_by_pow2(asymm_int_mult(val, output_multiplier), output_shift);
-                        val += output_offset;
-                        val = std::max<int32_t>(val, 0);
-                        val = std::min<int32_t>(val, 255);
-
-                        // Store the result
-                        dst[out_pos++] = val;
                     }
+                    val += bias_val;
+                    val = asymm_rounding_divide_by_pow2(asymm_int_mult(val, output_multiplier), output_shift);
+                    val += output_offset;
+                    val = std::max<int32_t>(val, 0);
+                    val = std::min<int32_t>(val, 255);
+
+                    // Store the result
+                    dst[out_pos++] = val;
                 }
             }
         }
-    }
+    });
 
     return dst;
 }
@@ -25,6 +25,8 @@
 
 #include "arm_compute/core/Types.h"
 
+#include "tests/validation/reference/Parallel.h"
+
 namespace arm_compute
 {
 namespace test
@@ -55,31 +57,33 @@ SimpleTensor<T> gemm(const SimpleTensor<T> &a, const SimpleTensor<T> &b, const S
     const int c_stride_z = N * M;
     const int c_stride_w = N * M * D;
 
-    for(int w = 0; w < W; ++w)
+    // Each work item computes one row of one matrix of the batch
+    parallel_for(W * D * M, [&](int start, int end)
     {
-        for(int depth = 0; depth < D; ++depth)
+        for(int i = start; i < end; ++i)
         {
+            const int row   = i % M;
+            const int depth = (i / M) % D;
+            const int w     = i / (M * D);
+
             const int base_addr_a = depth * a_stride_z + w * a_stride_w;
             const int base_addr_b = depth * b_stride_z + w * b_stride_w;
             const int base_addr_c = depth * c_stride_z + w * c_stride_w;
 
-            for(int row = 0; row < M; ++row)
+            for(int col = 0; col < N; ++col)
             {
-                for(int col = 0; col < N; ++col)
-                {
-                    T acc(0);
+                T acc(0);
 
-                    for(int k = 0; k < K; ++k)
-                    {
-                        acc += a[base_addr_a + k + row * K] * b[base_addr_b + col + k * N];
-                    }
-
-                    // Finalize the result: alpha * A * B + beta * C
-                    dst[base_addr_c + col + row * N] = alpha * acc + beta * c[base_addr_c + col + row * N];
+                for(int k = 0; k < K; ++k)
+                {
+                    acc += a[base_addr_a + k + row * K] * b[base_addr_b + col + k * N];
                 }
+
+                // Finalize the result: alpha * A * B + beta * C
+                dst[base_addr_c + col + row * N] = alpha * acc + beta * c[base_addr_c + col + row * N];
             }
         }
-    }
+    });
 
     return dst;
 }
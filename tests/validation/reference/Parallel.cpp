@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Parallel.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <exception>
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+/** True on the threads currently processing chunks, to run the nested calls sequentially */
+thread_local bool in_parallel_region = false;
+
+/** Pool of worker threads processing the chunks of a range along with the calling thread */
+class ThreadPool final
+{
+public:
+    /** Default constructor: uses all the cores of the system */
+    ThreadPool()
+    {
+        start(0);
+    }
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ThreadPool(const ThreadPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    /** Destructor: joins the worker threads */
+    ~ThreadPool()
+    {
+        stop();
+    }
+    /** Access the pool shared by the reference implementations
+     *
+     * @return The thread pool
+     */
+    static ThreadPool &get()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+    /** Restart the pool with a new number of threads
+     *
+     * @param[in] num_threads Number of threads including the calling thread. If 0 the number of cores of the system is used.
+     */
+    void set_num_threads(unsigned int num_threads)
+    {
+        std::lock_guard<std::mutex> lock(_run_mtx);
+        stop();
+        start(num_threads);
+    }
+    /** Number of threads including the calling thread
+     *
+     * @return The number of threads
+     */
+    unsigned int num_threads() const
+    {
+        return static_cast<unsigned int>(_workers.size()) + 1;
+    }
+    /** Process a range, see @ref parallel_for */
+    void run(int size, const std::function<void(int, int)> &func)
+    {
+        std::lock_guard<std::mutex> lock(_run_mtx);
+
+        // A few chunks per thread balance the work items of uneven cost
+        _func       = &func;
+        _size       = size;
+        _num_chunks = std::min(size, static_cast<int>(num_threads()) * 4);
+        _next_chunk = 0;
+        _error      = nullptr;
+        {
+            std::lock_guard<std::mutex> state_lock(_mtx);
+            _num_active = static_cast<int>(_workers.size());
+            ++_generation;
+        }
+        _work_cv.notify_all();
+
+        process_chunks();
+
+        std::unique_lock<std::mutex> state_lock(_mtx);
+        _done_cv.wait(state_lock, [this]()
+        {
+            return _num_active == 0;
+        });
+        if(_error != nullptr)
+        {
+            std::rethrow_exception(_error);
+        }
+    }
+
+private:
+    /** Create the worker threads
+     *
+     * @param[in] num_threads Number of threads including the calling thread. If 0 the number of cores of the system is used.
+     */
+    void start(unsigned int num_threads)
+    {
+        if(num_threads == 0)
+        {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        _stop = false;
+        for(unsigned int i = 1; i < num_threads; ++i)
+        {
+            _workers.emplace_back(&ThreadPool::worker_loop, this, _generation);
+        }
+    }
+    /** Join and destroy the worker threads */
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> state_lock(_mtx);
+            _stop = true;
+        }
+        _work_cv.notify_all();
+        for(auto &worker : _workers)
+        {
+            worker.join();
+        }
+        _workers.clear();
+    }
+    /** Main loop of the worker threads
+     *
+     * @param[in] generation Generation of the last range processed when the worker was created
+     */
+    void worker_loop(unsigned int generation)
+    {
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> state_lock(_mtx);
+                _work_cv.wait(state_lock, [&]()
+                {
+                    return _stop || _generation != generation;
+                });
+                if(_stop)
+                {
+                    return;
+                }
+                generation = _generation;
+            }
+
+            process_chunks();
+
+            std::lock_guard<std::mutex> state_lock(_mtx);
+            if(--_num_active == 0)
+            {
+                _done_cv.notify_one();
+            }
+        }
+    }
+    /** Process chunks of the current range until there are none left */
+    void process_chunks()
+    {
+        in_parallel_region = true;
+        for(int chunk = _next_chunk++; chunk < _num_chunks; chunk = _next_chunk++)
+        {
+            const int start = static_cast<int>(static_cast<long long>(_size) * chunk / _num_chunks);
+            const int end   = static_cast<int>(static_cast<long long>(_size) * (chunk + 1) / _num_chunks);
+            try
+            {
+                (*_func)(start, end);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> state_lock(_mtx);
+                if(_error == nullptr)
+                {
+                    _error = std::current_exception();
+                }
+            }
+        }
+        in_parallel_region = false;
+    }
+
+    std::vector<std::thread>             _workers{};
+    std::mutex                           _run_mtx{};
+    std::mutex                           _mtx{};
+    std::condition_variable              _work_cv{};
+    std::condition_variable              _done_cv{};
+    const std::function<void(int, int)> *_func{ nullptr };
+    int                                  _size{ 0 };
+    int                                  _num_chunks{ 0 };
+    std::atomic<int>                     _next_chunk{ 0 };
+    int                                  _num_active{ 0 };
+    unsigned int                         _generation{ 0 };
+    bool                                 _stop{ false };
+    std::exception_ptr                   _error{ nullptr };
+};
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+} // namespace
+
+void set_num_threads(unsigned int num_threads)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    ThreadPool::get().set_num_threads(num_threads);
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(num_threads);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+unsigned int num_threads()
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    return ThreadPool::get().num_threads();
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    return 1;
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+void parallel_for(int size, const std::function<void(int start, int end)> &func)
+{
+    if(size <= 0)
+    {
+        return;
+    }
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+    ThreadPool &pool = ThreadPool::get();
+    if(!in_parallel_region && size > 1 && pool.num_threads() > 1)
+    {
+        pool.run(size, func);
+        return;
+    }
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+    func(0, size);
+}
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TEST_PARALLEL_H__
+#define __ARM_COMPUTE_TEST_PARALLEL_H__
+
+#include <functional>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Set the number of threads used by the reference implementations
+ *
+ * @param[in] num_threads Number of threads. If 0 the number of cores of the system is used.
+ */
+void set_num_threads(unsigned int num_threads);
+/** Get the number of threads used by the reference implementations
+ *
+ * @return The number of threads, including the calling thread
+ */
+unsigned int num_threads();
+/** Run a function on the chunks of a range of independent work items using the threads of the reference implementations
+ *
+ * The range is split into contiguous chunks processed concurrently, so @p func must only write the outputs of its work items.
+ * Nested calls made from @p func are executed sequentially by the calling thread.
+ *
+ * @note The first exception raised by @p func is rethrown once all the chunks are processed.
+ * @note @p func must not use the test framework asserts as they modify the state of the framework.
+ *
+ * @param[in] size Number of work items
+ * @param[in] func Function processing the work items [start, end)
+ */
+void parallel_for(int size, const std::function<void(int start, int end)> &func);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_TEST_PARALLEL_H__ */
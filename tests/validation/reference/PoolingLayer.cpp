@@ -26,6 +26,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "tests/validation/Helpers.h"
+#include "tests/validation/reference/Parallel.h"
 
 namespace arm_compute
 {
@@ -66,87 +67,95 @@ SimpleTensor<T> pooling_layer(const SimpleTensor<T> &src, const PoolingLayerInfo
 
     if(type == PoolingType::MAX)
     {
-        for(int r = 0; r < upper_dims; ++r)
+        // Each work item computes one output plane
+        parallel_for(upper_dims, [&](int start, int end)
         {
-            for(int h = 0; h < h_dst; ++h)
+            for(int r = start; r < end; ++r)
             {
-                for(int w = 0; w < w_dst; ++w)
+                for(int h = 0; h < h_dst; ++h)
                 {
-                    int wstart = w * pool_stride_x - pad_left;
-                    int hstart = h * pool_stride_y - pad_top;
-                    int wend   = std::min(wstart + pool_size_x, w_src);
-                    int hend   = std::min(hstart + pool_size_y, h_src);
-                    wstart     = std::max(wstart, 0);
-                    hstart     = std::max(hstart, 0);
-
-                    T max_val = std::numeric_limits<T>::lowest();
-                    for(int y = hstart; y < hend; ++y)
+                    for(int w = 0; w < w_dst; ++w)
                     {
-                        for(int x = wstart; x < wend; ++x)
+                        int wstart = w * pool_stride_x - pad_left;
+                        int hstart = h * pool_stride_y - pad_top;
+                        int wend   = std::min(wstart + pool_size_x, w_src);
+                        int hend   = std::min(hstart + pool_size_y, h_src);
+                        wstart     = std::max(wstart, 0);
+                        hstart     = std::max(hstart, 0);
+
+                        T max_val = std::numeric_limits<T>::lowest();
+                        for(int y = hstart; y < hend; ++y)
                         {
-                            const T val = src[r * h_src * w_src + y * w_src + x];
-                            if(val > max_val)
+                            for(int x = wstart; x < wend; ++x)
                             {
-                                max_val = val;
+                                const T val = src[r * h_src * w_src + y * w_src + x];
+                                if(val > max_val)
+                                {
+                                    max_val = val;
+                                }
                             }
                         }
-                    }
 
-                    dst[r * h_dst * w_dst + h * w_dst + w] = max_val;
+                        dst[r * h_dst * w_dst + h * w_dst + w] = max_val;
+                    }
                 }
             }
-        }
+        });
     }
     else // Average or l2 pooling
     {
-        for(int r = 0; r < upper_dims; ++r)
+        // Each work item computes one output plane
+        parallel_for(upper_dims, [&](int start, int end)
         {
-            for(int h = 0; h < h_dst; ++h)
+            for(int r = start; r < end; ++r)
             {
-                for(int w = 0; w < w_dst; ++w)
+                for(int h = 0; h < h_dst; ++h)
                 {
-                    T   avg_val(0);
-                    int wstart = w * pool_stride_x - pad_left;
-                    int hstart = h * pool_stride_y - pad_top;
-                    int wend   = std::min(wstart + pool_size_x, w_src + pad_right);
-                    int hend   = std::min(hstart + pool_size_y, h_src + pad_bottom);
-                    int pool   = (hend - hstart) * (wend - wstart);
-                    wstart     = std::max(wstart, 0);
-                    hstart     = std::max(hstart, 0);
-                    wend       = std::min(wend, w_src);
-                    hend       = std::min(hend, h_src);
-                    // Exclude padding pixels from the average
-                    if(exclude_padding)
+                    for(int w = 0; w < w_dst; ++w)
                     {
-                        pool = (hend - hstart) * (wend - wstart);
-                    }
+                        T   avg_val(0);
+                        int wstart = w * pool_stride_x - pad_left;
+                        int hstart = h * pool_stride_y - pad_top;
+                        int wend   = std::min(wstart + pool_size_x, w_src + pad_right);
+                        int hend   = std::min(hstart + pool_size_y, h_src + pad_bottom);
+                        int pool   = (hend - hstart) * (wend - wstart);
+                        wstart     = std::max(wstart, 0);
+                        hstart     = std::max(hstart, 0);
+                        wend       = std::min(wend, w_src);
+                        hend       = std::min(hend, h_src);
+                        // Exclude padding pixels from the average
+                        if(exclude_padding)
+                        {
+                            pool = (hend - hstart) * (wend - wstart);
+                        }
 
-                    if(type == PoolingType::AVG)
-                    {
-                        for(int y = hstart; y < hend; ++y)
+                        if(type == PoolingType::AVG)
                         {
-                            for(int x = wstart; x < wend; ++x)
+                            for(int y = hstart; y < hend; ++y)
                             {
-                                avg_val += src[r * h_src * w_src + y * w_src + x];
+                                for(int x = wstart; x < wend; ++x)
+                                {
+                                    avg_val += src[r * h_src * w_src + y * w_src + x];
+                                }
                             }
+                            dst[r * h_dst * w_dst + h * w_dst + w] = avg_val / pool;
                         }
-                        dst[r * h_dst * w_dst + h * w_dst + w] = avg_val / pool;
-                    }
-                    else
-                    {
-                        for(int y = hstart; y < hend; ++y)
+                        else
                         {
-                            for(int x = wstart; x < wend; ++x)
+                            for(int y = hstart; y < hend; ++y)
                             {
-                                const T val = src[r * h_src * w_src + y * w_src + x];
-                                avg_val += val * val;
+                                for(int x = wstart; x < wend; ++x)
+                                {
+                                    const T val = src[r * h_src * w_src + y * w_src + x];
+                                    avg_val += val * val;
+                                }
                             }
+                            dst[r * h_dst * w_dst + h * w_dst + w] = std::sqrt(avg_val / pool);
                         }
-                        dst[r * h_dst * w_dst + h * w_dst + w] = std::sqrt(avg_val / pool);
                     }
                 }
             }
-        }
+        });
     }
 
     return dst;
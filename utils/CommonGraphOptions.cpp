@@ -79,6 +79,7 @@ namespace utils
     std::string true_str  = std::string("true");
 
     os << "Threads : " << common_params.threads << std::endl;
+    os << "Concurrent branches : " << common_params.branches << std::endl;
     os << "Target : " << common_params.target << std::endl;
     os << "Data type : " << common_params.data_type << std::endl;
     os << "Data layout : " << common_params.data_layout << std::endl;
@@ -114,6 +115,7 @@ namespace utils
 CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       threads(parser.add_option<SimpleOption<int>>("threads", 1)),
+      branches(parser.add_option<SimpleOption<int>>("branches", 1)),
       target(),
       data_type(),
       data_layout(),
@@ -162,10 +164,11 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
 
     help->set_help("Show this help message");
     threads->set_help("Number of threads to use");
+    branches->set_help("Maximum number of independent branches to execute concurrently");
     target->set_help("Target to execute on");
     data_type->set_help("Data type to use");
     data_layout->set_help("Data layout to use");
-    enable_tuner->set_help("Enable OpenCL dynamic tuner");
+    enable_tuner->set_help("Enable OpenCL dynamic tuner and NEON convolution method tuner");
     tuner_mode->set_help("Configures the time taken by the tuner to tune. Slow tuner produces the most performant LWS configuration");
     fast_math_hint->set_help("Enable fast math");
     data_path->set_help("Path where graph parameters reside");
@@ -185,6 +188,7 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     CommonGraphParams common_params;
     common_params.help      = options.help->is_set() ? options.help->value() : false;
     common_params.threads   = options.threads->value();
+    common_params.branches  = options.branches->value();
     common_params.target    = options.target->value();
     common_params.data_type = options.data_type->value();
     if(options.data_layout->is_set())
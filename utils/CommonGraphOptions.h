@@ -40,10 +40,11 @@ namespace utils
  *
  * --help             : Print the example's help message.
  * --threads          : The number of threads to be used by the example during execution.
+ * --branches         : The maximum number of independent branches of the graph to execute concurrently (NEON only).
  * --target           : Execution target to be used by the examples. Supported target options: NEON, CL, GC.
  * --type             : Data type to be used by the examples. Supported data type options: QASYMM8, F16, F32.
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
- * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
+ * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner and the NEON convolution method tuner.
  * --fast-math        : Toggle option to enable the fast math option.
  * --data             : Path that contains the trainable parameter files of graph layers.
  * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
@@ -90,6 +91,7 @@ struct CommonGraphParams
 {
     bool                             help{ false };
     int                              threads{ 0 };
+    int                              branches{ 1 };
     arm_compute::graph::Target       target{ arm_compute::graph::Target::NEON };
     arm_compute::DataType            data_type{ DataType::F32 };
     arm_compute::DataLayout          data_layout{ DataLayout::NHWC };
@@ -145,6 +147,7 @@ public:
 
     ToggleOption                           *help;             /**< Show help option */
     SimpleOption<int>                      *threads;          /**< Number of threads option */
+    SimpleOption<int>                      *branches;         /**< Number of concurrent branches option */
     EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
     EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
     EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
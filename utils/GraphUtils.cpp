@@ -683,7 +683,7 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
 }
 
 NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _mapped_file()
 {
 }
 
@@ -693,7 +693,49 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
-        loader.fill_tensor(tensor);
+
+        // Alias the tensor to the mapped file when possible to avoid copying the weights
+        auto *host_tensor = dynamic_cast<Tensor *>(&tensor);
+        if(host_tensor != nullptr)
+        {
+            _mapped_file = support::cpp14::make_unique<utils::MMappedFile>();
+            if(!_mapped_file->map(_filename) || !loader.import_tensor(*host_tensor, *_mapped_file))
+            {
+                _mapped_file = nullptr;
+            }
+        }
+        if(_mapped_file == nullptr)
+        {
+            loader.fill_tensor(tensor);
+        }
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+PackedWeightsAccessor::PackedWeightsAccessor(std::shared_ptr<utils::PackedWeightsFile> file, std::string name)
+    : _already_loaded(false), _file(std::move(file)), _name(std::move(name))
+{
+    ARM_COMPUTE_ERROR_ON(_file == nullptr);
+}
+
+bool PackedWeightsAccessor::access_tensor(ITensor &tensor)
+{
+    if(!_already_loaded)
+    {
+        const utils::PackedWeightsFile::Entry *entry = _file->find(_name);
+        ARM_COMPUTE_EXIT_ON_MSG(entry == nullptr, "Tensor %s not found in %s", _name.c_str(), _file->filename().c_str());
+
+        // Alias the tensor to the container mapping when possible to avoid copying the weights
+        auto *host_tensor = dynamic_cast<Tensor *>(&tensor);
+        if(host_tensor == nullptr
+           || !utils::import_npy_data(*host_tensor, _file->mapping(), entry->data_offset, entry->shape, entry->fortran_order, entry->typestring, entry->data_layout))
+        {
+            utils::NPYLoader loader;
+            loader.open(_file->filename(), entry->data_layout, entry->npy_offset);
+            loader.fill_tensor(tensor);
+        }
     }
 
     _already_loaded = !_already_loaded;
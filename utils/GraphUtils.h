@@ -33,8 +33,10 @@
 #include "arm_compute/runtime/Tensor.h"
 
 #include "utils/CommonGraphOptions.h"
+#include "utils/Utils.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -368,7 +370,11 @@ private:
     std::random_device::result_type _seed;
 };
 
-/** Numpy Binary loader class*/
+/** Numpy Binary loader class
+ *
+ * @note Tensors with the layout of the file and no padding are aliased to a private memory mapping of the file,
+ *       which is kept alive as long as the accessor. Other tensors are filled with a copy of the file content.
+ */
 class NumPyBinLoader final : public graph::ITensorAccessor
 {
 public:
@@ -385,9 +391,36 @@ public:
     bool access_tensor(ITensor &tensor) override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    bool                                _already_loaded;
+    const std::string                   _filename;
+    const DataLayout                    _file_layout;
+    std::unique_ptr<utils::MMappedFile> _mapped_file;
+};
+
+/** Packed weights container accessor class
+ *
+ * @note Tensors with the layout of the container data and no padding are aliased to the container mapping,
+ *       other tensors are filled with a copy of the data.
+ */
+class PackedWeightsAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] file Container holding the tensor
+     * @param[in] name Name of the tensor in the container
+     */
+    PackedWeightsAccessor(std::shared_ptr<utils::PackedWeightsFile> file, std::string name);
+    /** Allows instances to move constructed */
+    PackedWeightsAccessor(PackedWeightsAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool                                      _already_loaded;
+    std::shared_ptr<utils::PackedWeightsFile> _file;
+    const std::string                         _name;
 };
 
 /** Generates appropriate random accessor
@@ -403,13 +436,27 @@ inline std::unique_ptr<graph::ITensorAccessor> get_random_accessor(PixelValue lo
     return arm_compute::support::cpp14::make_unique<RandomAccessor>(lower, upper, seed);
 }
 
+/** Generates a weights accessor reading a tensor from a packed weights container
+ *
+ * @param[in] file Container holding the tensor
+ * @param[in] name Name of the tensor in the container
+ *
+ * @return A packed weights accessor
+ */
+inline std::unique_ptr<graph::ITensorAccessor> get_packed_weights_accessor(std::shared_ptr<utils::PackedWeightsFile> file, const std::string &name)
+{
+    return arm_compute::support::cpp14::make_unique<PackedWeightsAccessor>(std::move(file), name);
+}
+
 /** Generates appropriate weights accessor according to the specified path
  *
- * @note If path is empty will generate a DummyAccessor else will generate a NumPyBinLoader
+ * @note If path is empty will generate a DummyAccessor, if path is in a packed weights container will generate a PackedWeightsAccessor
+ *       else will generate a NumPyBinLoader
  *
- * @param[in] path        Path to the data files
+ * @param[in] path        Path to the data files, or to a packed weights container optionally followed by a directory inside it
+ *                        (e.g. "model.pack/cnn_data/alexnet_model/")
  * @param[in] data_file   Relative path to the data files from path
- * @param[in] file_layout (Optional) Layout of file. Defaults to NCHW
+ * @param[in] file_layout (Optional) Layout of file. Defaults to NCHW. Ignored for containers, which record the layout of each tensor
  *
  * @return An appropriate tensor accessor
  */
@@ -417,10 +464,16 @@ inline std::unique_ptr<graph::ITensorAccessor> get_weights_accessor(const std::s
                                                                     const std::string &data_file,
                                                                     DataLayout         file_layout = DataLayout::NCHW)
 {
+    std::string container;
+    std::string prefix;
     if(path.empty())
     {
         return arm_compute::support::cpp14::make_unique<DummyAccessor>();
     }
+    else if(utils::PackedWeightsFile::split_path(path, container, prefix))
+    {
+        return get_packed_weights_accessor(utils::PackedWeightsFile::open_shared(container), prefix + data_file);
+    }
     else
     {
         return arm_compute::support::cpp14::make_unique<NumPyBinLoader>(path + data_file, file_layout);
@@ -26,8 +26,16 @@
 #include <cctype>
 #include <cerrno>
 #include <iomanip>
+#include <mutex>
 #include <string>
 
+#ifndef BARE_METAL
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* BARE_METAL */
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-default"
 #define STB_IMAGE_IMPLEMENTATION
@@ -40,6 +48,31 @@ namespace utils
 {
 namespace
 {
+constexpr char     packed_weights_magic[] = "ACLWPACK";
+constexpr uint32_t packed_weights_version = 1;
+
+/** Read a little endian integer from a stream */
+template <typename T>
+T read_le(std::ifstream &fs)
+{
+    uint8_t bytes[sizeof(T)];
+    fs.read(reinterpret_cast<char *>(bytes), sizeof(T));
+    T value = 0;
+    for(size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+/** Read a string prefixed by its uint32 length from a stream */
+std::string read_string(std::ifstream &fs)
+{
+    std::string str(read_le<uint32_t>(fs), '\0');
+    fs.read(&str[0], str.size());
+    return str;
+}
+
 /* Advance the iterator to the first character which is not a comment
  *
  * @param[in,out] fs Stream to drop comments from
@@ -267,5 +300,201 @@ uint64_t get_mem_free_from_meminfo()
     // Nothing found or an error during opening the file
     return 0;
 }
+
+bool import_npy_data(Tensor &tensor, const MMappedFile &file, size_t data_offset, const std::vector<unsigned long> &shape, bool fortran_order, const std::string &typestring, DataLayout file_layout) //NOLINT
+{
+    const ITensorInfo *info         = tensor.info();
+    const size_t       element_size = info->element_size();
+    const bool         same_layout  = (file_layout == info->data_layout()) || (info->num_dimensions() <= 2);
+    if(!file.is_mapped() || fortran_order || !same_layout || !info->padding().empty() || typestring != get_typestring(info->data_type())
+       || (data_offset % element_size) != 0 || file.size() < data_offset + info->total_size())
+    {
+        return false;
+    }
+
+    // Ignore the trailing dimensions of size 1 (Needs to match TensorShape dimension corrections)
+    std::vector<unsigned long> trimmed_shape(shape); // NOLINT
+    while(trimmed_shape.size() > info->num_dimensions() && trimmed_shape.back() == 1)
+    {
+        trimmed_shape.pop_back();
+    }
+    if(trimmed_shape.size() != info->num_dimensions())
+    {
+        return false;
+    }
+    for(size_t i = 0; i < trimmed_shape.size(); ++i)
+    {
+        if(trimmed_shape[i] != info->dimension(i))
+        {
+            return false;
+        }
+    }
+
+    return bool(tensor.allocator()->import_memory(file.data() + data_offset));
+}
+
+MMappedFile::MMappedFile()
+    : _data(nullptr), _size(0)
+{
+}
+
+MMappedFile::~MMappedFile()
+{
+    unmap();
+}
+
+bool MMappedFile::map(const std::string &filename)
+{
+    unmap();
+#ifndef BARE_METAL
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat;
+    if(::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+    {
+        // Private writable mapping: functions fusing data in the weights in place trigger a copy of the touched pages only
+        void *data = ::mmap(nullptr, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            _data = static_cast<uint8_t *>(data);
+            _size = static_cast<size_t>(file_stat.st_size);
+        }
+    }
+    ::close(fd);
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(filename);
+#endif /* BARE_METAL */
+    return is_mapped();
+}
+
+void MMappedFile::unmap()
+{
+#ifndef BARE_METAL
+    if(_data != nullptr)
+    {
+        ::munmap(_data, _size);
+    }
+#endif /* BARE_METAL */
+    _data = nullptr;
+    _size = 0;
+}
+
+PackedWeightsFile::PackedWeightsFile(std::string filename)
+    : _filename(std::move(filename)), _file(), _entries()
+{
+    std::ifstream fs;
+    try
+    {
+        fs.open(_filename, std::ios::in | std::ios::binary);
+        ARM_COMPUTE_EXIT_ON_MSG(!fs.good(), "Failed to open weights container %s", _filename.c_str());
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+        char magic[sizeof(packed_weights_magic) - 1];
+        fs.read(magic, sizeof(magic));
+        ARM_COMPUTE_EXIT_ON_MSG(std::memcmp(magic, packed_weights_magic, sizeof(magic)) != 0, "%s is not a weights container", _filename.c_str());
+        const uint32_t version = read_le<uint32_t>(fs);
+        ARM_COMPUTE_EXIT_ON_MSG(version != packed_weights_version, "Unsupported weights container version %u", version);
+
+        const uint32_t num_entries = read_le<uint32_t>(fs);
+        for(uint32_t i = 0; i < num_entries; ++i)
+        {
+            Entry             entry;
+            const std::string name = read_string(fs);
+            entry.typestring       = read_string(fs);
+            entry.fortran_order    = read_le<uint8_t>(fs) != 0;
+            entry.data_layout      = (read_le<uint8_t>(fs) == 0) ? DataLayout::NCHW : DataLayout::NHWC;
+            read_le<uint16_t>(fs);
+
+            const uint32_t num_dims = read_le<uint32_t>(fs);
+            for(uint32_t d = 0; d < num_dims; ++d)
+            {
+                entry.shape.push_back(read_le<uint64_t>(fs));
+            }
+            // Dimensions are stored in numpy order
+            std::reverse(entry.shape.begin(), entry.shape.end());
+
+            entry.npy_offset  = read_le<uint64_t>(fs);
+            entry.data_offset = read_le<uint64_t>(fs);
+            entry.data_size   = read_le<uint64_t>(fs);
+            entry.alignment   = read_le<uint32_t>(fs);
+
+            _entries.emplace(name, std::move(entry));
+        }
+    }
+    catch(const std::ifstream::failure &e)
+    {
+        ARM_COMPUTE_ERROR("Accessing %s: %s", _filename.c_str(), e.what());
+    }
+
+    // Tensors fall back to reading the embedded NPY files if the container cannot be mapped
+    _file.map(_filename);
+}
+
+bool PackedWeightsFile::is_packed_weights_file(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    char          magic[sizeof(packed_weights_magic) - 1];
+    return fs.read(magic, sizeof(magic)) && std::memcmp(magic, packed_weights_magic, sizeof(magic)) == 0;
+}
+
+bool PackedWeightsFile::split_path(const std::string &path, std::string &container, std::string &prefix)
+{
+    std::string candidate = path;
+#ifndef BARE_METAL
+    // Strip the components of the path until reaching one which exists
+    struct stat st;
+    while(!candidate.empty() && ::stat(candidate.c_str(), &st) != 0)
+    {
+        const size_t last = candidate.find_last_of('/');
+        candidate.erase(last == std::string::npos ? 0 : last);
+        candidate.erase(candidate.find_last_not_of('/') + 1);
+    }
+    if(candidate.empty() || !S_ISREG(st.st_mode))
+    {
+        return false;
+    }
+#endif /* BARE_METAL */
+    if(!is_packed_weights_file(candidate))
+    {
+        return false;
+    }
+    container = candidate;
+    prefix    = path.substr(candidate.size());
+    return true;
+}
+
+std::shared_ptr<PackedWeightsFile> PackedWeightsFile::open_shared(const std::string &filename)
+{
+    static std::mutex                                               mtx;
+    static std::map<std::string, std::weak_ptr<PackedWeightsFile>> opened_files;
+
+    std::lock_guard<std::mutex>        lock(mtx);
+    std::shared_ptr<PackedWeightsFile> file = opened_files[filename].lock();
+    if(file == nullptr)
+    {
+        file                   = std::make_shared<PackedWeightsFile>(filename);
+        opened_files[filename] = file;
+    }
+    return file;
+}
+
+const PackedWeightsFile::Entry *PackedWeightsFile::find(const std::string &name) const
+{
+    // Ignore the leading and repeated separators, which appear when joining paths
+    std::string key;
+    for(const char c : name)
+    {
+        if(c != '/' || (!key.empty() && key.back() != '/'))
+        {
+            key += c;
+        }
+    }
+    const auto it = _entries.find(key);
+    return (it != _entries.end()) ? &it->second : nullptr;
+}
 } // namespace utils
 } // namespace arm_compute
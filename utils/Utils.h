@@ -42,10 +42,13 @@
 #include "arm_compute/runtime/GLES_COMPUTE/GCTensor.h"
 #endif /* ARM_COMPUTE_GC */
 
+#include <array>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <random>
 #include <string>
 #include <tuple>
@@ -140,6 +143,57 @@ std::tuple<unsigned int, unsigned int, int> parse_ppm_header(std::ifstream &fs);
  */
 std::tuple<std::vector<unsigned long>, bool, std::string> parse_npy_header(std::ifstream &fs);
 
+/** Private memory mapping of a file
+ *
+ * The mapping is copy-on-write: the file is never modified through it.
+ */
+class MMappedFile
+{
+public:
+    /** Default constructor */
+    MMappedFile();
+    /** Destructor: unmaps the file */
+    ~MMappedFile();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MMappedFile(const MMappedFile &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MMappedFile &operator=(const MMappedFile &) = delete;
+    /** Maps a file in memory
+     *
+     * @param[in] filename File to map
+     *
+     * @return True if the file was mapped, false otherwise
+     */
+    bool map(const std::string &filename);
+    /** Unmaps the file */
+    void unmap();
+    /** Return true if a file is currently mapped */
+    bool is_mapped() const
+    {
+        return _data != nullptr;
+    }
+    /** Returns the mapped file content
+     *
+     * @return Pointer to the beginning of the mapped file
+     */
+    uint8_t *data() const
+    {
+        return _data;
+    }
+    /** Returns the size of the mapped file
+     *
+     * @return Size of the mapped file in bytes
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    uint8_t *_data;
+    size_t   _size;
+};
+
 /** Obtain numpy type string from DataType.
  *
  * @param[in] data_type Data type.
@@ -314,13 +368,29 @@ public:
     }
 };
 
+/** Alias a tensor to NPY data mapped in memory
+ *
+ * @note The tensor is only aliased if it has the data layout of the file, no padding, and the data is in C order.
+ *
+ * @param[in,out] tensor        Tensor to alias
+ * @param[in]     file          Memory mapping of the file containing the NPY data
+ * @param[in]     data_offset   Offset in bytes of the NPY data in the file
+ * @param[in]     shape         Shape of the NPY data, as returned by @ref parse_npy_header
+ * @param[in]     fortran_order True if the NPY data is in fortran order
+ * @param[in]     typestring    Typestring of the NPY data
+ * @param[in]     file_layout   Layout in which the weights are stored in the file
+ *
+ * @return True if the tensor was aliased to the mapped file, false otherwise
+ */
+bool import_npy_data(Tensor &tensor, const MMappedFile &file, size_t data_offset, const std::vector<unsigned long> &shape, bool fortran_order, const std::string &typestring, DataLayout file_layout); //NOLINT
+
 /** Numpy data loader */
 class NPYLoader
 {
 public:
     /** Default constructor */
     NPYLoader()
-        : _fs(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
+        : _fs(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW), _data_offset(0)
     {
     }
 
@@ -328,8 +398,9 @@ public:
      *
      * @param[in] npy_filename File to open
      * @param[in] file_layout  (Optional) Layout in which the weights are stored in the file.
+     * @param[in] offset       (Optional) Offset in bytes of the NPY header in the file, used for NPY files embedded in a @ref PackedWeightsFile.
      */
-    void open(const std::string &npy_filename, DataLayout file_layout = DataLayout::NCHW)
+    void open(const std::string &npy_filename, DataLayout file_layout = DataLayout::NCHW, size_t offset = 0)
     {
         ARM_COMPUTE_ERROR_ON(is_open());
         try
@@ -337,9 +408,11 @@ public:
             _fs.open(npy_filename, std::ios::in | std::ios::binary);
             ARM_COMPUTE_EXIT_ON_MSG(!_fs.good(), "Failed to load binary data from %s", npy_filename.c_str());
             _fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+            _fs.seekg(offset, std::ios_base::beg);
             _file_layout = file_layout;
 
             std::tie(_shape, _fortran_order, _typestring) = parse_npy_header(_fs);
+            _data_offset                                  = _fs.tellg();
         }
         catch(const std::ifstream::failure &e)
         {
@@ -465,8 +538,7 @@ public:
                     }
                     else
                     {
-                        // If tensor has padding or is in fortran order accessing tensor elements through execution window.
-                        Window             window;
+                        // If tensor has padding or is in fortran order read the file at once and permute it in blocks
                         const unsigned int num_dims = _shape.size();
                         if(_fortran_order)
                         {
@@ -491,14 +563,10 @@ public:
                                 }
                             }
                         }
-                        window.use_tensor_dimensions(permuted_shape);
+                        std::vector<char> file_data(permuted_shape.total_size() * tensor.info()->element_size());
+                        _fs.read(file_data.data(), file_data.size());
 
-                        execute_window_loop(window, [&](const Coordinates & id)
-                        {
-                            Coordinates dst(id);
-                            arm_compute::permute(dst, perm);
-                            _fs.read(reinterpret_cast<char *>(tensor.ptr_to_element(dst)), tensor.info()->element_size());
-                        });
+                        permute_blocked(file_data.data(), permuted_shape, perm, tensor);
                     }
 
                     break;
@@ -516,12 +584,203 @@ public:
         }
     }
 
+    /** Alias a tensor to the content of the currently open NPY file mapped in memory
+     *
+     * @note The tensor is only aliased if it has the data layout of the file, no padding, and the file is in C order.
+     *
+     * @param[in,out] tensor Tensor to alias (Must be of matching dimensions with the opened NPY).
+     * @param[in]     file   Memory mapping of the currently open NPY file.
+     *
+     * @return True if the tensor was aliased to the mapped file, false if it has to be filled with @ref fill_tensor
+     */
+    bool import_tensor(Tensor &tensor, const MMappedFile &file)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        return import_npy_data(tensor, file, _data_offset, _shape, _fortran_order, _typestring, _file_layout);
+    }
+
 private:
+    /** Copy the content of a file to a tensor, permuting it in blocks
+     *
+     * Rows contiguous in both the file and the tensor are copied at once, otherwise the elements are
+     * transposed in square blocks so that both reads and writes stay in cache.
+     *
+     * @param[in]     src        Content of the file
+     * @param[in]     file_shape Shape of the file content, in the file order
+     * @param[in]     perm       Permutation from the file to the tensor dimensions
+     * @param[in,out] tensor     Tensor to fill
+     */
+    template <typename T>
+    void permute_blocked(const char *src, const TensorShape &file_shape, const PermutationVector &perm, T &tensor)
+    {
+        const size_t     element_size = tensor.info()->element_size();
+        const Strides   &dst_strides  = tensor.info()->strides_in_bytes();
+        const TensorShape dst_shape   = tensor.info()->tensor_shape();
+
+        // Strides of the file content, in bytes
+        Strides src_strides(element_size);
+        for(size_t d = 1; d < file_shape.num_dimensions(); ++d)
+        {
+            src_strides.set(d, src_strides[d - 1] * file_shape[d - 1]);
+        }
+
+        // File dimension of each tensor dimension, and tensor dimension contiguous in the file
+        std::array<size_t, Coordinates::num_max_dimensions> src_dim{ {} };
+        size_t contiguous_dim = 0;
+        for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+        {
+            src_dim[d] = (d < perm.num_dimensions()) ? perm[d] : d;
+            if(src_dim[d] == 0)
+            {
+                contiguous_dim = d;
+            }
+        }
+
+        Window window;
+        window.use_tensor_dimensions(dst_shape);
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+        window.set(contiguous_dim, Window::Dimension(0, 1, 1));
+
+        uint8_t *const dst_base  = tensor.buffer() + tensor.info()->offset_first_element_in_bytes();
+        const size_t   src_x     = src_strides[src_dim[0]];
+        const size_t   src_y     = src_strides[src_dim[contiguous_dim]];
+        const size_t   dst_y     = dst_strides[contiguous_dim];
+        const size_t   dim_x     = dst_shape[0];
+        const size_t   dim_y     = (contiguous_dim == 0) ? 1 : dst_shape[contiguous_dim];
+        const size_t   blk       = 16;
+        const size_t   row_bytes = dim_x * element_size;
+
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            size_t src_offset = 0;
+            size_t dst_offset = 0;
+            for(size_t d = 0; d < dst_shape.num_dimensions(); ++d)
+            {
+                src_offset += id[d] * src_strides[src_dim[d]];
+                dst_offset += id[d] * dst_strides[d];
+            }
+            const char *src_ptr = src + src_offset;
+            uint8_t    *dst_ptr = dst_base + dst_offset;
+
+            if(contiguous_dim == 0)
+            {
+                std::memcpy(dst_ptr, src_ptr, row_bytes);
+                return;
+            }
+
+            for(size_t y0 = 0; y0 < dim_y; y0 += blk)
+            {
+                const size_t y1 = std::min(y0 + blk, dim_y);
+                for(size_t x0 = 0; x0 < dim_x; x0 += blk)
+                {
+                    const size_t x1 = std::min(x0 + blk, dim_x);
+                    for(size_t y = y0; y < y1; ++y)
+                    {
+                        for(size_t x = x0; x < x1; ++x)
+                        {
+                            std::memcpy(dst_ptr + x * element_size + y * dst_y, src_ptr + x * src_x + y * src_y, element_size);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
     std::ifstream              _fs;
     std::vector<unsigned long> _shape;
     bool                       _fortran_order;
     std::string                _typestring;
     DataLayout                 _file_layout;
+    size_t                     _data_offset;
+};
+
+/** Container packing the NPY files of a model in a single file
+ *
+ * The file starts with a header and an index describing each tensor, followed by the NPY files stored verbatim with
+ * their data aligned as requested by the index. The format, all integers being little endian, is:
+ *
+ *  - Header: "ACLWPACK" magic, uint32 version, uint32 number of entries
+ *  - For each entry: uint32 name length, name, uint32 typestring length, typestring, uint8 fortran order,
+ *    uint8 data layout (0: NCHW, 1: NHWC), uint16 reserved, uint32 number of dimensions, uint64 dimensions in numpy order,
+ *    uint64 offset of the NPY header, uint64 offset of the data, uint64 size of the data, uint32 data alignment
+ *
+ * Entries are named by the path of the original NPY file relative to the packed directory, e.g. "cnn_data/alexnet_model/conv1_w.npy".
+ *
+ * @note scripts/npy_weights_packer.py creates such containers from a directory of NPY files.
+ */
+class PackedWeightsFile
+{
+public:
+    /** Description of a tensor stored in the container */
+    struct Entry
+    {
+        std::vector<unsigned long> shape;         /**< Shape of the tensor, in the order returned by @ref parse_npy_header */ // NOLINT
+        bool                       fortran_order; /**< True if the data is in fortran order */
+        std::string                typestring;    /**< Numpy typestring of the data */
+        DataLayout                 data_layout;   /**< Layout in which the data is stored */
+        size_t                     npy_offset;    /**< Offset in bytes of the embedded NPY file */
+        size_t                     data_offset;   /**< Offset in bytes of the data */
+        size_t                     data_size;     /**< Size in bytes of the data */
+        size_t                     alignment;     /**< Alignment in bytes of the data */
+    };
+
+    /** Constructor: reads the index and maps the file in memory
+     *
+     * @param[in] filename Container to open
+     */
+    PackedWeightsFile(std::string filename);
+    /** Prevent instances of this class from being copied */
+    PackedWeightsFile(const PackedWeightsFile &) = delete;
+    /** Prevent instances of this class from being copied */
+    PackedWeightsFile &operator=(const PackedWeightsFile &) = delete;
+    /** Checks if a file is a weights container
+     *
+     * @param[in] filename File to check
+     *
+     * @return True if the file starts with the container magic
+     */
+    static bool is_packed_weights_file(const std::string &filename);
+    /** Splits a path pointing inside a weights container into the container and the name prefix of its tensors
+     *
+     * The path is walked up to its first existing component, which must be a container, e.g.
+     * "model.pack/cnn_data/alexnet_model/" is split into "model.pack" and "/cnn_data/alexnet_model/".
+     *
+     * @param[in]  path      Path to split
+     * @param[out] container Path of the container
+     * @param[out] prefix    Remainder of the path, to prepend to the names of the tensors
+     *
+     * @return True if the first existing component of the path is a container
+     */
+    static bool split_path(const std::string &path, std::string &container, std::string &prefix);
+    /** Returns the opened container for a file, opening it if no other user holds it
+     *
+     * @param[in] filename Container to open
+     *
+     * @return A container shared by all the users of the file
+     */
+    static std::shared_ptr<PackedWeightsFile> open_shared(const std::string &filename);
+    /** Finds a tensor in the index
+     *
+     * @param[in] name Name of the tensor. Leading and repeated separators are ignored.
+     *
+     * @return The entry of the tensor, or nullptr if not found
+     */
+    const Entry *find(const std::string &name) const;
+    /** Returns the name of the container file */
+    const std::string &filename() const
+    {
+        return _filename;
+    }
+    /** Returns the memory mapping of the container (Can be unmapped if mapping failed) */
+    const MMappedFile &mapping() const
+    {
+        return _file;
+    }
+
+private:
+    const std::string            _filename;
+    MMappedFile                  _file;
+    std::map<std::string, Entry> _entries;
 };
 
 /** Template helper function to save a tensor image to a PPM file.